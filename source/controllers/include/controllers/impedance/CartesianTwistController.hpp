@@ -4,6 +4,7 @@
 #include "controllers/impedance/Dissipative.hpp"
 #include "controllers/impedance/VelocityImpedance.hpp"
 #include "state_representation/parameters/Parameter.hpp"
+#include "state_representation/units/Gain.hpp"
 
 namespace controllers::impedance {
 /**
@@ -122,6 +123,18 @@ public:
    */
   void set_gains(const Eigen::Vector4d& gains);
 
+  /**
+   * @brief Setter of the controller gains from validated gains, a negative constant gain failing to compile
+   * @param linear_principle_damping damping along principle eigenvector of linear velocity error
+   * @param linear_orthogonal_damping damping along secondary eigenvectors of linear velocity error
+   * @param angular_stiffness stiffness of angular displacement
+   * @param angular_damping damping of angular velocity error
+   */
+  void set_gains(const state_representation::units::Gain& linear_principle_damping,
+                 const state_representation::units::Gain& linear_orthogonal_damping,
+                 const state_representation::units::Gain& angular_stiffness,
+                 const state_representation::units::Gain& angular_damping);
+
   /**
    * @brief Getter of the controller gains
    * @return the new gains as a vector of linear principle damping,
@@ -3,6 +3,7 @@
 #include "controllers/impedance/Impedance.hpp"
 #include "state_representation/parameters/Parameter.hpp"
 #include "state_representation/space/cartesian/CartesianState.hpp"
+#include "state_representation/space/cartesian/CartesianStateSlice.hpp"
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/Dense>
 
@@ -142,6 +143,16 @@ public:
    */
   S compute_command(const S& desired_state, const S& feedback_state) override;
 
+  /**
+   * @brief Compute the force command based on the twists of the input states only, reading them in place
+   * instead of copying the states into twists
+   * @param desired_twist the twist of the desired state to reach
+   * @param feedback_twist the twist of the real state of the system as read from feedback loop
+   * @return the output command at the input state
+   */
+  S compute_command(const state_representation::CartesianTwistSlice& desired_twist,
+                    const state_representation::CartesianTwistSlice& feedback_twist);
+
   /**
    * @brief Compute the command based on the desired state and a feedback state
    * To be redefined based on the actual controller implementation.
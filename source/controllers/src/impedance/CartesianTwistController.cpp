@@ -50,6 +50,16 @@ void CartesianTwistController::set_gains(const Eigen::Vector4d& gains) {
   set_angular_gains(gains(2), gains(3));
 }
 
+void CartesianTwistController::set_gains(const units::Gain& linear_principle_damping,
+                                         const units::Gain& linear_orthogonal_damping,
+                                         const units::Gain& angular_stiffness,
+                                         const units::Gain& angular_damping) {
+  set_gains(linear_principle_damping.get_value(),
+            linear_orthogonal_damping.get_value(),
+            angular_stiffness.get_value(),
+            angular_damping.get_value());
+}
+
 Eigen::Vector4d CartesianTwistController::get_gains() const {
   return Eigen::Vector4d(linear_principle_damping_->get_value(),
                          linear_orthogonal_damping_->get_value(),
@@ -104,7 +114,8 @@ std::list<std::shared_ptr<ParameterInterface>> CartesianTwistController::get_par
 
 CartesianState
 CartesianTwistController::compute_command(const CartesianState& desired_state, const CartesianState& feedback_state) {
-  CartesianWrench command = dissipative_ctrl_.compute_command(CartesianTwist(desired_state), CartesianTwist(feedback_state));
+  CartesianWrench command = dissipative_ctrl_.compute_command(CartesianTwistSlice(desired_state),
+                                                              CartesianTwistSlice(feedback_state));
   command += velocity_impedance_ctrl_.compute_command(desired_state, feedback_state);
   return command;
 }
@@ -1,4 +1,7 @@
 #include "controllers/impedance/Dissipative.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/space/cartesian/CartesianWrench.hpp"
 
 using namespace state_representation;
 
@@ -99,4 +102,36 @@ Eigen::MatrixXd Dissipative<JointState>::compute_orthonormal_basis(const JointSt
   // return the full damping matrix
   return Dissipative<JointState>::orthonormalize_basis(this->basis_, desired_velocity.get_velocities());
 }
+
+template<class S>
+S Dissipative<S>::compute_command(const CartesianTwistSlice&, const CartesianTwistSlice&) {
+  throw exceptions::NotImplementedException(
+      "compute_command(desired_twist, feedback_twist) not implemented for this input class");
+}
+
+template JointState Dissipative<JointState>::compute_command(const CartesianTwistSlice&, const CartesianTwistSlice&);
+
+template<>
+CartesianState Dissipative<CartesianState>::compute_command(const CartesianTwistSlice& desired_twist,
+                                                            const CartesianTwistSlice& feedback_twist) {
+  if (CHECKED_OPERATIONS && desired_twist.is_empty()) {
+    throw state_representation::exceptions::EmptyStateException(desired_twist.get_name() + " state is empty");
+  }
+  if (CHECKED_OPERATIONS && feedback_twist.is_empty()) {
+    throw state_representation::exceptions::EmptyStateException(feedback_twist.get_name() + " state is empty");
+  }
+  if (CHECKED_OPERATIONS && desired_twist.get_reference_frame() != feedback_twist.get_reference_frame()) {
+    throw state_representation::exceptions::IncompatibleReferenceFramesException(
+        "The two states do not have the same reference frame");
+  }
+  // the basis only depends on the velocities of the desired state
+  this->compute_damping(desired_twist.get_state());
+  // with a pure twist error, the impedance control law reduces to the damping term W = D * e_twist
+  CartesianWrench command(feedback_twist.get_name(), feedback_twist.get_reference_frame());
+  command.set_force(this->get_damping().topLeftCorner<3, 3>()
+                        * (desired_twist.get_linear_velocity() - feedback_twist.get_linear_velocity()));
+  command.set_torque(this->get_damping().bottomRightCorner<3, 3>()
+                         * (desired_twist.get_angular_velocity() - feedback_twist.get_angular_velocity()));
+  return command;
+}
 }// namespace controllers
\ No newline at end of file
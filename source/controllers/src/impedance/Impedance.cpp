@@ -54,13 +54,12 @@ JointState Impedance<JointState>::compute_command(const JointState& desired_stat
                                                   const JointState& feedback_state) {
   JointState state_error = desired_state - feedback_state;
   // compute the wrench using the formula T = I * acc_desired + K * e_pos + D * e_vel + e_tor
-  JointTorques command(feedback_state.get_name(), feedback_state.get_names());
-  // compute torques
   Eigen::VectorXd state_control = this->get_stiffness() * state_error.get_positions()
       + this->get_damping() * state_error.get_velocities()
       + this->get_inertia() * desired_state.get_accelerations();
   Eigen::VectorXd commanded_torques = state_control + state_error.get_torques();
-  command.set_torques(commanded_torques);
+  // the command shares the joint names table of the feedback state
+  JointTorques command(feedback_state.get_name(), feedback_state.get_shared_names(), commanded_torques);
   return command;
 }
 
@@ -105,4 +105,13 @@ TEST(CartesianTwistControllerTest, ParametersAndSetters) {
       EXPECT_NEAR(param->get_value(), 24, 1e-5);
     }
   }
-}
\ No newline at end of file
+}
+
+TEST(CartesianTwistControllerTest, TypedGains) {
+  using namespace state_representation::units;
+  CartesianTwistController controller(1, 2, 3, 4);
+  constexpr Gain damping = 10.0;
+  controller.set_gains(damping, damping * 0.5, 5.0, 1.0);
+  EXPECT_TRUE(controller.get_gains().isApprox(Eigen::Vector4d(10, 5, 5, 1)));
+  EXPECT_THROW(controller.set_gains(1.0, 1.0, Gain(-1.0), 1.0), exceptions::InvalidParameterException);
+}
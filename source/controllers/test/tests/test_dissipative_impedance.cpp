@@ -3,6 +3,7 @@
 #include "state_representation/space/cartesian/CartesianWrench.hpp"
 #include "state_representation/robot/JointVelocities.hpp"
 #include "state_representation/robot/JointTorques.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
 #include <numeric>
 #include <gtest/gtest.h>
 
@@ -211,6 +212,27 @@ TEST_F(DissipativeImpedanceControllerTest, TestComputeCommandWithColinearVelocit
   EXPECT_NEAR(command.get_force()(2), 0, tolerance_);
 }
 
+TEST_F(DissipativeImpedanceControllerTest, TestComputeCommandFromTwistSlices) {
+  set_controller_space(ComputationalSpaceType::DECOUPLED_TWIST);
+  task_controller_.set_damping_eigenvalues(Eigen::VectorXd::LinSpaced(6, 1, 6));
+  Dissipative<CartesianState> other_controller(task_controller_);
+  // full states, of which only the twists are to be used
+  CartesianState desired_state = CartesianState::Random("test");
+  CartesianState feedback_state = CartesianState::Random("test");
+  CartesianWrench expected = task_controller_.compute_command(CartesianTwist(desired_state),
+                                                              CartesianTwist(feedback_state));
+  CartesianWrench command = other_controller.compute_command(CartesianTwistSlice(desired_state),
+                                                             CartesianTwistSlice(feedback_state));
+  EXPECT_TRUE(command.get_wrench().isApprox(expected.get_wrench()));
+  EXPECT_EQ(command.get_name(), expected.get_name());
+  CartesianState other_state = CartesianState::Random("test", "robot");
+  EXPECT_THROW(other_controller.compute_command(CartesianTwistSlice(desired_state), CartesianTwistSlice(other_state)),
+               exceptions::IncompatibleReferenceFramesException);
+  EXPECT_THROW(joint_controller_.compute_command(CartesianTwistSlice(desired_state),
+                                                 CartesianTwistSlice(feedback_state)),
+               controllers::exceptions::NotImplementedException);
+}
+
 TEST_F(DissipativeImpedanceControllerTest, TestComputeTaskToJointCommand) {
   // set a desired and feeadback velocity
   CartesianTwist desired_twist("test", Eigen::Vector3d(1, 0, 0));
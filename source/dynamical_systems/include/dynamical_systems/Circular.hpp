@@ -169,12 +169,6 @@ public:
    * @param the limit cycle value
    */
   void set_limit_cycle(const state_representation::Ellipsoid& limit_cycle);
-
-  /**
-   * @brief Return a list of all the parameters of the dynamical system
-   * @return the list of parameters
-   */
-  std::list<std::shared_ptr<state_representation::ParameterInterface>> get_parameters() const override;
 };
 
 inline const state_representation::CartesianPose& Circular::get_center() const {
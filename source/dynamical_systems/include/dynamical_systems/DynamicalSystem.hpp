@@ -6,7 +6,7 @@
 
 #pragma once
 
-#include "state_representation/parameters/ParameterInterface.hpp"
+#include "state_representation/parameters/ParameterMap.hpp"
 #include <list>
 #include <memory>
 
@@ -19,8 +19,15 @@ template<class S>
 class DynamicalSystem {
 private:
   S base_frame_; ///< frame in which the dynamical system is expressed
+  state_representation::ParameterMap parameters_; ///< map of the parameters of the dynamical system
 
 protected:
+  /**
+   * @brief Add a parameter to the map of parameters, to be called once in the constructors
+   * @param parameter the parameter, shared with the derived dynamical system
+   */
+  void add_parameter(const std::shared_ptr<state_representation::ParameterInterface>& parameter);
+
   /**
    * @brief Compute the dynamics of the input state.
    * Internal function, to be redefined based on the
@@ -62,6 +69,19 @@ public:
    */
   virtual std::list<std::shared_ptr<state_representation::ParameterInterface>> get_parameters() const;
 
+  /**
+   * @brief Return the map of the parameters of the dynamical system, which is built once and allows typed
+   * lookups and bulk access without allocation
+   * @return the map of parameters
+   */
+  const state_representation::ParameterMap& get_parameter_map() const;
+
+  /**
+   * @brief Return the map of the parameters of the dynamical system, to set their values in bulk
+   * @return the map of parameters
+   */
+  state_representation::ParameterMap& get_parameter_map();
+
   /**
    * @brief Return the base frame of the dynamical system
    * @return the base frame
@@ -87,8 +107,22 @@ DynamicalSystem<S>::DynamicalSystem(const S& base_frame) : base_frame_(base_fram
 
 template<class S>
 std::list<std::shared_ptr<state_representation::ParameterInterface>> DynamicalSystem<S>::get_parameters() const {
-  std::list<std::shared_ptr<state_representation::ParameterInterface>> param_list;
-  return param_list;
+  return this->parameters_.to_list();
+}
+
+template<class S>
+inline const state_representation::ParameterMap& DynamicalSystem<S>::get_parameter_map() const {
+  return this->parameters_;
+}
+
+template<class S>
+inline state_representation::ParameterMap& DynamicalSystem<S>::get_parameter_map() {
+  return this->parameters_;
+}
+
+template<class S>
+inline void DynamicalSystem<S>::add_parameter(const std::shared_ptr<state_representation::ParameterInterface>& parameter) {
+  this->parameters_.add_parameter(parameter);
 }
 
 template<class S>
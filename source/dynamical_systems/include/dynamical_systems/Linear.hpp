@@ -107,12 +107,6 @@ public:
    * @param gain_matrix the gain values as a full gain matrix
    */
   void set_gain(const Eigen::MatrixXd& gain_matrix);
-
-  /**
-   * @brief Return a list of all the parameters of the dynamical system
-   * @return the list of parameters
-   */
-  std::list<std::shared_ptr<state_representation::ParameterInterface>> get_parameters() const;
 };
 
 template<>
@@ -213,12 +207,4 @@ template<class S>
 inline const Eigen::MatrixXd& Linear<S>::get_gain() const {
   return this->gain_->get_value();
 }
-
-template<class S>
-std::list<std::shared_ptr<state_representation::ParameterInterface>> Linear<S>::get_parameters() const {
-  std::list<std::shared_ptr<state_representation::ParameterInterface>> param_list;
-  param_list.push_back(this->attractor_);
-  param_list.push_back(this->gain_);
-  return param_list;
-}
 }// namespace dynamical_systems
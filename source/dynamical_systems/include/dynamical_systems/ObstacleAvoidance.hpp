@@ -0,0 +1,170 @@
+#pragma once
+
+#include "dynamical_systems/DynamicalSystem.hpp"
+#include "state_representation/geometry/ShapeSet.hpp"
+#include "state_representation/parameters/Parameter.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace dynamical_systems {
+/**
+ * @class ObstacleAvoidance
+ * @brief Modulate the linear velocity of a Cartesian dynamical system around moving ellipsoid obstacles with
+ * the modulation matrices of
+ * Khansari-Zadeh, S. M. and Billard, A. (2012). "A dynamical system approach to realtime obstacle avoidance."
+ * Autonomous Robots 32(4).
+ * For each obstacle, the modulation matrix reduces the velocity along the normal of its surface and increases
+ * it along the tangent plane, depending on its Gamma function, equal to 1 on the surface and growing with the
+ * distance. The obstacles are stored in a ShapeSet, the obstacles further than the cutoff distance being culled
+ * before their evaluation, and the angular velocity of the modulated system is kept as is. The evaluation reuses
+ * buffers of the system for the obstacles near the state, such that it only allocates when their number changes,
+ * and a system cannot be evaluated by several threads at once.
+ */
+class ObstacleAvoidance : public DynamicalSystem<state_representation::CartesianState> {
+private:
+  std::shared_ptr<DynamicalSystem<state_representation::CartesianState>> system_; ///< modulated dynamical system
+  state_representation::ShapeSet obstacles_; ///< geometry of the obstacles in the base frame
+  Eigen::Matrix<double, Eigen::Dynamic, 6> obstacle_twists_; ///< linear and angular velocities of the obstacles
+  std::shared_ptr<state_representation::Parameter<double>> reactivity_; ///< reactivity to the obstacles
+  std::shared_ptr<state_representation::Parameter<double>> safety_margin_; ///< distance kept to the obstacles [m]
+  std::shared_ptr<state_representation::Parameter<double>> cutoff_distance_; ///< distance of ignored obstacles [m]
+  mutable std::vector<std::size_t> indices_; ///< indices of the obstacles near the evaluated state
+  mutable Eigen::VectorXd distances_; ///< distances, then Gamma functions, of the obstacles near the evaluated state
+  mutable Eigen::Matrix3Xd normals_; ///< normals of the obstacles near the evaluated state
+  mutable Eigen::ArrayXd weights_; ///< weights, then influences, of the obstacles near the evaluated state
+
+  /**
+   * @brief Check and store the twist of an obstacle
+   * @param index the index of the obstacle
+   * @param obstacle the obstacle
+   */
+  void set_obstacle_twist(std::size_t index, const state_representation::Ellipsoid& obstacle);
+
+protected:
+  /**
+   * @brief Compute the dynamics of the input state.
+   * Internal function, to be redefined based on the
+   * type of dynamical system, called by the evaluate
+   * function
+   * @param state the input state
+   * @return the output state
+   */
+  state_representation::CartesianState compute_dynamics(const state_representation::CartesianState& state) const override;
+
+public:
+  /**
+   * @brief Constructor with the dynamical system to modulate, which gives the base frame
+   * @param system the dynamical system to modulate
+   * @param reactivity the reactivity to the obstacles, higher values modulating the velocity further away
+   * @param safety_margin the distance kept to the surface of the obstacles [m]
+   * @param cutoff_distance the distance above which the obstacles are ignored [m], by default none of them
+   */
+  explicit ObstacleAvoidance(const std::shared_ptr<DynamicalSystem<state_representation::CartesianState>>& system,
+                             double reactivity = 1.0,
+                             double safety_margin = 0.0,
+                             double cutoff_distance = std::numeric_limits<double>::infinity());
+
+  /**
+   * @brief Getter of the modulated dynamical system
+   * @return the modulated dynamical system
+   */
+  const std::shared_ptr<DynamicalSystem<state_representation::CartesianState>>& get_dynamical_system() const;
+
+  /**
+   * @brief Setter of the base frame as a new value, also set to the modulated dynamical system
+   * @param base_frame the new base frame, with the same name if there are obstacles
+   */
+  void set_base_frame(const state_representation::CartesianState& base_frame) override;
+
+  /**
+   * @brief Getter of the obstacles
+   * @return the obstacles, expressed in the base frame
+   */
+  const state_representation::ShapeSet& get_obstacles() const;
+
+  /**
+   * @brief Add an obstacle, its velocity being the twist of its center state
+   * @param obstacle the obstacle, expressed in the base frame
+   * @return the index of the obstacle
+   */
+  std::size_t add_obstacle(const state_representation::Ellipsoid& obstacle);
+
+  /**
+   * @brief Update an obstacle, e.g. a moving one, refitting the hierarchy of the obstacles without rebuilding it
+   * @param index the index of the obstacle
+   * @param obstacle the obstacle, expressed in the base frame
+   */
+  void set_obstacle(std::size_t index, const state_representation::Ellipsoid& obstacle);
+
+  /**
+   * @brief Update all the obstacles at once and rebuild their hierarchy, which keeps the culling efficient
+   * when the obstacles move far from each other
+   * @param obstacles the obstacles, expressed in the base frame, in the order in which they were added
+   */
+  void set_obstacles(const std::vector<state_representation::Ellipsoid>& obstacles);
+
+  /**
+   * @brief Remove all the obstacles
+   */
+  void clear_obstacles();
+
+  /**
+   * @brief Getter of the reactivity to the obstacles
+   * @return the reactivity
+   */
+  double get_reactivity() const;
+
+  /**
+   * @brief Setter of the reactivity to the obstacles
+   * @param reactivity the positive reactivity
+   */
+  void set_reactivity(double reactivity);
+
+  /**
+   * @brief Getter of the safety margin
+   * @return the distance kept to the surface of the obstacles [m]
+   */
+  double get_safety_margin() const;
+
+  /**
+   * @brief Setter of the safety margin
+   * @param safety_margin the distance kept to the surface of the obstacles [m]
+   */
+  void set_safety_margin(double safety_margin);
+
+  /**
+   * @brief Getter of the cutoff distance
+   * @return the distance above which the obstacles are ignored [m]
+   */
+  double get_cutoff_distance() const;
+
+  /**
+   * @brief Setter of the cutoff distance
+   * @param cutoff_distance the distance above which the obstacles are ignored [m]
+   */
+  void set_cutoff_distance(double cutoff_distance);
+};
+
+inline const std::shared_ptr<DynamicalSystem<state_representation::CartesianState>>&
+ObstacleAvoidance::get_dynamical_system() const {
+  return this->system_;
+}
+
+inline const state_representation::ShapeSet& ObstacleAvoidance::get_obstacles() const {
+  return this->obstacles_;
+}
+
+inline double ObstacleAvoidance::get_reactivity() const {
+  return this->reactivity_->get_value();
+}
+
+inline double ObstacleAvoidance::get_safety_margin() const {
+  return this->safety_margin_->get_value();
+}
+
+inline double ObstacleAvoidance::get_cutoff_distance() const {
+  return this->cutoff_distance_->get_value();
+}
+}// namespace dynamical_systems
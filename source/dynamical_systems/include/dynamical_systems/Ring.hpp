@@ -162,12 +162,6 @@ public:
    * @return the angular gain
    */
   double get_angular_gain() const;
-
-  /**
-   * @brief Return a list of all the parameters of the dynamical system
-   * @return the list of parameters
-   */
-  std::list<std::shared_ptr<state_representation::ParameterInterface>> get_parameters() const override;
 };
 
 }// namespace dynamical_systems
\ No newline at end of file
@@ -12,6 +12,10 @@ Circular::Circular() :
     planar_gain_(std::make_shared<Parameter<double>>("planar_gain", 1.0)),
     normal_gain_(std::make_shared<Parameter<double>>("normal_gain", 1.0)),
     circular_velocity_(std::make_shared<Parameter<double>>("circular_velocity", M_PI / 2)) {
+  this->add_parameter(this->limit_cycle_);
+  this->add_parameter(this->planar_gain_);
+  this->add_parameter(this->normal_gain_);
+  this->add_parameter(this->circular_velocity_);
   this->limit_cycle_->get_value().set_center_state(CartesianState("limit_cycle", "limit_cycle"));
 }
 
@@ -22,6 +26,10 @@ Circular::Circular(const CartesianState& center, double radius, double gain, dou
     planar_gain_(std::make_shared<Parameter<double>>("planar_gain", gain)),
     normal_gain_(std::make_shared<Parameter<double>>("normal_gain", gain)),
     circular_velocity_(std::make_shared<Parameter<double>>("circular_velocity", circular_velocity)) {
+  this->add_parameter(this->limit_cycle_);
+  this->add_parameter(this->planar_gain_);
+  this->add_parameter(this->normal_gain_);
+  this->add_parameter(this->circular_velocity_);
   this->limit_cycle_->get_value().set_center_state(center);
   this->limit_cycle_->get_value().set_axis_lengths({radius, radius});
 }
@@ -31,7 +39,12 @@ Circular::Circular(const Ellipsoid& limit_cycle, double gain, double circular_ve
     limit_cycle_(std::make_shared<Parameter<Ellipsoid>>("limit_cycle", limit_cycle)),
     planar_gain_(std::make_shared<Parameter<double>>("planar_gain", gain)),
     normal_gain_(std::make_shared<Parameter<double>>("normal_gain", gain)),
-    circular_velocity_(std::make_shared<Parameter<double>>("circular_velocity", circular_velocity)) {}
+    circular_velocity_(std::make_shared<Parameter<double>>("circular_velocity", circular_velocity)) {
+  this->add_parameter(this->limit_cycle_);
+  this->add_parameter(this->planar_gain_);
+  this->add_parameter(this->normal_gain_);
+  this->add_parameter(this->circular_velocity_);
+}
 
 CartesianState Circular::compute_dynamics(const CartesianState& state) const {
   if (this->get_limit_cycle().get_center_state().is_empty()) {
@@ -64,15 +77,6 @@ CartesianState Circular::compute_dynamics(const CartesianState& state) const {
   return CartesianState(frame) * velocity;
 }
 
-std::list<std::shared_ptr<ParameterInterface>> Circular::get_parameters() const {
-  std::list<std::shared_ptr<ParameterInterface>> param_list;
-  param_list.push_back(this->limit_cycle_);
-  param_list.push_back(this->planar_gain_);
-  param_list.push_back(this->normal_gain_);
-  param_list.push_back(this->circular_velocity_);
-  return param_list;
-}
-
 void Circular::set_base_frame(const CartesianState& base_frame) {
   if (base_frame.is_empty()) {
     throw state_representation::exceptions::EmptyStateException(base_frame.get_name() + " state is empty");
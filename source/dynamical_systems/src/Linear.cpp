@@ -58,6 +58,8 @@ Linear<CartesianState>::Linear() :
     DynamicalSystem<CartesianState>(),
     attractor_(std::make_shared<Parameter<CartesianState>>(Parameter<CartesianPose>("attractor", CartesianPose()))),
     gain_(std::make_shared<Parameter<Eigen::MatrixXd>>("gain")) {
+  this->add_parameter(this->attractor_);
+  this->add_parameter(this->gain_);
   this->attractor_->get_value().set_empty();
   this->set_gain(1);
 }
@@ -67,6 +69,8 @@ Linear<JointState>::Linear() :
     DynamicalSystem<JointState>(),
     attractor_(std::make_shared<Parameter<JointState>>(Parameter<JointPositions>("attractor", JointPositions()))),
     gain_(std::make_shared<Parameter<Eigen::MatrixXd>>("gain")) {
+  this->add_parameter(this->attractor_);
+  this->add_parameter(this->gain_);
   this->attractor_->get_value().set_empty();
 }
 
@@ -75,6 +79,8 @@ Linear<CartesianState>::Linear(const CartesianState& attractor, double iso_gain)
     DynamicalSystem<CartesianState>(attractor.get_reference_frame()),
     attractor_(std::make_shared<Parameter<CartesianState>>(Parameter<CartesianPose>("attractor", attractor))),
     gain_(std::make_shared<Parameter<Eigen::MatrixXd>>("gain")) {
+  this->add_parameter(this->attractor_);
+  this->add_parameter(this->gain_);
   if (attractor.is_empty()) {
     throw state_representation::exceptions::EmptyStateException(attractor.get_name() + " state is empty");
   }
@@ -86,6 +92,8 @@ Linear<JointState>::Linear(const JointState& attractor, double iso_gain) :
     DynamicalSystem<JointState>(JointState::Zero(attractor.get_name(), attractor.get_names())),
     attractor_(std::make_shared<Parameter<JointState>>(Parameter<JointPositions>("attractor", attractor))),
     gain_(std::make_shared<Parameter<Eigen::MatrixXd>>("gain")) {
+  this->add_parameter(this->attractor_);
+  this->add_parameter(this->gain_);
   if (attractor.is_empty()) {
     throw state_representation::exceptions::EmptyStateException(attractor.get_name() + " state is empty");
   }
@@ -97,6 +105,8 @@ Linear<CartesianState>::Linear(const CartesianState& attractor, const std::vecto
     DynamicalSystem<CartesianState>(attractor.get_reference_frame()),
     attractor_(std::make_shared<Parameter<CartesianState>>(Parameter<CartesianPose>("attractor", attractor))),
     gain_(std::make_shared<Parameter<Eigen::MatrixXd>>("gain")) {
+  this->add_parameter(this->attractor_);
+  this->add_parameter(this->gain_);
   if (attractor.is_empty()) {
     throw state_representation::exceptions::EmptyStateException(attractor.get_name() + " state is empty");
   }
@@ -108,6 +118,8 @@ Linear<JointState>::Linear(const JointState& attractor, const std::vector<double
     DynamicalSystem<JointState>(),
     attractor_(std::make_shared<Parameter<JointState>>(Parameter<JointPositions>("attractor", attractor))),
     gain_(std::make_shared<Parameter<Eigen::MatrixXd>>("gain")) {
+  this->add_parameter(this->attractor_);
+  this->add_parameter(this->gain_);
   if (attractor.is_empty()) {
     throw state_representation::exceptions::EmptyStateException(attractor.get_name() + " state is empty");
   }
@@ -119,6 +131,8 @@ Linear<CartesianState>::Linear(const CartesianState& attractor, const Eigen::Mat
     DynamicalSystem<CartesianState>(attractor.get_reference_frame()),
     attractor_(std::make_shared<Parameter<CartesianState>>(Parameter<CartesianPose>("attractor", attractor))),
     gain_(std::make_shared<Parameter<Eigen::MatrixXd>>("gain")) {
+  this->add_parameter(this->attractor_);
+  this->add_parameter(this->gain_);
   if (attractor.is_empty()) {
     throw state_representation::exceptions::EmptyStateException(attractor.get_name() + " state is empty");
   }
@@ -130,6 +144,8 @@ Linear<JointState>::Linear(const JointState& attractor, const Eigen::MatrixXd& g
     DynamicalSystem<JointState>(),
     attractor_(std::make_shared<Parameter<JointState>>(Parameter<JointPositions>("attractor", attractor))),
     gain_(std::make_shared<Parameter<Eigen::MatrixXd>>("gain")) {
+  this->add_parameter(this->attractor_);
+  this->add_parameter(this->gain_);
   if (attractor.is_empty()) {
     throw state_representation::exceptions::EmptyStateException(attractor.get_name() + " state is empty");
   }
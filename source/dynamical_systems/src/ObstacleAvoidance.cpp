@@ -0,0 +1,140 @@
+#include "dynamical_systems/ObstacleAvoidance.hpp"
+
+#include "dynamical_systems/exceptions/EmptyBaseFrameException.hpp"
+#include "dynamical_systems/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+using namespace state_representation;
+
+namespace dynamical_systems {
+
+ObstacleAvoidance::ObstacleAvoidance(const std::shared_ptr<DynamicalSystem<CartesianState>>& system,
+                                     double reactivity,
+                                     double safety_margin,
+                                     double cutoff_distance) :
+    DynamicalSystem<CartesianState>(),
+    system_(system),
+    reactivity_(std::make_shared<Parameter<double>>("reactivity", reactivity)),
+    safety_margin_(std::make_shared<Parameter<double>>("safety_margin", safety_margin)),
+    cutoff_distance_(std::make_shared<Parameter<double>>("cutoff_distance", cutoff_distance)) {
+  this->add_parameter(this->reactivity_);
+  this->add_parameter(this->safety_margin_);
+  this->add_parameter(this->cutoff_distance_);
+  if (system == nullptr) {
+    throw state_representation::exceptions::InvalidParameterException("The modulated dynamical system is not set");
+  }
+  if (system->get_base_frame().is_empty()) {
+    throw exceptions::EmptyBaseFrameException("The base frame of the modulated dynamical system is empty.");
+  }
+  this->set_reactivity(reactivity);
+  DynamicalSystem<CartesianState>::set_base_frame(system->get_base_frame());
+  this->obstacles_ = ShapeSet(system->get_base_frame().get_name());
+}
+
+void ObstacleAvoidance::set_base_frame(const CartesianState& base_frame) {
+  if (base_frame.get_name() != this->obstacles_.get_reference_frame()) {
+    if (this->obstacles_.get_size() > 0) {
+      throw state_representation::exceptions::IncompatibleReferenceFramesException(
+          "The obstacles are expressed in the base frame " + this->obstacles_.get_reference_frame()
+              + " and cannot be moved to the base frame " + base_frame.get_name() + ".");
+    }
+    this->obstacles_ = ShapeSet(base_frame.get_name());
+  }
+  this->system_->set_base_frame(base_frame);
+  DynamicalSystem<CartesianState>::set_base_frame(base_frame);
+}
+
+void ObstacleAvoidance::set_obstacle_twist(std::size_t index, const Ellipsoid& obstacle) {
+  const CartesianState& center = obstacle.get_center_state();
+  this->obstacle_twists_.block<1, 3>(static_cast<Eigen::Index>(index), 0) = center.get_linear_velocity().transpose();
+  this->obstacle_twists_.block<1, 3>(static_cast<Eigen::Index>(index), 3) = center.get_angular_velocity().transpose();
+}
+
+std::size_t ObstacleAvoidance::add_obstacle(const Ellipsoid& obstacle) {
+  std::size_t index = this->obstacles_.add(obstacle);
+  this->obstacle_twists_.conservativeResize(this->obstacle_twists_.rows() + 1, Eigen::NoChange);
+  this->set_obstacle_twist(index, obstacle);
+  this->obstacles_.build_hierarchy();
+  return index;
+}
+
+void ObstacleAvoidance::set_obstacle(std::size_t index, const Ellipsoid& obstacle) {
+  this->obstacles_.set(index, obstacle);
+  this->set_obstacle_twist(index, obstacle);
+}
+
+void ObstacleAvoidance::set_obstacles(const std::vector<Ellipsoid>& obstacles) {
+  if (obstacles.size() != this->obstacles_.get_size()) {
+    throw exceptions::IncompatibleSizeException(
+        "Expected " + std::to_string(this->obstacles_.get_size()) + " obstacles, got "
+            + std::to_string(obstacles.size()));
+  }
+  for (std::size_t i = 0; i < obstacles.size(); ++i) {
+    this->set_obstacle(i, obstacles[i]);
+  }
+  this->obstacles_.build_hierarchy();
+}
+
+void ObstacleAvoidance::clear_obstacles() {
+  this->obstacles_.clear();
+  this->obstacle_twists_.resize(0, Eigen::NoChange);
+}
+
+void ObstacleAvoidance::set_reactivity(double reactivity) {
+  if (reactivity <= 0) {
+    throw state_representation::exceptions::InvalidParameterException("The reactivity has to be positive");
+  }
+  this->reactivity_->set_value(reactivity);
+}
+
+void ObstacleAvoidance::set_safety_margin(double safety_margin) {
+  this->safety_margin_->set_value(safety_margin);
+}
+
+void ObstacleAvoidance::set_cutoff_distance(double cutoff_distance) {
+  this->cutoff_distance_->set_value(cutoff_distance);
+}
+
+CartesianState ObstacleAvoidance::compute_dynamics(const CartesianState& state) const {
+  CartesianState velocity = this->system_->evaluate(state);
+  this->obstacles_.query(state.get_position(), this->get_cutoff_distance(), this->indices_, this->distances_,
+                         this->normals_);
+  if (this->indices_.empty()) {
+    return velocity;
+  }
+
+  // Gamma functions, equal to 1 at the safety margin, and weights of the obstacles inversely proportional to
+  // their distance, an obstacle within its safety margin taking all the weight
+  auto gamma = this->distances_.array();
+  gamma = (gamma - this->get_safety_margin()).max(0) + 1;
+  this->weights_ = (gamma - 1 < 1e-12).cast<double>();
+  if (this->weights_.sum() == 0) {
+    this->weights_ = (gamma - 1).inverse();
+  }
+  this->weights_ /= this->weights_.sum();
+
+  // the velocity relative to the obstacles, at the position of the state, is modulated
+  Eigen::Vector3d obstacles_velocity = Eigen::Vector3d::Zero();
+  for (Eigen::Index k = 0; k < gamma.size(); ++k) {
+    auto i = static_cast<Eigen::Index>(this->indices_[k]);
+    Eigen::Vector3d lever = state.get_position() - this->obstacles_.data().block<1, 3>(i, 0).transpose();
+    obstacles_velocity += this->weights_(k) * (this->obstacle_twists_.block<1, 3>(i, 0).transpose()
+        + this->obstacle_twists_.block<1, 3>(i, 3).transpose().cross(lever));
+  }
+  Eigen::ArrayXd& influence = this->weights_;
+  influence *= gamma.pow(-1 / this->get_reactivity());
+  Eigen::Vector3d relative_velocity = velocity.get_linear_velocity() - obstacles_velocity;
+  for (Eigen::Index k = 0; k < gamma.size(); ++k) {
+    // M = E D E^T with the orthonormal basis E of the normal and the tangent plane, the normal eigenvalue
+    // being 1 when moving away from the obstacle to avoid slowing down behind it
+    double normal_velocity = this->normals_.col(k).dot(relative_velocity);
+    double normal_eigenvalue = normal_velocity > 0 ? 1 : 1 - influence(k);
+    double tangent_eigenvalue = 1 + influence(k);
+    relative_velocity = tangent_eigenvalue * relative_velocity
+        + (normal_eigenvalue - tangent_eigenvalue) * normal_velocity * this->normals_.col(k);
+  }
+  velocity.set_linear_velocity(relative_velocity + obstacles_velocity);
+  return velocity;
+}
+}// namespace dynamical_systems
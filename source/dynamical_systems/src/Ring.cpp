@@ -19,6 +19,14 @@ Ring::Ring() :
     field_strength_(std::make_shared<Parameter<double>>("field_strength", 1.0)),
     normal_gain_(std::make_shared<Parameter<double>>("normal_gain", 1.0)),
     angular_gain_(std::make_shared<Parameter<double>>("angular_gain", 1.0)) {
+  this->add_parameter(this->center_);
+  this->add_parameter(this->rotation_offset_);
+  this->add_parameter(this->radius_);
+  this->add_parameter(this->width_);
+  this->add_parameter(this->speed_);
+  this->add_parameter(this->field_strength_);
+  this->add_parameter(this->normal_gain_);
+  this->add_parameter(this->angular_gain_);
   this->center_->get_value().set_empty();
   this->set_rotation_offset(Eigen::Quaterniond::Identity());
 }
@@ -39,6 +47,14 @@ Ring::Ring(const CartesianState& center,
     field_strength_(std::make_shared<Parameter<double>>("field_strength", field_strength)),
     normal_gain_(std::make_shared<Parameter<double>>("normal_gain", normal_gain)),
     angular_gain_(std::make_shared<Parameter<double>>("angular_gain", angular_gain)) {
+  this->add_parameter(this->center_);
+  this->add_parameter(this->rotation_offset_);
+  this->add_parameter(this->radius_);
+  this->add_parameter(this->width_);
+  this->add_parameter(this->speed_);
+  this->add_parameter(this->field_strength_);
+  this->add_parameter(this->normal_gain_);
+  this->add_parameter(this->angular_gain_);
   this->set_center(center);
   this->set_rotation_offset(Eigen::Quaterniond::Identity());
 }
@@ -249,17 +265,4 @@ double Ring::get_normal_gain() const {
 double Ring::get_angular_gain() const {
   return this->angular_gain_->get_value();
 }
-
-std::list<std::shared_ptr<ParameterInterface>> Ring::get_parameters() const {
-  std::list<std::shared_ptr<ParameterInterface>> param_list;
-  param_list.push_back(this->center_);
-  param_list.push_back(this->rotation_offset_);
-  param_list.push_back(this->radius_);
-  param_list.push_back(this->width_);
-  param_list.push_back(this->speed_);
-  param_list.push_back(this->field_strength_);
-  param_list.push_back(this->normal_gain_);
-  param_list.push_back(this->angular_gain_);
-  return param_list;
-}
 }// namespace dynamical_systems
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "dynamical_systems/Circular.hpp"
+#include "state_representation/geometry/EllipsoidEstimator.hpp"
 #include "dynamical_systems/exceptions/EmptyBaseFrameException.hpp"
 #include "dynamical_systems/exceptions/EmptyAttractorException.hpp"
 
@@ -117,3 +118,32 @@ TEST_F(CircularDSTest, SetCenterAndBase) {
   EXPECT_NO_THROW(circularDS.set_center(CinB));
   EXPECT_NO_THROW(circularDS.set_center(CinB.inverse()));
 }
+
+TEST_F(CircularDSTest, StreamingLimitCycleEstimation) {
+  dynamical_systems::Circular circularDS(center);
+  EllipsoidEstimator estimator("estimate", circularDS.get_center());
+  estimator.bind(circularDS.get_parameter_map().get_parameter<Ellipsoid>("limit_cycle"));
+
+  Ellipsoid demonstration("demonstration");
+  demonstration.set_center_position(Eigen::Vector3d(0.5, -0.5, 0));
+  demonstration.set_axis_lengths({3, 2});
+  demonstration.set_rotation_angle(0.3);
+  for (const auto& point : demonstration.sample_from_parameterization(50)) {
+    estimator.add_point(point.get_position());
+  }
+  EXPECT_EQ(circularDS.get_limit_cycle().get_name(), center.get_name());
+  EXPECT_NEAR(circularDS.get_radiuses()[0], 3, 1e-6);
+  EXPECT_NEAR(circularDS.get_radiuses()[1], 2, 1e-6);
+  EXPECT_NEAR(std::remainder(circularDS.get_rotation_angle() - 0.3, M_PI), 0, 1e-6);
+  EXPECT_TRUE(circularDS.get_center().get_position().isApprox(Eigen::Vector3d(0.5, -0.5, 0)));
+
+  // the system converges to the estimated limit cycle
+  for (unsigned int i = 0; i < nb_steps; ++i) {
+    CartesianTwist twist = circularDS.evaluate(current_pose);
+    twist.clamp(10, 10, 0.001, 0.001);
+    current_pose += dt * twist;
+  }
+  Eigen::Vector3d local = Eigen::AngleAxisd(-0.3, Eigen::Vector3d::UnitZ())
+      * (current_pose.get_position() - Eigen::Vector3d(0.5, -0.5, 0));
+  EXPECT_NEAR(std::pow(local(0) / 3, 2) + std::pow(local(1) / 2, 2), 1, 1e-2);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "dynamical_systems/Linear.hpp"
+#include "dynamical_systems/ObstacleAvoidance.hpp"
+#include "dynamical_systems/exceptions/EmptyBaseFrameException.hpp"
+
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+using namespace state_representation;
+using namespace dynamical_systems;
+using namespace std::literals::chrono_literals;
+
+class ObstacleAvoidanceDSTest : public testing::Test {
+protected:
+  void SetUp() override {
+    linear = std::make_shared<Linear<CartesianState>>(CartesianPose("attractor", Eigen::Vector3d(5, 0, 0), "world"));
+    obstacle.set_axis_lengths({1., 0.5});
+    obstacle.set_rotation_angle(0.2);
+  }
+
+  std::shared_ptr<Linear<CartesianState>> linear;
+  Ellipsoid obstacle = Ellipsoid("obstacle", "world");
+  std::chrono::milliseconds dt = 10ms;
+};
+
+TEST_F(ObstacleAvoidanceDSTest, Construction) {
+  EXPECT_THROW(ObstacleAvoidance(std::make_shared<Linear<CartesianState>>()),
+               dynamical_systems::exceptions::EmptyBaseFrameException);
+  EXPECT_THROW(ObstacleAvoidance(linear, 0), state_representation::exceptions::InvalidParameterException);
+  ObstacleAvoidance ds(linear, 2, 0.1, 3);
+  EXPECT_EQ(ds.get_base_frame().get_name(), "world");
+  EXPECT_EQ(ds.get_parameter_map().get_parameter<double>("reactivity")->get_value(), 2);
+  EXPECT_EQ(ds.get_parameter_map().get_parameter<double>("cutoff_distance")->get_value(), 3);
+  EXPECT_THROW(ds.add_obstacle(Ellipsoid("other", "robot")),
+               state_representation::exceptions::IncompatibleReferenceFramesException);
+  EXPECT_EQ(ds.add_obstacle(obstacle), 0);
+  EXPECT_EQ(ds.get_obstacles().get_size(), 1);
+  EXPECT_THROW(ds.set_base_frame(CartesianState::Identity("robot", "world")),
+               state_representation::exceptions::IncompatibleReferenceFramesException);
+  ds.clear_obstacles();
+  EXPECT_EQ(ds.get_obstacles().get_size(), 0);
+}
+
+TEST_F(ObstacleAvoidanceDSTest, AvoidStaticObstacle) {
+  ObstacleAvoidance ds(linear, 1, 0.1);
+  ds.add_obstacle(obstacle);
+  CartesianPose current_pose("robot", Eigen::Vector3d(-5, 0.01, 0), "world");
+  for (int i = 0; i < 2000; ++i) {
+    CartesianTwist twist = ds.evaluate(current_pose);
+    current_pose += dt * twist;
+    EXPECT_GT(obstacle.signed_distance(current_pose.get_position()), 0);
+  }
+  EXPECT_TRUE(current_pose.get_position().isApprox(linear->get_attractor().get_position(), 1e-3));
+}
+
+TEST_F(ObstacleAvoidanceDSTest, Culling) {
+  ObstacleAvoidance ds(linear, 1, 0, 2);
+  // a crowd of obstacles out of reach of the evaluated point
+  for (int i = 0; i < 60; ++i) {
+    Ellipsoid far("obstacle" + std::to_string(i), "world");
+    far.set_center_position(Eigen::Vector3d(10 + i, 5 * std::sin(i), 0));
+    ds.add_obstacle(far);
+  }
+  CartesianPose current_pose("robot", Eigen::Vector3d(-3, 1, 0), "world");
+  CartesianState expected = linear->evaluate(current_pose);
+  CartesianState modulated = ds.evaluate(current_pose);
+  EXPECT_TRUE(modulated.get_linear_velocity().isApprox(expected.get_linear_velocity()));
+  EXPECT_TRUE(modulated.get_angular_velocity().isApprox(expected.get_angular_velocity()));
+
+  // the same obstacles moved close to the point modulate its velocity
+  std::vector<Ellipsoid> obstacles;
+  for (int i = 0; i < 60; ++i) {
+    Ellipsoid close("obstacle" + std::to_string(i), "world");
+    close.set_center_position(Eigen::Vector3d(-1.5 + 0.01 * i, 1, 0));
+    obstacles.push_back(close);
+  }
+  ds.set_obstacles(obstacles);
+  modulated = ds.evaluate(current_pose);
+  EXPECT_FALSE(modulated.get_linear_velocity().isApprox(expected.get_linear_velocity()));
+
+  // moving the obstacles one by one keeps the hierarchy up to date
+  for (std::size_t i = 0; i < obstacles.size(); ++i) {
+    obstacles[i].set_center_position(Eigen::Vector3d(-10 - static_cast<double>(i), 1, 0));
+    ds.set_obstacle(i, obstacles[i]);
+  }
+  EXPECT_TRUE(ds.get_obstacles().has_hierarchy());
+  modulated = ds.evaluate(current_pose);
+  EXPECT_TRUE(modulated.get_linear_velocity().isApprox(expected.get_linear_velocity()));
+}
+
+TEST_F(ObstacleAvoidanceDSTest, MovingObstacle) {
+  ObstacleAvoidance ds(linear);
+  obstacle.set_center_state(CartesianTwist("obstacle", Eigen::Vector3d(-1, 0, 0), Eigen::Vector3d(0, 0, 0.5), "world"));
+  ds.add_obstacle(obstacle);
+  // on the surface, the velocity relative to the obstacle does not go inside
+  Eigen::Vector3d position = obstacle.get_closest_point(Eigen::Vector3d(-2, 0.3, 0));
+  CartesianState modulated = ds.evaluate(CartesianPose("robot", position, "world"));
+  Eigen::Vector3d obstacle_velocity =
+      Eigen::Vector3d(-1, 0, 0) + Eigen::Vector3d(0, 0, 0.5).cross(position - obstacle.get_center_position());
+  EXPECT_GE(obstacle.get_normal(position).dot(modulated.get_linear_velocity() - obstacle_velocity), -1e-9);
+}
@@ -65,6 +65,25 @@ TEST_F(RingDSTest, EmptyConstructor) {
   EXPECT_TRUE(ds.is_compatible(state4));
 }
 
+TEST_F(RingDSTest, ParameterMap) {
+  dynamical_systems::Ring ring(center, radius, width, speed);
+  std::vector<std::string> names;
+  for (const auto& parameter : ring.get_parameters()) {
+    names.push_back(parameter->get_name());
+  }
+  EXPECT_EQ(names, std::vector<std::string>({"center", "rotation_offset", "radius", "width", "speed",
+                                             "field_strength", "normal_gain", "angular_gain"}));
+  auto radius_parameter = ring.get_parameter_map().get_parameter<double>("radius");
+  ring.set_radius(2 * radius);
+  EXPECT_EQ(radius_parameter->get_value(), 2 * radius);
+
+  auto& parameters = ring.get_parameter_map();
+  Eigen::VectorXd values = parameters.get_flat_values();
+  values(parameters.get_flat_offset(parameters.get_index("width"))) = 0.5;
+  parameters.set_flat_values(values);
+  EXPECT_EQ(ring.get_width(), 0.5);
+}
+
 TEST_F(RingDSTest, PointsOnRadius) {
   dynamical_systems::Ring ring(center, radius, width, speed);
   CartesianTwist twist;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 #include <OsqpEigen/OsqpEigen.h>
@@ -9,9 +10,11 @@
 #include <pinocchio/parsers/urdf.hpp>
 #include <state_representation/parameters/Parameter.hpp>
 #include <state_representation/parameters/ParameterInterface.hpp>
+#include <state_representation/robot/ChainJacobian.hpp>
 #include <state_representation/robot/Jacobian.hpp>
 #include <state_representation/robot/JointState.hpp>
 #include <state_representation/space/cartesian/CartesianState.hpp>
+#include <state_representation/space/dual_quaternion/DualQuaternionBatch.hpp>
 
 using namespace std::chrono_literals;
 
@@ -61,6 +64,9 @@ private:
   std::shared_ptr<state_representation::Parameter<std::string>> robot_name_;///< name of the robot
   std::shared_ptr<state_representation::Parameter<std::string>> urdf_path_; ///< path to the urdf file
   std::vector<std::string> frame_names_;                                    ///< name of the frames
+  state_representation::SharedJointNames joint_frames_;                     ///< shared table of the joint frames
+  std::map<unsigned int, state_representation::ChainJacobian> chain_jacobians_;///< chain-sparse Jacobian of each frame, built at its first computation
+  pinocchio::Data::Matrix6x jacobian_buffer_;                               ///< dense Jacobian filled by pinocchio for the chain-sparse Jacobians
   pinocchio::Model robot_model_;                                            ///< the robot model with pinocchio
   pinocchio::Data robot_data_;                                              ///< the robot data with pinocchio
   OsqpEigen::Solver solver_;                                                ///< osqp solver for the quadratic programming based inverse kinematics
@@ -69,6 +75,15 @@ private:
   Eigen::SparseMatrix<double> constraint_matrix_;                           ///< constraint matrix for the quadratic programming based inverse kinematics
   Eigen::VectorXd lower_bound_constraints_;                                 ///< lower bound matrix for the quadratic programming based inverse kinematics
   Eigen::VectorXd upper_bound_constraints_;                                 ///< upper bound matrix for the quadratic programming based inverse kinematics
+  bool dual_quaternion_kinematics_;                                         ///< true if all the joints are supported by the dual quaternion forward kinematics
+  std::vector<int> joint_parents_;                                          ///< index of the parent of each joint, -1 for the universe
+  std::vector<int> joint_position_indices_;                                 ///< index of the position of each joint in the joint positions
+  std::vector<Eigen::Vector3d> joint_axes_;                                 ///< axis of each joint in its own frame
+  std::vector<bool> prismatic_joints_;                                      ///< true for prismatic joints, false for revolute joints
+  state_representation::DualQuaternionBatch joint_placements_;              ///< placement of each joint in the frame of its parent
+  state_representation::DualQuaternionBatch frame_placements_;              ///< placement of each frame in the frame of its parent joint
+  state_representation::DualQuaternionBatch joint_motions_;                 ///< motion of each joint for the current joint positions
+  state_representation::DualQuaternionBatch joint_transforms_;              ///< transform of each joint for the current joint positions
   // @format:on
   /**
    * @brief Initialize the pinocchio model from the URDF
@@ -80,6 +95,12 @@ private:
    */
   bool init_qp_solver();
 
+  /**
+   * @brief Initialize the joint axes and the placements of the joints and frames as dual quaternions
+   * for the dual quaternion forward kinematics
+   */
+  void init_dual_quaternion_kinematics();
+
   /**
    * @brief Check if frames exist in robot model and return its ids
    * @param frame_names containing the frame names to check
@@ -103,6 +124,15 @@ private:
   state_representation::Jacobian compute_jacobian(const state_representation::JointPositions& joint_positions,
                                                   unsigned int frame_id);
 
+  /**
+   * @brief Compute the chain-sparse Jacobian from given joint positions at the frame in parameter
+   * @param joint_positions containing the joint positions of the robot
+   * @param frame_id id of the frame at which to compute the Jacobian
+   * @return the Jacobian of the joints supporting the frame, cached in the model until the next computation at that frame
+   */
+  const state_representation::ChainJacobian& compute_chain_jacobian(const state_representation::JointPositions& joint_positions,
+                                                                    unsigned int frame_id);
+
   /**
    * @brief Compute the time derivative of the Jacobian from given joint positions and velocities at the frame in parameter
    * @param joint_positions containing the joint positions of the robot
@@ -132,6 +162,17 @@ private:
   state_representation::CartesianPose forward_kinematics(const state_representation::JointPositions& joint_positions,
                                                          unsigned int frame_id);
 
+  /**
+   * @brief Compute the forward kinematics with dual quaternions, i.e. by chaining the joint transforms without
+   * building rotation matrices. Falls back to the matrix forward kinematics if the robot has joints other
+   * than revolute and prismatic joints
+   * @param joint_positions the joint state of the robot
+   * @param frame_ids ids of the frames at which to extract the pose
+   * @return the desired poses
+   */
+  std::vector<state_representation::CartesianPose> forward_kinematics_dual_quaternion(const state_representation::JointPositions& joint_positions,
+                                                                                      const std::vector<unsigned int>& frame_ids);
+
   /**
    * @brief Check if the vector's elements are inside the parameter limits
    * @param vector the vector to check
@@ -285,6 +326,17 @@ public:
   state_representation::Jacobian compute_jacobian(const state_representation::JointPositions& joint_positions,
                                                   const std::string& frame_name = "");
 
+  /**
+   * @brief Compute the chain-sparse Jacobian from a given joint state at the frame given in parameter. Only the
+   * columns of the joints supporting the frame are stored, which is cheaper than the dense Jacobian for frames
+   * of a single chain of robots with many joints (e.g. dual arm, humanoid or mobile manipulators)
+   * @param joint_positions containing the joint positions of the robot
+   * @param frame_name name of the frame at which to compute the Jacobian, if empty computed for the last frame
+   * @return the Jacobian of the joints supporting the frame, cached in the model until the next computation at that frame
+   */
+  const state_representation::ChainJacobian& compute_chain_jacobian(const state_representation::JointPositions& joint_positions,
+                                                                    const std::string& frame_name = "");
+
   /**
    * @brief Compute the time derivative of the Jacobian from given joint positions and velocities at the frame in parameter
    * @param joint_positions containing the joint positions of the robot
@@ -351,6 +403,26 @@ public:
   state_representation::CartesianPose forward_kinematics(const state_representation::JointPositions& joint_positions,
                                                          const std::string& frame_name = "");
 
+  /**
+   * @brief Compute the forward kinematics with dual quaternions, i.e. the pose of certain frames from the joint
+   * positions computed by chaining the joint transforms as dual quaternions without building rotation matrices
+   * @param joint_positions the joint state of the robot
+   * @param frame_names names of the frames at which to extract the poses
+   * @return the pose of desired frames
+   */
+  std::vector<state_representation::CartesianPose> forward_kinematics_dual_quaternion(const state_representation::JointPositions& joint_positions,
+                                                                                      const std::vector<std::string>& frame_names);
+
+  /**
+   * @brief Compute the forward kinematics with dual quaternions, i.e. the pose of the frame from the joint
+   * positions computed by chaining the joint transforms as dual quaternions without building rotation matrices
+   * @param joint_positions the joint state of the robot
+   * @param frame_name name of the frame at which to extract the pose
+   * @return the pose of the desired frame
+   */
+  state_representation::CartesianPose forward_kinematics_dual_quaternion(const state_representation::JointPositions& joint_positions,
+                                                                         const std::string& frame_name = "");
+
   /**
    * @brief Compute the inverse kinematics, i.e. joint positions from the pose of the end-effector in an iterative manner
    * @param cartesian_pose containing the desired pose of the end-effector
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <pinocchio/algorithm/frames.hpp>
 #include <pinocchio/algorithm/joint-configuration.hpp>
+#include <pinocchio/math/quaternion.hpp>
 #include "robot_model/Model.hpp"
 #include "robot_model/exceptions/FrameNotFoundException.hpp"
 #include "robot_model/exceptions/InverseKinematicsNotConvergingException.hpp"
@@ -39,7 +40,12 @@ void Model::init_model() {
   }
   // remove universe and root_joint frame added by Pinocchio
   this->frame_names_ = std::vector<std::string>(frames.begin() + 2, frames.end());
+  // share the joint names with all the Jacobian computed from this model
+  this->joint_frames_ = state_representation::joint_names::intern(this->get_joint_frames());
+  this->chain_jacobians_.clear();
+  this->jacobian_buffer_ = pinocchio::Data::Matrix6x::Zero(6, this->robot_model_.nv);
   this->init_qp_solver();
+  this->init_dual_quaternion_kinematics();
 }
 
 bool Model::init_qp_solver() {
@@ -139,7 +145,7 @@ state_representation::Jacobian Model::compute_jacobian(const state_representatio
                                   J);
   // the model does not have any reference frame
   return state_representation::Jacobian(this->get_robot_name(),
-                                        this->get_joint_frames(),
+                                        this->joint_frames_,
                                         this->robot_model_.frames[frame_id].name,
                                         J,
                                         this->get_base_frame());
@@ -151,6 +157,49 @@ state_representation::Jacobian Model::compute_jacobian(const state_representatio
   return this->compute_jacobian(joint_positions, frame_id);
 }
 
+const state_representation::ChainJacobian& Model::compute_chain_jacobian(const state_representation::JointPositions& joint_positions,
+                                                                         unsigned int frame_id) {
+  if (joint_positions.get_size() != this->get_number_of_joints()) {
+    throw (exceptions::InvalidJointStateSizeException(joint_positions.get_size(), this->get_number_of_joints()));
+  }
+  auto chain = this->chain_jacobians_.find(frame_id);
+  if (chain == this->chain_jacobians_.end()) {
+    // the columns of the chain are the velocity indices of the joints supporting the frame, the universe excluded
+    std::vector<unsigned int> columns;
+    for (auto joint_id : this->robot_model_.supports[this->robot_model_.frames[frame_id].parent]) {
+      if (joint_id == 0) {
+        continue;
+      }
+      const auto& joint = this->robot_model_.joints[joint_id];
+      for (int i = 0; i < joint.nv(); ++i) {
+        columns.push_back(joint.idx_v() + i);
+      }
+    }
+    chain = this->chain_jacobians_.emplace(frame_id,
+                                           state_representation::ChainJacobian(this->get_robot_name(),
+                                                                               this->joint_frames_,
+                                                                               columns,
+                                                                               this->robot_model_.frames[frame_id].name,
+                                                                               this->get_base_frame())).first;
+  }
+  // pinocchio fills the columns of the supporting joints, which are the only ones gathered in the block of the chain,
+  // such that the other columns of the shared buffer do not need to be cleared
+  pinocchio::computeFrameJacobian(this->robot_model_,
+                                  this->robot_data_,
+                                  joint_positions.data(),
+                                  frame_id,
+                                  pinocchio::LOCAL_WORLD_ALIGNED,
+                                  this->jacobian_buffer_);
+  chain->second.set_data(this->jacobian_buffer_);
+  return chain->second;
+}
+
+const state_representation::ChainJacobian& Model::compute_chain_jacobian(const state_representation::JointPositions& joint_positions,
+                                                                         const std::string& frame_name) {
+  auto frame_id = get_frame_id(frame_name);
+  return this->compute_chain_jacobian(joint_positions, frame_id);
+}
+
 Eigen::MatrixXd Model::compute_jacobian_time_derivative(const state_representation::JointPositions& joint_positions,
                                                         const state_representation::JointVelocities& joint_velocities,
                                                         unsigned int frame_id) {
@@ -194,7 +243,7 @@ Eigen::MatrixXd Model::compute_inertia_matrix(const state_representation::JointP
 state_representation::JointTorques Model::compute_inertia_torques(const state_representation::JointState& joint_state) {
   Eigen::MatrixXd inertia = this->compute_inertia_matrix(joint_state);
   return state_representation::JointTorques(joint_state.get_name(),
-                                            joint_state.get_names(),
+                                            joint_state.get_shared_names(),
                                             inertia * joint_state.get_accelerations());
 }
 
@@ -209,7 +258,7 @@ state_representation::JointTorques
 Model::compute_coriolis_torques(const state_representation::JointState& joint_state) {
   Eigen::MatrixXd coriolis_matrix = this->compute_coriolis_matrix(joint_state);
   return state_representation::JointTorques(joint_state.get_name(),
-                                            joint_state.get_names(),
+                                            joint_state.get_shared_names(),
                                             coriolis_matrix * joint_state.get_velocities());
 }
 
@@ -217,7 +266,7 @@ state_representation::JointTorques
 Model::compute_gravity_torques(const state_representation::JointPositions& joint_positions) {
   Eigen::VectorXd gravity_torque =
       pinocchio::computeGeneralizedGravity(this->robot_model_, this->robot_data_, joint_positions.data());
-  return state_representation::JointTorques(joint_positions.get_name(), joint_positions.get_names(), gravity_torque);
+  return state_representation::JointTorques(joint_positions.get_name(), joint_positions.get_shared_names(), gravity_torque);
 }
 
 state_representation::CartesianPose Model::forward_kinematics(const state_representation::JointPositions& joint_positions,
@@ -250,6 +299,97 @@ std::vector<state_representation::CartesianPose> Model::forward_kinematics(const
   return pose_vector;
 }
 
+void Model::init_dual_quaternion_kinematics() {
+  auto nb_joints = static_cast<std::size_t>(this->robot_model_.njoints);
+  this->dual_quaternion_kinematics_ = true;
+  this->joint_parents_.assign(nb_joints, -1);
+  this->joint_position_indices_.assign(nb_joints, -1);
+  this->joint_axes_.assign(nb_joints, Eigen::Vector3d::Zero());
+  this->prismatic_joints_.assign(nb_joints, false);
+  this->joint_placements_ = state_representation::DualQuaternionBatch(nb_joints);
+  this->joint_motions_ = state_representation::DualQuaternionBatch(nb_joints);
+  this->joint_transforms_ = state_representation::DualQuaternionBatch(nb_joints);
+  // the axis of each joint is given by its motion subspace, which is constant for revolute and prismatic joints
+  pinocchio::forwardKinematics(this->robot_model_, this->robot_data_, pinocchio::neutral(this->robot_model_));
+  Eigen::Quaterniond quaternion;
+  for (std::size_t i = 1; i < nb_joints; ++i) {
+    const pinocchio::SE3& placement = this->robot_model_.jointPlacements[i];
+    pinocchio::quaternion::assignQuaternion(quaternion, placement.rotation());
+    this->joint_placements_.set(i, placement.translation(), quaternion);
+    this->joint_parents_[i] = static_cast<int>(this->robot_model_.parents[i]);
+    const auto& joint = this->robot_model_.joints[i];
+    if (joint.nq() != 1 || joint.nv() != 1) {
+      this->dual_quaternion_kinematics_ = false;
+      continue;
+    }
+    this->joint_position_indices_[i] = joint.idx_q();
+    Eigen::Matrix<double, 6, 1> subspace = this->robot_data_.joints[i].S().matrix();
+    if (subspace.tail<3>().isZero()) {
+      this->prismatic_joints_[i] = true;
+      this->joint_axes_[i] = subspace.head<3>();
+    } else if (subspace.head<3>().isZero()) {
+      this->joint_axes_[i] = subspace.tail<3>();
+    } else {
+      this->dual_quaternion_kinematics_ = false;
+    }
+  }
+  this->frame_placements_ = state_representation::DualQuaternionBatch(this->robot_model_.frames.size());
+  for (std::size_t i = 0; i < this->robot_model_.frames.size(); ++i) {
+    const pinocchio::SE3& placement = this->robot_model_.frames[i].placement;
+    pinocchio::quaternion::assignQuaternion(quaternion, placement.rotation());
+    this->frame_placements_.set(i, placement.translation(), quaternion);
+  }
+}
+
+std::vector<state_representation::CartesianPose>
+Model::forward_kinematics_dual_quaternion(const state_representation::JointPositions& joint_positions,
+                                          const std::vector<unsigned int>& frame_ids) {
+  if (joint_positions.get_size() != this->get_number_of_joints()) {
+    throw (exceptions::InvalidJointStateSizeException(joint_positions.get_size(), this->get_number_of_joints()));
+  }
+  if (!this->dual_quaternion_kinematics_) {
+    return this->forward_kinematics(joint_positions, frame_ids);
+  }
+  // motion of each joint, a rotation or a translation along its axis
+  const Eigen::VectorXd& positions = joint_positions.get_positions();
+  for (std::size_t i = 1; i < this->joint_axes_.size(); ++i) {
+    this->joint_motions_.set_joint_motion(i, this->joint_axes_[i], positions(this->joint_position_indices_[i]),
+                                          this->prismatic_joints_[i]);
+  }
+  // transform of each joint in the frame of its parent, then chained from the root of the tree
+  state_representation::DualQuaternionBatch::multiply(this->joint_placements_, this->joint_motions_,
+                                                      this->joint_transforms_);
+  state_representation::DualQuaternionBatch::chain(this->joint_transforms_, this->joint_parents_,
+                                                   this->joint_transforms_);
+  std::vector<state_representation::CartesianPose> pose_vector;
+  for (unsigned int id : frame_ids) {
+    if (id >= static_cast<unsigned int>(this->robot_model_.nframes)) {
+      throw (exceptions::FrameNotFoundException(std::to_string(id)));
+    }
+    auto joint_id = this->robot_model_.frames[id].parent;
+    Eigen::Quaterniond joint_orientation = this->joint_transforms_.get_primary(joint_id);
+    Eigen::Vector3d translation =
+        this->joint_transforms_.get_position(joint_id) + joint_orientation * this->frame_placements_.get_position(id);
+    Eigen::Quaterniond quaternion = joint_orientation * this->frame_placements_.get_primary(id);
+    pose_vector.emplace_back(this->robot_model_.frames[id].name, translation, quaternion, this->get_base_frame());
+  }
+  return pose_vector;
+}
+
+state_representation::CartesianPose
+Model::forward_kinematics_dual_quaternion(const state_representation::JointPositions& joint_positions,
+                                          const std::string& frame_name) {
+  std::string actual_frame_name = frame_name.empty() ? this->robot_model_.frames.back().name : frame_name;
+  return this->forward_kinematics_dual_quaternion(joint_positions, std::vector<std::string>{actual_frame_name}).front();
+}
+
+std::vector<state_representation::CartesianPose>
+Model::forward_kinematics_dual_quaternion(const state_representation::JointPositions& joint_positions,
+                                          const std::vector<std::string>& frame_names) {
+  auto frame_ids = get_frame_ids(frame_names);
+  return this->forward_kinematics_dual_quaternion(joint_positions, frame_ids);
+}
+
 state_representation::CartesianPose Model::forward_kinematics(const state_representation::JointPositions& joint_positions,
                                                               const std::string& frame_name) {
   std::string actual_frame_name = frame_name.empty() ? this->robot_model_.frames.back().name : frame_name;
@@ -413,7 +553,7 @@ Model::inverse_velocity(const std::vector<state_representation::CartesianTwist>&
 
   // solve a linear system
   return state_representation::JointVelocities(joint_positions.get_name(),
-                                               joint_positions.get_names(),
+                                               joint_positions.get_shared_names(),
                                                jacobian.colPivHouseholderQr().solve(dX));
 }
 
@@ -490,7 +630,7 @@ Model::inverse_velocity(const std::vector<state_representation::CartesianTwist>&
   this->solver_.solve();
   // extract the solution
   JointPositions joint_displacement(joint_positions.get_name(),
-                                    joint_positions.get_names(),
+                                    joint_positions.get_shared_names(),
                                     this->solver_.getSolution().head(nb_joints));
   double dt = this->solver_.getSolution().tail(1)(0);
   return JointPositions(joint_displacement) / dt;
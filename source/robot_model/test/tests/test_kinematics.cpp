@@ -164,6 +164,23 @@ TEST_F(RobotModelKinematicsTest, TestForwardKinematics) {
   }
 }
 
+TEST_F(RobotModelKinematicsTest, TestForwardKinematicsDualQuaternion) {
+  for (std::size_t config = 0; config < test_configs.size(); ++config) {
+    state_representation::CartesianPose ee_pose = franka->forward_kinematics_dual_quaternion(test_configs[config]);
+    EXPECT_LT(ee_pose.dist(test_fk_ee_expects.at(config)), 1e-3);
+    auto poses = franka->forward_kinematics(test_configs[config], std::vector<std::string>{"panda_link4", "panda_link8"});
+    auto dq_poses = franka->forward_kinematics_dual_quaternion(test_configs[config],
+                                                               std::vector<std::string>{"panda_link4", "panda_link8"});
+    ASSERT_EQ(dq_poses.size(), 2);
+    for (std::size_t i = 0; i < poses.size(); ++i) {
+      EXPECT_EQ(dq_poses[i].get_name(), poses[i].get_name());
+      EXPECT_LT(dq_poses[i].dist(poses[i]), 1e-9);
+    }
+  }
+  EXPECT_THROW(franka->forward_kinematics_dual_quaternion(joint_state, "panda_link99"),
+               exceptions::FrameNotFoundException);
+}
+
 TEST_F(RobotModelKinematicsTest, TestForwardVelocity) {
   for (std::size_t config = 0; config < test_configs.size(); ++config) {
     state_representation::CartesianTwist ee_twist = franka->forward_velocity(test_configs[config]);
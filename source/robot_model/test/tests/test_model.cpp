@@ -76,6 +76,20 @@ TEST_F(RobotModelTest, TestJacobianFrameNames) {
   EXPECT_EQ(jac2.get_frame(), "panda_link2");
 }
 
+TEST_F(RobotModelTest, TestChainJacobian) {
+  state_representation::Jacobian jac = franka->compute_jacobian(joint_state, "panda_link2");
+  state_representation::ChainJacobian chain = franka->compute_chain_jacobian(joint_state, "panda_link2");
+  EXPECT_EQ(chain.get_chain_columns(), std::vector<unsigned int>({0, 1}));
+  EXPECT_EQ(chain.get_frame(), "panda_link2");
+  EXPECT_EQ(chain.get_reference_frame(), "panda_link0");
+  EXPECT_TRUE(chain.to_jacobian().data().isApprox(jac.data()));
+  // the chain of the frame is cached in the model and updated at each computation
+  const state_representation::ChainJacobian& cached = franka->compute_chain_jacobian(joint_state, "panda_link2");
+  EXPECT_EQ(&cached, &franka->compute_chain_jacobian(state_representation::JointState::Random("franka", 7),
+                                                      "panda_link2"));
+  EXPECT_FALSE(cached.get_block().data().isApprox(chain.get_block().data()));
+}
+
 TEST_F(RobotModelTest, TestJacobianInvalidFrameName) {
   EXPECT_THROW(franka->compute_jacobian(joint_state, "panda_link99"), exceptions::FrameNotFoundException);
 }
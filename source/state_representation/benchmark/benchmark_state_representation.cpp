@@ -0,0 +1,239 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "state_representation/MathTools.hpp"
+#include "state_representation/robot/FixedJointState.hpp"
+#include "state_representation/robot/JacobianSolver.hpp"
+#include "state_representation/robot/JointPositions.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
+#include "state_representation/space/cartesian/CartesianStateSlice.hpp"
+#include "state_representation/space/dual_quaternion/DualQuaternionBatch.hpp"
+#include "state_representation/units/Velocity.hpp"
+
+using namespace state_representation;
+using namespace state_representation::units;
+
+namespace {
+/**
+ * @brief Time a function over a number of iterations after a warm up, and print its mean time per iteration
+ * @param name the name of the benchmark
+ * @param function the function to time
+ * @param iterations the number of iterations
+ */
+template<typename FunctionT>
+void run(const std::string& name, FunctionT&& function, std::size_t iterations = 1000000) {
+  for (std::size_t i = 0; i < iterations / 10; ++i) {
+    function();
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < iterations; ++i) {
+    function();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  std::cout << std::left << std::setw(72) << name << std::right << std::setw(10) << std::fixed
+            << std::setprecision(2) << elapsed.count() / static_cast<double>(iterations) << " ns" << std::endl;
+}
+
+/**
+ * @brief Time the sum of two joint states of N joints, with the dynamically sized and the fixed size states
+ * @param checksum the checksum accumulating the results
+ */
+template<int N>
+void run_joint_states(double& checksum) {
+  JointState state = JointState::Random("robot", N);
+  JointState increment = JointState::Random("robot", N);
+  JointState sum = state;
+  run("JointState with " + std::to_string(N) + " joints, sum = state + increment", [&] {
+    sum = state + increment;
+    checksum += sum.get_positions()(0);
+  });
+  FixedJointState<N> fixed_state = FixedJointState<N>::Random("robot");
+  FixedJointState<N> fixed_increment = FixedJointState<N>::Random("robot");
+  FixedJointState<N> fixed_sum = fixed_state;
+  run("FixedJointState<" + std::to_string(N) + ">, sum = state + increment", [&] {
+    fixed_sum = fixed_state + fixed_increment;
+    checksum += fixed_sum.get_positions()(0);
+  });
+}
+}// namespace
+
+int main() {
+  // the results are accumulated in a checksum printed at the end, such that the computations are kept
+  double checksum = 0;
+  double x = 0;
+
+  // the typed setters forward to the Eigen setters, both lines being expected to take the same time
+  CartesianState state = CartesianState::Identity("robot");
+  run("CartesianState::set_position(Eigen::Vector3d)", [&] {
+    x += 1e-9;
+    state.set_position(Eigen::Vector3d(x, 1, 0.005));
+  });
+  checksum += state.get_position().sum();
+  run("CartesianState::set_position(Distance, Distance, Distance)", [&] {
+    x += 1e-9;
+    state.set_position(Distance(x), 1.0_m, 5.0_mm);
+  });
+  checksum += state.get_position().sum();
+  run("CartesianState::set_linear_velocity(Eigen::Vector3d)", [&] {
+    x += 1e-9;
+    state.set_linear_velocity(Eigen::Vector3d(x, 0, -1));
+  });
+  checksum += state.get_linear_velocity().sum();
+  run("CartesianState::set_linear_velocity(LinearVelocity, ...)", [&] {
+    x += 1e-9;
+    state.set_linear_velocity(LinearVelocity(x), 0.0_m_s, -1.0_m_s);
+  });
+  checksum += state.get_linear_velocity().sum();
+  JointPositions joints("robot", 7);
+  Eigen::VectorXd positions = Eigen::VectorXd::Zero(7);
+  run("JointPositions::set_positions(Eigen::VectorXd)", [&] {
+    positions(1) += 1e-9;
+    joints.set_positions(positions);
+  });
+  checksum += joints.get_positions().sum();
+  run("JointPositions::set_position(Angle, unsigned int)", [&] {
+    x += 1e-9;
+    joints.set_position(Angle(x), 1);
+  });
+  checksum += joints.get_positions().sum();
+
+  // reading the twist of a full state, by copy into a CartesianTwist or in place through a slice
+  CartesianState feedback = CartesianState::Random("robot");
+  run("CartesianTwist(state).get_linear_velocity()", [&] {
+    checksum += CartesianTwist(feedback).get_linear_velocity()(0);
+  });
+  run("CartesianTwistSlice(state).get_linear_velocity()", [&] {
+    checksum += CartesianTwistSlice(feedback).get_linear_velocity()(0);
+  });
+
+  // the dynamically sized and fixed size joint states
+  run_joint_states<6>(checksum);
+  run_joint_states<7>(checksum);
+  run_joint_states<12>(checksum);
+
+  // the timestamp policies, the cycle policy reading the clock once per cycle instead of once per modification
+  for (auto policy : {TimestampPolicy::EAGER, TimestampPolicy::CYCLE}) {
+    State::set_timestamp_policy(policy);
+    State::start_cycle();
+    run(policy == TimestampPolicy::EAGER ? "set_position with the EAGER timestamp policy"
+                                         : "set_position with the CYCLE timestamp policy", [&] {
+      x += 1e-9;
+      state.set_position(x, 0, 0);
+    });
+    checksum += state.get_position().sum();
+  }
+  State::set_timestamp_policy(TimestampPolicy::EAGER);
+
+  // the scalar and batched quaternion kernels
+  const Eigen::Index batch_size = 1000;
+  Eigen::Matrix<double, Eigen::Dynamic, 4> quaternions(batch_size, 4);
+  for (Eigen::Index i = 0; i < batch_size; ++i) {
+    Eigen::Quaterniond q = Eigen::Quaterniond::UnitRandom();
+    quaternions.row(i) << q.w(), q.x(), q.y(), q.z();
+  }
+  Eigen::Matrix<double, Eigen::Dynamic, 3> logs;
+  Eigen::Index index = 0;
+  run("math_tools::log(Eigen::Quaterniond)", [&] {
+    index = (index + 1) % batch_size;
+    auto row = quaternions.row(index);
+    checksum += math_tools::log(Eigen::Quaterniond(row(0), row(1), row(2), row(3))).x();
+  });
+  run("math_tools::log(Eigen::Matrix<double, Eigen::Dynamic, 4>) of 1000 rows", [&] {
+    math_tools::log(quaternions, logs);
+    checksum += logs(0, 0);
+  }, 1000000 / batch_size);
+
+  // the pseudoinverse, a solve and the null space projector of a Jacobian, factorizing it at each call with the
+  // Jacobian methods or once per update with the solver, and the repeated solves on a cached factorization
+  Jacobian jacobian = Jacobian::Random("robot", 7, "ee");
+  CartesianTwist twist = CartesianTwist::Random("ee");
+  Eigen::MatrixXd identity = Eigen::MatrixXd::Identity(7, 7);
+  run("Jacobian::pseudoinverse, solve and null space projector", [&] {
+    Jacobian pseudoinverse = jacobian.pseudoinverse();
+    JointVelocities velocities = jacobian.solve(twist);
+    Eigen::MatrixXd projector = identity - pseudoinverse.data() * jacobian.data();
+    checksum += velocities.get_velocities()(0) + projector(0, 0);
+  }, 100000);
+  for (auto method : {JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION,
+                      JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION,
+                      JacobianSolverMethod::DAMPED_LEAST_SQUARES}) {
+    JacobianSolver solver(method, method == JacobianSolverMethod::DAMPED_LEAST_SQUARES ? 1e-2 : 0.);
+    std::string method_name = method == JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION ? "COD"
+        : method == JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION ? "SVD" : "LDLT";
+    run("JacobianSolver (" + method_name + "): compute, pseudoinverse, solve and projector", [&] {
+      solver.compute(jacobian);
+      const Eigen::MatrixXd& pseudoinverse = solver.pseudoinverse_matrix();
+      JointVelocities velocities = solver.solve(twist);
+      Eigen::MatrixXd projector = solver.null_space_projector();
+      checksum += pseudoinverse(0, 0) + velocities.get_velocities()(0) + projector(0, 0);
+    }, 100000);
+  }
+  Eigen::VectorXd rhs = twist.data();
+  Eigen::VectorXd solution(7);
+  run("Jacobian::solve(Eigen::MatrixXd)", [&] {
+    rhs(0) += 1e-9;
+    checksum += jacobian.solve(rhs)(0);
+  }, 100000);
+  JacobianSolver solver(jacobian);
+  run("JacobianSolver::solve(VectorXd, VectorXd&) with a cached factorization", [&] {
+    rhs(0) += 1e-9;
+    solver.solve(rhs, solution);
+    checksum += solution(0);
+  });
+
+  // the forward kinematics of a 7-joint revolute chain, with dual quaternions as in robot_model::Model or with the
+  // composition of rigid transformations holding rotation matrices
+  const std::size_t nb_links = 7;
+  std::vector<Eigen::Isometry3d> placements(nb_links);
+  std::vector<Eigen::Vector3d> axes(nb_links);
+  std::vector<int> parents(nb_links);
+  DualQuaternionBatch joint_placements(nb_links);
+  for (std::size_t i = 0; i < nb_links; ++i) {
+    Eigen::Quaterniond orientation = Eigen::Quaterniond::UnitRandom();
+    Eigen::Vector3d position = Eigen::Vector3d::Random();
+    placements[i] = Eigen::Translation3d(position) * orientation;
+    joint_placements.set(i, position, orientation);
+    axes[i] = Eigen::Vector3d::Random().normalized();
+    parents[i] = static_cast<int>(i) - 1;
+  }
+  Eigen::VectorXd joint_positions = Eigen::VectorXd::Random(nb_links);
+  std::vector<Eigen::Isometry3d> transforms(nb_links);
+  auto isometry_kinematics = [&] {
+    Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+    for (std::size_t i = 0; i < nb_links; ++i) {
+      transform = transform * placements[i] * Eigen::AngleAxisd(joint_positions(i), axes[i]);
+      transforms[i] = transform;
+    }
+  };
+  DualQuaternionBatch joint_motions(nb_links);
+  DualQuaternionBatch joint_transforms(nb_links);
+  auto dual_quaternion_kinematics = [&] {
+    for (std::size_t i = 0; i < nb_links; ++i) {
+      joint_motions.set_joint_motion(i, axes[i], joint_positions(i), false);
+    }
+    DualQuaternionBatch::multiply(joint_placements, joint_motions, joint_transforms);
+    DualQuaternionBatch::chain(joint_transforms, parents, joint_transforms);
+  };
+  run("forward kinematics of 7 joints with Eigen::Isometry3d", [&] {
+    joint_positions(0) += 1e-9;
+    isometry_kinematics();
+    checksum += transforms.back().translation()(0);
+  });
+  run("forward kinematics of 7 joints with DualQuaternionBatch", [&] {
+    joint_positions(0) += 1e-9;
+    dual_quaternion_kinematics();
+    checksum += joint_transforms.get_position(nb_links - 1)(0);
+  });
+  // both paths compute the same transformations
+  isometry_kinematics();
+  dual_quaternion_kinematics();
+  std::cout << "position difference of the last link between the two paths " << std::scientific
+            << (transforms.back().translation() - joint_transforms.get_position(nb_links - 1)).norm() << std::fixed
+            << std::endl;
+
+  std::cout << "checksum " << checksum << std::endl;
+  return 0;
+}
@@ -4,6 +4,12 @@
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/Dense>
 
+/**
+ * The quaternion functions share branch free kernels with polynomial approximations of atan2, sin and cos
+ * (coefficients of fdlibm), such that the batched variants over quaternions stored as the rows (w, x, y, z)
+ * of a matrix can be vectorized by the compiler. The absolute error of the approximations is below 5e-16 for
+ * atan2 and 3e-16 for sin and cos for angles of magnitude up to 1e5.
+ */
 namespace state_representation::math_tools {
 /**
  * @brief Calculate the log of a quaternion as a non-unit quaternion
@@ -19,6 +25,62 @@ const Eigen::Quaterniond log(const Eigen::Quaterniond& q);
  */
 const Eigen::Quaterniond exp(const Eigen::Quaterniond& q, double lambda = 1);
 
+/**
+ * @brief Calculate the angular distance between the rotations of two unit quaternions
+ * @param q1 the first quaternion
+ * @param q2 the second quaternion
+ * @return the angle of the rotation from q1 to q2 in [0, pi]
+ */
+double distance(const Eigen::Quaterniond& q1, const Eigen::Quaterniond& q2);
+
+/**
+ * @brief Calculate the logs of unit quaternions
+ * @param quaternions the quaternions, one (w, x, y, z) row per quaternion
+ * @param result the vector parts of the logs, one row per quaternion, resized if needed
+ */
+void log(const Eigen::Matrix<double, Eigen::Dynamic, 4>& quaternions,
+         Eigen::Matrix<double, Eigen::Dynamic, 3>& result);
+
+/**
+ * @brief Calculate the exps of the vector parts of pure quaternions
+ * @param vectors the vector parts, one row per quaternion
+ * @param lambda the scaling factor of the vectors
+ * @param result the unit quaternions, one (w, x, y, z) row per quaternion, resized if needed
+ */
+void exp(const Eigen::Matrix<double, Eigen::Dynamic, 3>& vectors, double lambda,
+         Eigen::Matrix<double, Eigen::Dynamic, 4>& result);
+
+/**
+ * @brief Calculate the products of quaternions, row by row
+ * @param lhs the left-hand side quaternions, one (w, x, y, z) row per quaternion
+ * @param rhs the right-hand side quaternions, one (w, x, y, z) row per quaternion
+ * @param result the products lhs[i] * rhs[i], resized if needed, which can alias the operands
+ */
+void multiply(const Eigen::Matrix<double, Eigen::Dynamic, 4>& lhs,
+              const Eigen::Matrix<double, Eigen::Dynamic, 4>& rhs,
+              Eigen::Matrix<double, Eigen::Dynamic, 4>& result);
+
+/**
+ * @brief Calculate the spherical linear interpolations between unit quaternions along the shortest path, row by row
+ * @param start the start quaternions, one (w, x, y, z) row per quaternion
+ * @param end the end quaternions, one (w, x, y, z) row per quaternion
+ * @param t the interpolation parameter between 0 (start) and 1 (end)
+ * @param result the interpolated quaternions, resized if needed, which can alias the operands
+ */
+void slerp(const Eigen::Matrix<double, Eigen::Dynamic, 4>& start,
+           const Eigen::Matrix<double, Eigen::Dynamic, 4>& end,
+           double t, Eigen::Matrix<double, Eigen::Dynamic, 4>& result);
+
+/**
+ * @brief Calculate the angular distances between the rotations of unit quaternions, row by row
+ * @param lhs the first quaternions, one (w, x, y, z) row per quaternion
+ * @param rhs the second quaternions, one (w, x, y, z) row per quaternion
+ * @param result the angles in [0, pi], resized if needed
+ */
+void distance(const Eigen::Matrix<double, Eigen::Dynamic, 4>& lhs,
+              const Eigen::Matrix<double, Eigen::Dynamic, 4>& rhs,
+              Eigen::VectorXd& result);
+
 /**
  * @brief Create a vector values from start to end
  * @param start the starting value
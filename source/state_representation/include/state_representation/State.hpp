@@ -6,11 +6,14 @@
 #pragma once
 
 #include "state_representation/MathTools.hpp"
+#include "state_representation/time/Clock.hpp"
 #include <assert.h>
+#include <atomic>
 #include <chrono>
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/Dense>
 #include <iostream>
+#include <memory>
 #include <typeinfo>
 
 namespace state_representation {
@@ -35,9 +38,34 @@ enum class StateType {
   PARAMETER_JOINTPOSITIONS,
   PARAMETER_ELLIPSOID,
   PARAMETER_MATRIX,
-  PARAMETER_VECTOR
+  PARAMETER_VECTOR,
+  FIXEDJOINTSTATE
 };
 
+/**
+ * @brief Policy of the timestamps of the states, set per thread
+ * @details With the EAGER policy, each modification of a state reads the clock of the states. With the EXPLICIT policy,
+ * the timestamps only change with reset_timestamp. With the CYCLE policy, the modifications take the cycle time
+ * set once per control tick with State::start_cycle or State::set_cycle_time, such that the clock is read once
+ * per tick whatever the number of state updates. Until the first cycle, the CYCLE policy reads the clock as the
+ * EAGER one. New states are stamped with the current time under all the policies.
+ */
+enum class TimestampPolicy {
+  EAGER,
+  EXPLICIT,
+  CYCLE
+};
+
+/**
+ * @brief False if the operations between states skip the validation of their operands (empty states, incompatible
+ * names or reference frames), which is the case in release builds with the UNCHECKED_OPERATIONS option
+ */
+#if defined(STATE_REPRESENTATION_UNCHECKED_OPERATIONS) && defined(NDEBUG)
+constexpr bool CHECKED_OPERATIONS = false;
+#else
+constexpr bool CHECKED_OPERATIONS = true;
+#endif
+
 /**
  * @class State
  * @brief Abstract class to represent a state
@@ -49,6 +77,18 @@ private:
   bool empty_;                                                  ///< indicate if the state is empty
   std::chrono::time_point<std::chrono::steady_clock> timestamp_;///< time since last modification made to the state
 
+  static std::atomic<Clock*> clock_; ///< clock of the timestamps of all the states, null for the steady clock
+  static thread_local TimestampPolicy timestamp_policy_; ///< timestamp policy of the thread
+  static thread_local std::chrono::time_point<std::chrono::steady_clock> cycle_time_; ///< cycle time of the thread
+
+  /**
+   * @brief Timestamp of a modification following the timestamp policy of the thread
+   * @param previous the timestamp kept with the explicit policy
+   * @return the new timestamp
+   */
+  static std::chrono::time_point<std::chrono::steady_clock>
+  policy_timestamp(const std::chrono::time_point<std::chrono::steady_clock>& previous);
+
 public:
   /**
    * @brief Empty constructor
@@ -116,10 +156,58 @@ public:
   const std::chrono::time_point<std::chrono::steady_clock>& get_timestamp() const;
 
   /**
-   * @brief Reset the timestamp attribute to now
+   * @brief Reset the timestamp attribute to the current time of the clock of the states
    */
   void reset_timestamp();
 
+  /**
+   * @brief Getter of the clock of the timestamps of all the states
+   */
+  static std::shared_ptr<Clock> get_clock();
+
+  /**
+   * @brief Setter of the clock of the timestamps of all the states, e.g. a SimulatedClock to run a control stack
+   * faster than real time. The clock is shared by all the threads and can be replaced while they use the states,
+   * the clocks that were set being kept alive until the end of the program such that a thread never reads a
+   * replaced clock after its destruction. The steady clock is read directly, without virtual call.
+   * @param clock the clock, or null to use the steady clock
+   */
+  static void set_clock(const std::shared_ptr<Clock>& clock);
+
+  /**
+   * @brief Get the current time of the clock of the states
+   */
+  static Clock::time_point now();
+
+  /**
+   * @brief Getter of the timestamp policy of the calling thread
+   */
+  static TimestampPolicy get_timestamp_policy();
+
+  /**
+   * @brief Setter of the timestamp policy of the calling thread
+   * @param policy the timestamp policy
+   */
+  static void set_timestamp_policy(TimestampPolicy policy);
+
+  /**
+   * @brief Getter of the cycle time of the calling thread, used as timestamp with the CYCLE policy
+   */
+  static const std::chrono::time_point<std::chrono::steady_clock>& get_cycle_time();
+
+  /**
+   * @brief Setter of the cycle time of the calling thread, used as timestamp with the CYCLE policy
+   * @param cycle_time the time of the current control tick
+   */
+  static void set_cycle_time(const std::chrono::time_point<std::chrono::steady_clock>& cycle_time);
+
+  /**
+   * @brief Set the cycle time of the calling thread to the current time of the clock of the states, to be called
+   * once at the start of each control tick
+   * @return the new cycle time
+   */
+  static const std::chrono::time_point<std::chrono::steady_clock>& start_cycle();
+
   /**
    * @brief Getter of the name as const reference
    */
@@ -131,7 +219,7 @@ public:
   virtual void set_name(const std::string& name);
 
   /**
-   * @brief Check if the state is deprecated given a certain time delay
+   * @brief Check if the state is deprecated given a certain time delay, measured with the clock of the states
    * @param time_delay the time after which to consider the state as deprecated
    */
   template <typename DurationT>
@@ -184,7 +272,7 @@ inline void State::set_empty(bool empty) {
 
 inline void State::set_filled() {
   this->empty_ = false;
-  this->reset_timestamp();
+  this->timestamp_ = policy_timestamp(this->timestamp_);
 }
 
 inline const std::chrono::time_point<std::chrono::steady_clock>& State::get_timestamp() const {
@@ -192,12 +280,53 @@ inline const std::chrono::time_point<std::chrono::steady_clock>& State::get_time
 }
 
 inline void State::reset_timestamp() {
-  this->timestamp_ = std::chrono::steady_clock::now();
+  this->timestamp_ = now();
+}
+
+inline std::chrono::time_point<std::chrono::steady_clock>
+State::policy_timestamp(const std::chrono::time_point<std::chrono::steady_clock>& previous) {
+  switch (timestamp_policy_) {
+    case TimestampPolicy::EXPLICIT:
+      return previous;
+    case TimestampPolicy::CYCLE:
+      if (cycle_time_ != std::chrono::time_point<std::chrono::steady_clock>()) {
+        return cycle_time_;
+      }
+      return now();
+    default:
+      return now();
+  }
+}
+
+inline Clock::time_point State::now() {
+  Clock* clock = clock_.load(std::memory_order_acquire);
+  return clock != nullptr ? clock->now() : std::chrono::steady_clock::now();
+}
+
+inline TimestampPolicy State::get_timestamp_policy() {
+  return timestamp_policy_;
+}
+
+inline void State::set_timestamp_policy(TimestampPolicy policy) {
+  timestamp_policy_ = policy;
+}
+
+inline const std::chrono::time_point<std::chrono::steady_clock>& State::get_cycle_time() {
+  return cycle_time_;
+}
+
+inline void State::set_cycle_time(const std::chrono::time_point<std::chrono::steady_clock>& cycle_time) {
+  cycle_time_ = cycle_time;
+}
+
+inline const std::chrono::time_point<std::chrono::steady_clock>& State::start_cycle() {
+  cycle_time_ = now();
+  return cycle_time_;
 }
 
 template <typename DurationT>
 inline bool State::is_deprecated(const std::chrono::duration<int64_t, DurationT>& time_delay) {
-  return ((std::chrono::steady_clock::now() - this->timestamp_) > time_delay);
+  return ((now() - this->timestamp_) > time_delay);
 }
 
 inline const std::string& State::get_name() const {
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <type_traits>
+#include <variant>
+
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/space/cartesian/CartesianTwist.hpp"
+#include "state_representation/space/cartesian/CartesianWrench.hpp"
+#include "state_representation/robot/JointPositions.hpp"
+#include "state_representation/robot/JointVelocities.hpp"
+#include "state_representation/robot/JointTorques.hpp"
+
+namespace state_representation {
+/**
+ * @brief Value container of any of the Cartesian state types, the dispatch on the actual type being resolved
+ * with std::visit instead of the StateType enumeration and virtual calls
+ */
+using CartesianStateVariant = std::variant<CartesianState, CartesianPose, CartesianTwist, CartesianWrench>;
+
+/**
+ * @brief Value container of any of the joint state types
+ */
+using JointStateVariant = std::variant<JointState, JointPositions, JointVelocities, JointTorques>;
+
+/**
+ * @brief Value container of any of the Cartesian and joint state types
+ */
+using StateVariant = std::variant<CartesianState,
+                                  CartesianPose,
+                                  CartesianTwist,
+                                  CartesianWrench,
+                                  JointState,
+                                  JointPositions,
+                                  JointVelocities,
+                                  JointTorques>;
+
+/**
+ * @brief Visitor built from a set of lambdas, one per type or group of types, for std::visit on a state variant.
+ * A visitor missing one of the types of the variant does not compile.
+ * @code
+ * std::visit(Overloaded{[](const CartesianPose& pose) { ... },
+ *                       [](const CartesianTwist& twist) { ... },
+ *                       [](const auto& other) { ... }}, state);
+ * @endcode
+ */
+template<class... Visitors>
+struct Overloaded : Visitors ... {
+  using Visitors::operator()...;
+};
+
+template<class... Visitors>
+Overloaded(Visitors...) -> Overloaded<Visitors...>;
+
+/**
+ * @brief Check at compile time if a type is one of the types of a variant
+ * @tparam T the type
+ * @tparam Variant the variant
+ */
+template<class T, class Variant>
+struct is_variant_alternative : std::false_type {};
+
+template<class T, class... Types>
+struct is_variant_alternative<T, std::variant<Types...>> : std::disjunction<std::is_same<T, Types>...> {};
+
+template<class T, class Variant>
+inline constexpr bool is_variant_alternative_v = is_variant_alternative<T, Variant>::value;
+
+/**
+ * @brief Get the common part of the state held by a variant, without virtual call nor copy
+ * @param state the variant
+ * @return the state as a reference to its base class
+ */
+template<class... Types>
+inline const State& get_state(const std::variant<Types...>& state) {
+  return std::visit([](const auto& alternative) -> const State& { return alternative; }, state);
+}
+
+/**
+ * @brief Get the state held by a variant as one of its base classes, e.g. a CartesianState for any of the
+ * Cartesian types, without copy. A base class that is not a base of all the types of the variant does not compile.
+ * @tparam BaseT the base class
+ * @param state the variant
+ * @return the state as a reference to the base class
+ */
+template<class BaseT, class... Types>
+inline const BaseT& get_state_as(const std::variant<Types...>& state) {
+  static_assert(std::conjunction_v<std::is_base_of<BaseT, Types>...>,
+                "The type is not a base of all the state types of the variant");
+  return std::visit([](const auto& alternative) -> const BaseT& { return alternative; }, state);
+}
+}// namespace state_representation
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <exception>
+#include <iostream>
+
+namespace state_representation::exceptions {
+class InvalidParameterException : public std::logic_error {
+public:
+  explicit InvalidParameterException(const std::string& msg) : logic_error(msg) {};
+};
+}// namespace state_representation::exceptions
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <vector>
+#include <eigen3/Eigen/Core>
+
+#include "state_representation/geometry/Ellipsoid.hpp"
+
+namespace state_representation {
+/**
+ * @class EllipseFitter
+ * @brief Incremental direct least square fitting of an ellipse on planar points. Each new point updates the
+ * 6x6 scatter matrix of the conic monomials, such that the points do not need to be stored. The fit normalizes
+ * the scatter matrix with the mean and spread of the points and solves the constrained eigenproblem once with
+ * the numerically stable reduced formulation of
+ * Halir, R. and Flusser, J. (1998). "Numerically stable direct least squares fitting of ellipses."
+ * 6th International Conference in Central Europe on Computer Graphics and Visualization.
+ * The result is deterministic and its computation time does not depend on the points. With a forgetting factor
+ * lower than 1, the weight of the previous points decays exponentially at each new point, such that the fit
+ * follows a shape changing over time.
+ */
+class EllipseFitter {
+private:
+  Eigen::Matrix<double, 6, 6> scatter_; ///< scatter matrix of the monomials of the points relative to the origin
+  Eigen::Vector2d origin_;              ///< first point added, to which the others are relative
+  std::size_t nb_points_;               ///< number of points added
+  double forgetting_factor_;            ///< factor applied to the weight of the previous points at each new point
+
+public:
+  /**
+   * @brief Constructor with a forgetting factor
+   * @param forgetting_factor the factor in ]0, 1] applied to the weight of the previous points at each new point
+   */
+  explicit EllipseFitter(double forgetting_factor = 1.);
+
+  /**
+   * @brief Getter of the forgetting factor
+   */
+  double get_forgetting_factor() const;
+
+  /**
+   * @brief Setter of the forgetting factor
+   * @param forgetting_factor the factor in ]0, 1] applied to the weight of the previous points at each new point
+   */
+  void set_forgetting_factor(double forgetting_factor);
+
+  /**
+   * @brief Add a point
+   * @param x the x coordinate of the point
+   * @param y the y coordinate of the point
+   */
+  void add_point(double x, double y);
+
+  /**
+   * @brief Add a point
+   * @param point the point
+   */
+  void add_point(const Eigen::Vector2d& point);
+
+  /**
+   * @brief Add points stored contiguously
+   * @param points the points, one per column
+   */
+  void add_points(const Eigen::Ref<const Eigen::Matrix2Xd>& points);
+
+  /**
+   * @brief Remove all the points
+   */
+  void reset();
+
+  /**
+   * @brief Getter of the number of points added
+   */
+  std::size_t get_number_of_points() const;
+
+  /**
+   * @brief Getter of the total weight of the points, equal to their number without forgetting
+   */
+  double get_weight() const;
+
+  /**
+   * @brief Getter of the mean of the points
+   */
+  Eigen::Vector2d get_mean() const;
+
+  /**
+   * @brief Getter of the standard deviation of the points along the x and y axes
+   */
+  Eigen::Vector2d get_standard_deviation() const;
+
+  /**
+   * @brief Compute the algebraic equation ax2 + bxy + cy2 + dx + ey + f = 0 of the ellipse fitting the points.
+   * Throws a NoSolutionToFitException if the points are not enough or degenerated (e.g. aligned)
+   * @return the coefficients [a, b, c, d, e, f]
+   */
+  std::vector<double> solve() const;
+
+  /**
+   * @brief Compute the algebraic equation ax2 + bxy + cy2 + dx + ey + f = 0 of the ellipse fitting the points,
+   * without throwing if there is no solution, e.g. at each new point of a stream
+   * @param coefficients the coefficients [a, b, c, d, e, f], set if there is a solution
+   * @return true if there is a solution
+   */
+  bool solve(std::vector<double>& coefficients) const;
+
+  /**
+   * @brief Compute the ellipse fitting the points, in the xy plane of the reference frame
+   * @param name the name of the ellipse
+   * @param reference_frame the reference frame of the points
+   * @return the ellipse
+   */
+  Ellipsoid fit(const std::string& name, const std::string& reference_frame = "world") const;
+};
+
+inline void EllipseFitter::add_point(const Eigen::Vector2d& point) {
+  this->add_point(point(0), point(1));
+}
+
+inline std::size_t EllipseFitter::get_number_of_points() const {
+  return this->nb_points_;
+}
+
+inline double EllipseFitter::get_weight() const {
+  return this->scatter_(5, 5);
+}
+
+inline double EllipseFitter::get_forgetting_factor() const {
+  return this->forgetting_factor_;
+}
+}// namespace state_representation
@@ -1,10 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <list>
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/Dense>
 #include <eigen3/Eigen/Sparse>
-#include <random>
 #include "state_representation/geometry/Shape.hpp"
 #include "state_representation/space/cartesian/CartesianPose.hpp"
 
@@ -94,16 +95,93 @@ public:
                                                  const std::string& reference_frame = "world");
 
   /**
-   * @brief Fit an ellipsoid on a set of points
+   * @brief Fit an ellipsoid on a set of points in the xy plane of the reference frame
    * This method uses direct least square fitting from
    * Fitzgibbon, A., et al. (1999). "Direct least square fitting of ellipses."
     * IEEE Transactions on pattern analysis and machine intelligence 21(5)
+   * with the numerically stable formulation of Halir and Flusser (1998), see EllipseFitter
+   * @param name the name of the ellipsoid
+   * @param points the points to fit
+   * @param reference_frame the reference frame of the points
+   * @param noise_level the axis lengths of the circle at the mean of the points given if the points are
+   * degenerated such that no ellipse fits them (less than 5 points, points at the same position or aligned)
    */
   static const Ellipsoid fit(const std::string& name,
                              const std::list<CartesianPose>& points,
                              const std::string& reference_frame = "world",
                              double noise_level = 0.01);
 
+  /**
+   * @brief Fit an ellipsoid on a set of points in the xy plane of the reference frame, see EllipseFitter
+   * @param name the name of the ellipsoid
+   * @param points the points to fit, one per column
+   * @param reference_frame the reference frame of the points
+   * @param noise_level the axis lengths of the circle at the mean of the points given if the points are
+   * degenerated such that no ellipse fits them
+   */
+  static const Ellipsoid fit(const std::string& name,
+                             const Eigen::Matrix2Xd& points,
+                             const std::string& reference_frame = "world",
+                             double noise_level = 0.01);
+
+  /**
+   * @brief Fit an ellipsoid on a set of points in 3D. The plane of the ellipse is estimated with a principal
+   * component analysis of the points, which gives the orientation of the center of the ellipsoid, and the
+   * ellipse is fitted on the projection of the points in this plane
+   * @param name the name of the ellipsoid
+   * @param points the points to fit, one per column
+   * @param reference_frame the reference frame of the points
+   * @param noise_level the axis lengths of the circle at the mean of the points given if the points are
+   * degenerated such that no ellipse fits them
+   */
+  static const Ellipsoid fit(const std::string& name,
+                             const Eigen::Matrix3Xd& points,
+                             const std::string& reference_frame = "world",
+                             double noise_level = 0.01);
+
+  /**
+   * @brief Compute the closest point on an ellipse centered at the origin with its axes along x and y, with a
+   * fixed number of iterations on the curvature of the ellipse such that the computation is branch free and
+   * can be vectorized over many ellipses. Valid for points inside and outside the ellipse
+   * @param a the positive axis length along x
+   * @param b the positive axis length along y
+   * @param u the x coordinate of the point
+   * @param v the y coordinate of the point
+   * @param x the x coordinate of the closest point
+   * @param y the y coordinate of the closest point
+   */
+  static void project_on_ellipse(double a, double b, double u, double v, double& x, double& y);
+
+  /**
+   * @brief Compute the closest point on the surface of the ellipsoid. The ellipsoid being defined by two axes
+   * in the xy plane of its rotated center frame, it is considered as extending along the z axis of that frame
+   * @param point the point, expressed in the reference frame of the ellipsoid
+   * @return the closest point, at the same height as the point along the z axis of the ellipsoid
+   */
+  Eigen::Vector3d get_closest_point(const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Compute the signed distance of a point to the surface of the ellipsoid, negative inside
+   * @param point the point, expressed in the reference frame of the ellipsoid
+   * @return the signed distance
+   */
+  double signed_distance(const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Check if a point is inside the ellipsoid
+   * @param point the point, expressed in the reference frame of the ellipsoid
+   * @return true if the point is strictly inside
+   */
+  bool is_inside(const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Compute the outward unit normal of the surface of the ellipsoid at the point closest to a point,
+   * which is the gradient of the signed distance
+   * @param point the point, expressed in the reference frame of the ellipsoid
+   * @return the normal, expressed in the reference frame of the ellipsoid
+   */
+  Eigen::Vector3d get_normal(const Eigen::Vector3d& point) const;
+
   /**
    * @brief Convert the ellipse to an std vector representation of its parameter
    * @return an std vector with [center_position, rotation_angle, axis_lengths]
@@ -179,6 +257,34 @@ inline void Ellipsoid::from_std_vector(const std::vector<double>& parameters) {
   this->set_axis_lengths({parameters[4], parameters[5]});
 }
 
+inline void Ellipsoid::project_on_ellipse(double a, double b, double u, double v, double& x, double& y) {
+  // iterate on the parameter (tx, ty) of the closest point in the first quadrant, approximating the ellipse
+  // locally by its circle of curvature centered at the evolute point (ex, ey)
+  double px = std::abs(u);
+  double py = std::abs(v);
+  double tx = M_SQRT1_2;
+  double ty = M_SQRT1_2;
+  double difference = a * a - b * b;
+  for (int i = 0; i < 6; ++i) {
+    double ex = difference * tx * tx * tx / a;
+    double ey = -difference * ty * ty * ty / b;
+    double rx = a * tx - ex;
+    double ry = b * ty - ey;
+    double qx = px - ex;
+    double qy = py - ey;
+    double r = std::sqrt(rx * rx + ry * ry);
+    double q = std::sqrt(qx * qx + qy * qy);
+    double ratio = q > 0 ? r / q : 0;
+    tx = std::clamp((qx * ratio + ex) / a, 0., 1.);
+    ty = std::clamp((qy * ratio + ey) / b, 0., 1.);
+    double t = std::sqrt(tx * tx + ty * ty);
+    tx = t > 0 ? tx / t : 1.;
+    ty = t > 0 ? ty / t : 0.;
+  }
+  x = std::copysign(a * tx, u);
+  y = std::copysign(b * ty, v);
+}
+
 inline const CartesianPose Ellipsoid::get_rotation() const {
   Eigen::Quaterniond rotation(Eigen::AngleAxisd(this->rotation_angle_, Eigen::Vector3d::UnitZ()));
   return CartesianPose(this->get_center_pose().get_name() + "_rotated",
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory>
+
+#include "state_representation/geometry/EllipseFitter.hpp"
+#include "state_representation/parameters/Parameter.hpp"
+
+namespace state_representation {
+/**
+ * @class EllipsoidEstimator
+ * @brief Online estimation of an elliptic limit cycle from a stream of points, e.g. a live demonstration.
+ * The points are projected in the xy plane of a fixed frame and only the scatter matrix of the fit is kept,
+ * such that the memory is constant and each new point updates the estimate in constant time. The estimate
+ * can be pushed at each update into a bound ellipsoid parameter, e.g. the limit cycle of a Circular
+ * dynamical system obtained from its parameter map, without rebuilding its owner.
+ */
+class EllipsoidEstimator {
+private:
+  CartesianPose plane_;                                    ///< frame in the xy plane of which the points are fitted
+  EllipseFitter fitter_;                                   ///< incremental fit of the projected points
+  Ellipsoid estimate_;                                     ///< last estimate
+  bool has_estimate_;                                      ///< true if an estimate is available
+  std::vector<double> coefficients_;                       ///< algebraic coefficients of the last fit
+  std::shared_ptr<Parameter<Ellipsoid>> bound_parameter_;  ///< parameter receiving the estimates
+
+  /**
+   * @brief Copy the geometry of the last estimate in an ellipsoid, keeping its name and reference frame
+   * @param ellipsoid the ellipsoid to update
+   */
+  void copy_estimate(Ellipsoid& ellipsoid) const;
+
+public:
+  /**
+   * @brief Constructor with the plane of the limit cycle
+   * @param name the name of the estimated ellipsoid
+   * @param plane the frame in the xy plane of which the points are fitted, the points and the estimated
+   * ellipsoid being expressed in its reference frame
+   * @param forgetting_factor the factor in ]0, 1] applied to the weight of the previous points at each new point
+   */
+  explicit EllipsoidEstimator(const std::string& name, const CartesianPose& plane, double forgetting_factor = 1.);
+
+  /**
+   * @brief Getter of the plane of the limit cycle
+   */
+  const CartesianPose& get_plane() const;
+
+  /**
+   * @brief Getter of the incremental fit of the projected points
+   */
+  const EllipseFitter& get_fitter() const;
+
+  /**
+   * @brief Bind an ellipsoid parameter to which the estimate is pushed at each update
+   * @param parameter the parameter, e.g. the limit_cycle parameter of a Circular dynamical system
+   */
+  void bind(const std::shared_ptr<Parameter<Ellipsoid>>& parameter);
+
+  /**
+   * @brief Add a point and update the estimate
+   * @param position the position of the point in the reference frame of the plane
+   * @return true if the estimate was updated, false if the points do not define an ellipse yet
+   */
+  bool add_point(const Eigen::Vector3d& position);
+
+  /**
+   * @brief Add a point and update the estimate
+   * @param point the point, expressed in the reference frame of the plane
+   * @return true if the estimate was updated, false if the points do not define an ellipse yet
+   */
+  bool add_point(const CartesianPose& point);
+
+  /**
+   * @brief Check if an estimate is available
+   */
+  bool has_estimate() const;
+
+  /**
+   * @brief Getter of the last estimate, its center being in the plane with the orientation of the plane
+   */
+  const Ellipsoid& get_estimate() const;
+
+  /**
+   * @brief Remove all the points and the estimate, the bound parameter keeping its last value
+   */
+  void reset();
+};
+
+inline const CartesianPose& EllipsoidEstimator::get_plane() const {
+  return this->plane_;
+}
+
+inline const EllipseFitter& EllipsoidEstimator::get_fitter() const {
+  return this->fitter_;
+}
+
+inline bool EllipsoidEstimator::has_estimate() const {
+  return this->has_estimate_;
+}
+
+inline const Ellipsoid& EllipsoidEstimator::get_estimate() const {
+  return this->estimate_;
+}
+}// namespace state_representation
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <eigen3/Eigen/Geometry>
+
+#include "state_representation/geometry/Ellipsoid.hpp"
+
+namespace state_representation {
+/**
+ * @class ShapeSet
+ * @brief Set of ellipsoids expressed in the same reference frame, stored as a structure of arrays: each of
+ * the parameters (center x, y, z, first axis x, y, z, second axis x, y, z, axis lengths a, b) is a contiguous
+ * column of the data matrix. The queries of a point against all the shapes are plain loops over those columns,
+ * without allocation once the results have the right size, such that the compiler can vectorize them.
+ * As for a single Ellipsoid, each shape extends along the normal of the plane of its axes.
+ * For scenes with many shapes, a bounding volume hierarchy of axis aligned boxes restricts the nearest shape
+ * and proximity queries to the shapes close to the point. Updating a shape refits the boxes of the hierarchy.
+ */
+class ShapeSet {
+private:
+  /**
+   * @brief Node of the bounding volume hierarchy, either a leaf with a range of shapes or an inner node
+   */
+  struct Node {
+    Eigen::AlignedBox3d box; ///< bounding box of the shapes of the node
+    int parent;              ///< index of the parent, or -1 for the root
+    int left;                ///< index of the left child, or -1 for a leaf
+    int right;               ///< index of the right child, or -1 for a leaf
+    std::size_t begin;       ///< first index in the ordering of the shapes of the leaf
+    std::size_t end;         ///< end index in the ordering of the shapes of the leaf
+  };
+
+  std::string reference_frame_;                    ///< reference frame of the shapes and the points
+  std::vector<std::string> names_;                 ///< names of the shapes
+  Eigen::Matrix<double, Eigen::Dynamic, 11> data_; ///< parameters of the shapes, one column per parameter
+  std::vector<Node> nodes_;                        ///< nodes of the hierarchy, the root being the first one
+  std::vector<std::size_t> ordering_;              ///< indices of the shapes ordered by leaf of the hierarchy
+  std::vector<int> leaves_;                        ///< index of the leaf of each shape in the hierarchy
+  bool hierarchy_valid_;                           ///< false if the shapes changed since the hierarchy was built
+
+  /**
+   * @brief Compute the signed distance and the outward normal of a single shape
+   * @param index the index of the shape
+   * @param point the point
+   * @param normal the normal to set
+   * @return the signed distance
+   */
+  double evaluate(Eigen::Index index, const Eigen::Vector3d& point, Eigen::Vector3d& normal) const;
+
+  /**
+   * @brief Check if a single shape contains a point
+   * @param index the index of the shape
+   * @param point the point
+   * @return true if the point is strictly inside the shape
+   */
+  bool is_inside(Eigen::Index index, const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Compute the bounding box of a single shape, unbounded along the directions of its extrusion axis
+   * @param index the index of the shape
+   */
+  Eigen::AlignedBox3d bounding_box(Eigen::Index index) const;
+
+  /**
+   * @brief Recursively build the nodes of the hierarchy for a range of the ordering
+   * @param begin the first index of the range
+   * @param end the end index of the range
+   * @param boxes the bounding boxes of the shapes
+   * @return the index of the node
+   */
+  int build_node(std::size_t begin, std::size_t end, const std::vector<Eigen::AlignedBox3d>& boxes);
+
+  /**
+   * @brief Refit the boxes of the leaf of a shape and of its ancestors to the current shapes
+   * @param index the index of the shape
+   */
+  void refit_hierarchy(std::size_t index);
+
+  /**
+   * @brief Collect the shapes of the leaves of the hierarchy that can be within a distance of a point,
+   * or all the shapes if the hierarchy is not up to date
+   * @param point the point
+   * @param radius the distance
+   * @param candidates the indices of the shapes, in increasing order
+   */
+  void collect_candidates(const Eigen::Vector3d& point, double radius, std::vector<std::size_t>& candidates) const;
+
+public:
+  /**
+   * @brief Constructor of an empty set
+   * @param reference_frame the reference frame of the shapes and the points
+   */
+  explicit ShapeSet(const std::string& reference_frame = "world");
+
+  /**
+   * @brief Getter of the reference frame
+   */
+  const std::string& get_reference_frame() const;
+
+  /**
+   * @brief Getter of the number of shapes
+   */
+  std::size_t get_size() const;
+
+  /**
+   * @brief Getter of the name of a shape
+   * @param index the index of the shape
+   */
+  const std::string& get_name(std::size_t index) const;
+
+  /**
+   * @brief Getter of the data matrix, of size get_size() x 11
+   */
+  const Eigen::Matrix<double, Eigen::Dynamic, 11>& data() const;
+
+  /**
+   * @brief Add an ellipsoid to the set
+   * @param ellipsoid the ellipsoid, expressed in the reference frame of the set with positive axis lengths
+   * @return the index of the shape
+   */
+  std::size_t add(const Ellipsoid& ellipsoid);
+
+  /**
+   * @brief Update a shape of the set, e.g. a moving obstacle. If the hierarchy is built, the boxes containing
+   * the shape are refitted such that the hierarchy stays up to date, though its culling degrades when shapes
+   * move far from their initial neighbors until it is built again
+   * @param index the index of the shape
+   * @param ellipsoid the ellipsoid, expressed in the reference frame of the set with positive axis lengths
+   */
+  void set(std::size_t index, const Ellipsoid& ellipsoid);
+
+  /**
+   * @brief Remove all the shapes
+   */
+  void clear();
+
+  /**
+   * @brief Compute the signed distances of a point to all the shapes, negative inside
+   * @param point the point
+   * @param distances the distances, resized if needed
+   */
+  void signed_distances(const Eigen::Vector3d& point, Eigen::VectorXd& distances) const;
+
+  /**
+   * @brief Compute the signed distances of points to all the shapes, negative inside
+   * @param points the points, one per column
+   * @param distances the distances, one row per shape and one column per point, resized if needed
+   */
+  void signed_distances(const Eigen::Matrix3Xd& points, Eigen::MatrixXd& distances) const;
+
+  /**
+   * @brief Compute the signed distances of a point to all the shapes and the outward normals of the shapes
+   * at the closest points, i.e. the gradients of the distances
+   * @param point the point
+   * @param distances the distances, resized if needed
+   * @param normals the unit normals, one column per shape, resized if needed
+   */
+  void evaluate(const Eigen::Vector3d& point, Eigen::VectorXd& distances, Eigen::Matrix3Xd& normals) const;
+
+  /**
+   * @brief Check which shapes contain points
+   * @param points the points, one per column
+   * @param inside true if the point is strictly inside the shape, one row per shape and one column per point,
+   * resized if needed
+   */
+  void contains(const Eigen::Matrix3Xd& points, Eigen::Array<bool, Eigen::Dynamic, Eigen::Dynamic>& inside) const;
+
+  /**
+   * @brief Check if a point is inside any of the shapes
+   * @param point the point
+   * @return true if the point is strictly inside at least one shape
+   */
+  bool contains_any(const Eigen::Vector3d& point) const;
+
+  /**
+   * @brief Build the bounding volume hierarchy of the shapes, to be called again after adding shapes
+   * for the nearest shape and proximity queries to use it
+   */
+  void build_hierarchy();
+
+  /**
+   * @brief Check if the hierarchy is built and up to date with the shapes
+   */
+  bool has_hierarchy() const;
+
+  /**
+   * @brief Find the shape with the lowest signed distance to a point, using the hierarchy if it is up to date
+   * @param point the point
+   * @param distance the signed distance to the nearest shape
+   * @return the index of the nearest shape, or -1 if the set is empty
+   */
+  int nearest(const Eigen::Vector3d& point, double& distance) const;
+
+  /**
+   * @brief Find the shapes within a distance of a point, using the hierarchy if it is up to date
+   * @param point the point
+   * @param radius the distance
+   * @param indices the indices of the shapes with a signed distance lower than the radius, in increasing order
+   */
+  void query(const Eigen::Vector3d& point, double radius, std::vector<std::size_t>& indices) const;
+
+  /**
+   * @brief Find the shapes within a distance of a point with their signed distances and normals, using the
+   * hierarchy if it is up to date, such that the distant shapes are culled before their evaluation
+   * @param point the point
+   * @param radius the distance
+   * @param indices the indices of the shapes with a signed distance lower than the radius, in increasing order
+   * @param distances the signed distances of those shapes, resized if needed
+   * @param normals the outward unit normals of those shapes, one column per shape, resized if needed
+   */
+  void query(const Eigen::Vector3d& point, double radius, std::vector<std::size_t>& indices,
+             Eigen::VectorXd& distances, Eigen::Matrix3Xd& normals) const;
+};
+
+inline const std::string& ShapeSet::get_reference_frame() const {
+  return this->reference_frame_;
+}
+
+inline std::size_t ShapeSet::get_size() const {
+  return static_cast<std::size_t>(this->data_.rows());
+}
+
+inline const std::string& ShapeSet::get_name(std::size_t index) const {
+  return this->names_.at(index);
+}
+
+inline const Eigen::Matrix<double, Eigen::Dynamic, 11>& ShapeSet::data() const {
+  return this->data_;
+}
+
+inline bool ShapeSet::has_hierarchy() const {
+  return this->hierarchy_valid_;
+}
+}// namespace state_representation
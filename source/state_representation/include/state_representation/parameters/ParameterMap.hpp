@@ -0,0 +1,194 @@
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include "state_representation/exceptions/UnrecognizedParameterTypeException.hpp"
+#include "state_representation/parameters/Parameter.hpp"
+
+namespace state_representation {
+/**
+ * @class ParameterMap
+ * @brief Ordered collection of shared parameters with lookup by name. The parameters are stored once, such that
+ * iterating over them does not allocate, and typed parameters are resolved once at configuration time with
+ * get_parameter<T>, the returned pointer staying valid for the lifetime of the owner of the parameters.
+ * The numeric parameters are also laid out in a flat vector of doubles, to get or set all of them at once:
+ * - double and bool parameters take one element
+ * - std::vector<double> and Eigen::VectorXd parameters take their size
+ * - Eigen::MatrixXd parameters take their number of coefficients, in column-major order
+ * - Cartesian state and pose parameters take the 7 elements of their pose (position and quaternion w, x, y, z)
+ * - joint state and joint positions parameters take their positions
+ * Other parameters (strings, shapes, etc.) have no flat representation. The layout follows the current sizes
+ * of the parameters and is recomputed, without allocation, at each bulk access.
+ */
+class ParameterMap {
+private:
+  /**
+   * @brief Kind of flat representation of a parameter
+   */
+  enum class FlatKind {
+    NONE, DOUBLE, BOOL, DOUBLE_ARRAY, VECTOR, MATRIX, CARTESIAN_STATE, CARTESIAN_POSE, JOINT_STATE, JOINT_POSITIONS
+  };
+
+  std::vector<std::shared_ptr<ParameterInterface>> parameters_; ///< the parameters in insertion order
+  std::map<std::string, std::size_t> indices_;                  ///< indices of the parameters by name
+  std::vector<FlatKind> flat_kinds_;                            ///< kind of flat representation of each parameter
+  mutable std::vector<std::size_t> flat_offsets_;               ///< offset of each parameter in the flat vector
+  mutable std::vector<std::size_t> flat_sizes_;                 ///< size of each parameter in the flat vector
+  mutable std::size_t flat_size_;                               ///< size of the flat vector
+
+  /**
+   * @brief Compute the size of the flat representation of a parameter from its current value
+   * @param index the index of the parameter
+   */
+  std::size_t compute_flat_size(std::size_t index) const;
+
+  /**
+   * @brief Update the offsets and sizes of the flat layout from the current values of the parameters
+   */
+  void update_flat_layout() const;
+
+public:
+  using const_iterator = std::vector<std::shared_ptr<ParameterInterface>>::const_iterator;
+
+  /**
+   * @brief Empty constructor
+   */
+  ParameterMap();
+
+  /**
+   * @brief Constructor from a list of parameters, e.g. the result of get_parameters
+   * @param parameters the list of parameters
+   */
+  explicit ParameterMap(const std::list<std::shared_ptr<ParameterInterface>>& parameters);
+
+  /**
+   * @brief Add a parameter, shared with the caller, at configuration time
+   * @param parameter the parameter, its name has to be unique in the map
+   */
+  void add_parameter(const std::shared_ptr<ParameterInterface>& parameter);
+
+  /**
+   * @brief Getter of the number of parameters
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Check if a parameter exists
+   * @param name the name of the parameter
+   */
+  bool has_parameter(const std::string& name) const;
+
+  /**
+   * @brief Getter of the index of a parameter
+   * @param name the name of the parameter
+   * @return the index of the parameter in the order of insertion
+   */
+  std::size_t get_index(const std::string& name) const;
+
+  /**
+   * @brief Getter of a parameter by index
+   * @param index the index of the parameter
+   */
+  const std::shared_ptr<ParameterInterface>& operator[](std::size_t index) const;
+
+  /**
+   * @brief Getter of a parameter by name
+   * @param name the name of the parameter
+   */
+  const std::shared_ptr<ParameterInterface>& get_parameter(const std::string& name) const;
+
+  /**
+   * @brief Getter of a typed parameter by name, to be resolved once at configuration time
+   * @param name the name of the parameter
+   * @return the parameter, shared with the owner of the map
+   */
+  template<typename T>
+  std::shared_ptr<Parameter<T>> get_parameter(const std::string& name) const;
+
+  /**
+   * @brief Iterator to the first parameter
+   */
+  const_iterator begin() const;
+
+  /**
+   * @brief Iterator past the last parameter
+   */
+  const_iterator end() const;
+
+  /**
+   * @brief Return the parameters as a list, as returned by get_parameters
+   * @return the list of parameters
+   */
+  std::list<std::shared_ptr<ParameterInterface>> to_list() const;
+
+  /**
+   * @brief Getter of the size of the flat vector of the numeric parameters
+   */
+  std::size_t get_flat_size() const;
+
+  /**
+   * @brief Getter of the offset of a parameter in the flat vector
+   * @param index the index of the parameter
+   */
+  std::size_t get_flat_offset(std::size_t index) const;
+
+  /**
+   * @brief Getter of the size of a parameter in the flat vector, 0 if the parameter has no flat representation
+   * @param index the index of the parameter
+   */
+  std::size_t get_flat_size(std::size_t index) const;
+
+  /**
+   * @brief Copy the values of the numeric parameters in a flat buffer
+   * @param buffer the buffer, of size get_flat_size()
+   */
+  void get_flat_values(double* buffer) const;
+
+  /**
+   * @brief Copy the values of the numeric parameters in a flat vector
+   * @return the vector of size get_flat_size()
+   */
+  Eigen::VectorXd get_flat_values() const;
+
+  /**
+   * @brief Set the values of all the numeric parameters from a flat buffer
+   * @param buffer the buffer, of size get_flat_size()
+   */
+  void set_flat_values(const double* buffer);
+
+  /**
+   * @brief Set the values of all the numeric parameters from a flat vector
+   * @param values the vector of size get_flat_size()
+   */
+  void set_flat_values(const Eigen::VectorXd& values);
+};
+
+template<typename T>
+std::shared_ptr<Parameter<T>> ParameterMap::get_parameter(const std::string& name) const {
+  auto parameter = std::dynamic_pointer_cast<Parameter<T>>(this->get_parameter(name));
+  if (parameter == nullptr) {
+    throw exceptions::UnrecognizedParameterTypeException("Parameter " + name + " is not of the requested type");
+  }
+  return parameter;
+}
+
+inline std::size_t ParameterMap::size() const {
+  return this->parameters_.size();
+}
+
+inline const std::shared_ptr<ParameterInterface>& ParameterMap::operator[](std::size_t index) const {
+  return this->parameters_.at(index);
+}
+
+inline ParameterMap::const_iterator ParameterMap::begin() const {
+  return this->parameters_.begin();
+}
+
+inline ParameterMap::const_iterator ParameterMap::end() const {
+  return this->parameters_.end();
+}
+}// namespace state_representation
@@ -0,0 +1,329 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include "state_representation/exceptions/UnrecognizedParameterTypeException.hpp"
+#include "state_representation/parameters/Parameter.hpp"
+
+namespace state_representation {
+/**
+ * @class ParameterSlotInterface
+ * @brief Type erased storage of a parameter in a ParameterRegistry
+ */
+class ParameterSlotInterface {
+private:
+  std::string name_; ///< name of the parameter
+
+public:
+  /**
+   * @brief Constructor with the name of the parameter
+   * @param name the name of the parameter
+   */
+  explicit ParameterSlotInterface(const std::string& name) : name_(name) {}
+
+  virtual ~ParameterSlotInterface() = default;
+
+  /**
+   * @brief Getter of the name of the parameter
+   */
+  const std::string& get_name() const {
+    return this->name_;
+  }
+
+  /**
+   * @brief Make the last published value visible to the reader, wait-free
+   * @return true if a new value was published since the last call
+   */
+  virtual bool latch() = 0;
+
+  /**
+   * @brief Copy the value visible to the reader in a new parameter
+   * @return the parameter
+   */
+  virtual std::shared_ptr<ParameterInterface> to_parameter() const = 0;
+
+  /**
+   * @brief Publish the value of a parameter of the same type
+   * @param parameter the parameter holding the new value
+   */
+  virtual void publish(const ParameterInterface& parameter) = 0;
+};
+
+/**
+ * @class ParameterSlot
+ * @brief Triple buffered storage of a parameter. Writers copy the new value in the back buffer and swap it
+ * atomically with the middle buffer, the reader swaps the middle buffer with the front buffer when a new
+ * value is available. The reader thus never waits nor sees a partially written value, and a value does not
+ * change under the reader between two latches. Writers are serialized by a mutex that the reader never takes.
+ */
+template<typename T>
+class ParameterSlot : public ParameterSlotInterface {
+private:
+  static constexpr uint8_t DIRTY = 0x4;   ///< flag of the middle index indicating a new value
+
+  T buffers_[3];                          ///< the front, middle and back buffers
+  uint8_t front_;                         ///< index of the buffer read by the reader
+  uint8_t back_;                          ///< index of the buffer written by the writers
+  std::atomic<uint8_t> middle_;           ///< index of the buffer exchanged between the writers and the reader
+  std::mutex write_mutex_;                ///< mutex serializing the writers
+
+public:
+  /**
+   * @brief Constructor with the name and initial value of the parameter
+   * @param name the name of the parameter
+   * @param value the initial value of the parameter
+   */
+  ParameterSlot(const std::string& name, const T& value) :
+      ParameterSlotInterface(name), buffers_{value, value, value}, front_(0), back_(2), middle_(1) {}
+
+  /**
+   * @brief Getter of the value visible to the reader, which is only changed by latch
+   */
+  const T& get_value() const {
+    return this->buffers_[this->front_];
+  }
+
+  /**
+   * @brief Publish a new value, to be made visible to the reader at its next latch. Can be called from any thread
+   * @param value the new value
+   */
+  void set_value(const T& value) {
+    std::lock_guard<std::mutex> lock(this->write_mutex_);
+    this->buffers_[this->back_] = value;
+    this->back_ = this->middle_.exchange(this->back_ | DIRTY, std::memory_order_acq_rel) & ~DIRTY;
+  }
+
+  bool latch() override {
+    if (!(this->middle_.load(std::memory_order_relaxed) & DIRTY)) {
+      return false;
+    }
+    this->front_ = this->middle_.exchange(this->front_, std::memory_order_acq_rel) & ~DIRTY;
+    return true;
+  }
+
+  std::shared_ptr<ParameterInterface> to_parameter() const override {
+    return std::make_shared<Parameter<T>>(this->get_name(), this->get_value());
+  }
+
+  void publish(const ParameterInterface& parameter) override {
+    auto typed_parameter = dynamic_cast<const Parameter<T>*>(&parameter);
+    if (typed_parameter == nullptr) {
+      throw exceptions::UnrecognizedParameterTypeException(
+          "Parameter " + parameter.get_name() + " does not have the type of the registered parameter");
+    }
+    this->set_value(typed_parameter->get_value());
+  }
+};
+
+/**
+ * @class ParameterHandle
+ * @brief Typed handle to a parameter of a ParameterRegistry, resolved once at configuration time
+ */
+template<typename T>
+class ParameterHandle {
+private:
+  ParameterSlot<T>* slot_; ///< the storage of the parameter, owned by the registry
+
+public:
+  /**
+   * @brief Empty constructor of an invalid handle
+   */
+  ParameterHandle() : slot_(nullptr) {}
+
+  /**
+   * @brief Constructor with the storage of the parameter
+   * @param slot the storage of the parameter
+   */
+  explicit ParameterHandle(ParameterSlot<T>* slot) : slot_(slot) {}
+
+  /**
+   * @brief Check if the handle refers to a parameter
+   */
+  bool is_valid() const {
+    return this->slot_ != nullptr;
+  }
+
+  /**
+   * @brief Getter of the name of the parameter
+   */
+  const std::string& get_name() const {
+    return this->slot_->get_name();
+  }
+
+  /**
+   * @brief Getter of the value of the parameter, to be called from the thread calling ParameterRegistry::update.
+   * The value is a consistent snapshot that only changes at the next update
+   */
+  const T& get_value() const {
+    return this->slot_->get_value();
+  }
+
+  /**
+   * @brief Publish a new value of the parameter, from any thread. The value is visible to the reader
+   * after its next call to ParameterRegistry::update
+   * @param value the new value
+   */
+  void set_value(const T& value) const {
+    this->slot_->set_value(value);
+  }
+};
+
+/**
+ * @class ParameterRegistry
+ * @brief Registry of parameters shared between a real-time thread and other threads, e.g. a user interface.
+ * Parameters are added at configuration time, before the threads start. Afterwards, any thread can publish
+ * new values while the real-time thread calls update once per cycle, which makes all the values published
+ * since the previous cycle visible at once, wait-free and without allocation, and then notifies the change
+ * callbacks with the batch of changed parameters.
+ */
+class ParameterRegistry {
+public:
+  /**
+   * @brief Callback notified at each update with the indices of the parameters that changed, see get_name
+   */
+  using ChangeCallback = std::function<void(const ParameterRegistry&, const std::vector<std::size_t>&)>;
+
+private:
+  std::vector<std::unique_ptr<ParameterSlotInterface>> slots_; ///< storage of the parameters
+  std::map<std::string, std::size_t> indices_;                 ///< indices of the parameters by name
+  std::vector<std::size_t> changed_;                           ///< indices of the parameters changed at the last update
+  std::vector<ChangeCallback> callbacks_;                      ///< callbacks notified of the changes
+
+  /**
+   * @brief Find the storage of a parameter by name
+   * @param name the name of the parameter
+   * @return the storage of the parameter
+   */
+  ParameterSlotInterface& get_slot(const std::string& name) const;
+
+public:
+  /**
+   * @brief Empty constructor
+   */
+  ParameterRegistry() = default;
+
+  ParameterRegistry(const ParameterRegistry&) = delete;
+
+  ParameterRegistry& operator=(const ParameterRegistry&) = delete;
+
+  /**
+   * @brief Add a parameter with an initial value, at configuration time
+   * @param name the unique name of the parameter
+   * @param value the initial value of the parameter
+   * @return the handle of the parameter
+   */
+  template<typename T>
+  ParameterHandle<T> add_parameter(const std::string& name, const T& value);
+
+  /**
+   * @brief Add a parameter from an existing parameter, at configuration time
+   * @param parameter the parameter giving the name and the initial value
+   * @return the handle of the parameter
+   */
+  template<typename T>
+  ParameterHandle<T> add_parameter(const Parameter<T>& parameter);
+
+  /**
+   * @brief Get the typed handle of a parameter, to be resolved once at configuration time
+   * @param name the name of the parameter
+   * @return the handle of the parameter
+   */
+  template<typename T>
+  ParameterHandle<T> get_handle(const std::string& name) const;
+
+  /**
+   * @brief Add a callback notified at each update in which parameters changed, at configuration time.
+   * Callbacks are called from the thread calling update
+   * @param callback the callback
+   */
+  void add_change_callback(const ChangeCallback& callback);
+
+  /**
+   * @brief Getter of the number of parameters
+   */
+  std::size_t get_size() const;
+
+  /**
+   * @brief Getter of the name of a parameter
+   * @param index the index of the parameter
+   */
+  const std::string& get_name(std::size_t index) const;
+
+  /**
+   * @brief Check if a parameter exists
+   * @param name the name of the parameter
+   */
+  bool has_parameter(const std::string& name) const;
+
+  /**
+   * @brief Publish a new value of a parameter by name, from any thread
+   * @param name the name of the parameter
+   * @param value the new value
+   */
+  template<typename T>
+  void set_value(const std::string& name, const T& value) const;
+
+  /**
+   * @brief Publish the value of a parameter with the name of a registered parameter, from any thread
+   * @param parameter the parameter holding the new value
+   */
+  void set_parameter(const std::shared_ptr<ParameterInterface>& parameter) const;
+
+  /**
+   * @brief Make the values published since the last update visible through the handles and notify the
+   * callbacks if any parameter changed. To be called once per cycle by the real-time thread, the only
+   * thread reading the values
+   * @return the number of parameters that changed
+   */
+  std::size_t update();
+
+  /**
+   * @brief Getter of the indices of the parameters changed at the last update
+   */
+  const std::vector<std::size_t>& get_changed() const;
+
+  /**
+   * @brief Copy the values visible to the reader in a list of parameters, from the thread calling update
+   * @return the list of parameters
+   */
+  std::list<std::shared_ptr<ParameterInterface>> get_parameters() const;
+};
+
+template<typename T>
+ParameterHandle<T> ParameterRegistry::add_parameter(const std::string& name, const T& value) {
+  if (this->has_parameter(name)) {
+    throw exceptions::InvalidParameterException("Parameter " + name + " already exists in the registry");
+  }
+  auto slot = std::make_unique<ParameterSlot<T>>(name, value);
+  ParameterHandle<T> handle(slot.get());
+  this->indices_.emplace(name, this->slots_.size());
+  this->slots_.push_back(std::move(slot));
+  this->changed_.reserve(this->slots_.size());
+  return handle;
+}
+
+template<typename T>
+ParameterHandle<T> ParameterRegistry::add_parameter(const Parameter<T>& parameter) {
+  return this->add_parameter(parameter.get_name(), parameter.get_value());
+}
+
+template<typename T>
+ParameterHandle<T> ParameterRegistry::get_handle(const std::string& name) const {
+  auto slot = dynamic_cast<ParameterSlot<T>*>(&this->get_slot(name));
+  if (slot == nullptr) {
+    throw exceptions::UnrecognizedParameterTypeException("Parameter " + name + " is not of the requested type");
+  }
+  return ParameterHandle<T>(slot);
+}
+
+template<typename T>
+void ParameterRegistry::set_value(const std::string& name, const T& value) const {
+  this->get_handle<T>(name).set_value(value);
+}
+}// namespace state_representation
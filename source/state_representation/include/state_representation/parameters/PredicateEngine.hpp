@@ -0,0 +1,259 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include "state_representation/parameters/Predicate.hpp"
+
+namespace state_representation {
+/**
+ * @enum ComparisonOperator
+ * @brief Comparison of a variable with a threshold in a condition
+ */
+enum class ComparisonOperator {
+  LESS, LESS_EQUAL, GREATER, GREATER_EQUAL
+};
+
+/**
+ * @enum PredicateEdge
+ * @brief Change of value of a condition notifying a callback
+ */
+enum class PredicateEdge {
+  RISING, FALLING, ANY
+};
+
+/**
+ * @class PredicateEngine
+ * @brief Evaluation of many conditions over scalar variables once per cycle. The variables are either set
+ * by the user, e.g. a distance or a force norm, or sampled from a function at each evaluation. Each condition
+ * compares a variable with a threshold, or combines previous conditions with all_of or any_of.
+ * Conditions are compiled at configuration time into flat arrays (variable index, sign and threshold of each
+ * comparison, operands of each combination), such that an evaluation is a single branch-free pass over the
+ * comparisons followed by a pass over the combinations, without allocation. Rising and falling edges are then
+ * detected in bulk against the previous values, and only the callbacks and the predicates bound to the
+ * conditions that changed are notified.
+ */
+class PredicateEngine {
+public:
+  /**
+   * @brief Callback notified with the index and the new value of a condition that changed
+   */
+  using EdgeCallback = std::function<void(std::size_t, bool)>;
+
+private:
+  /**
+   * @brief Callback with the edge on which it is notified
+   */
+  struct CallbackEntry {
+    PredicateEdge edge;
+    EdgeCallback callback;
+  };
+
+  // variables
+  std::vector<std::string> variable_names_;                 ///< names of the variables
+  std::map<std::string, std::size_t> variable_indices_;     ///< indices of the variables by name
+  std::vector<double> variables_;                           ///< values of the variables
+  std::vector<std::pair<std::size_t, std::function<double()>>> samplers_; ///< sampled variables
+
+  // conditions
+  std::vector<std::string> names_;                          ///< names of the conditions
+  std::map<std::string, std::size_t> indices_;              ///< indices of the conditions by name
+  std::vector<std::size_t> comparison_indices_;             ///< index of the comparison of each condition, if any
+  std::vector<std::size_t> comparison_conditions_;          ///< condition of each comparison
+  std::vector<std::size_t> comparison_variables_;           ///< variable of each comparison
+  std::vector<double> comparison_signs_;                    ///< 1 for greater, -1 for less
+  std::vector<double> comparison_thresholds_;               ///< threshold of each comparison multiplied by its sign
+  std::vector<uint8_t> comparison_inclusive_;               ///< 1 if equality satisfies the comparison
+  std::vector<std::size_t> combination_conditions_;         ///< condition of each combination
+  std::vector<uint8_t> combination_all_;                    ///< 1 for all_of, 0 for any_of
+  std::vector<std::size_t> combination_offsets_;            ///< offsets of the operands of each combination
+  std::vector<std::size_t> combination_operands_;           ///< conditions combined by the combinations
+
+  // evaluation
+  std::vector<double> margins_;                             ///< signed margins of the comparisons
+  std::vector<uint8_t> values_;                             ///< values of the conditions
+  std::vector<uint8_t> previous_values_;                    ///< values of the conditions at the previous evaluation
+  std::vector<std::size_t> changed_;                        ///< conditions changed at the last evaluation
+  std::vector<std::vector<CallbackEntry>> callbacks_;       ///< callbacks of each condition
+  std::vector<std::vector<std::shared_ptr<Predicate>>> predicates_; ///< predicates bound to each condition
+
+  /**
+   * @brief Add the storage of a condition
+   * @param name the unique name of the condition
+   * @return the index of the condition
+   */
+  std::size_t allocate_condition(const std::string& name);
+
+  /**
+   * @brief Add a combination of conditions
+   * @param name the unique name of the condition
+   * @param conditions the names of the conditions to combine
+   * @param all true for all_of, false for any_of
+   * @return the index of the condition
+   */
+  std::size_t add_combination(const std::string& name, const std::vector<std::string>& conditions, bool all);
+
+  /**
+   * @brief Check the index of a condition
+   * @param index the index of the condition
+   */
+  void assert_condition_index(std::size_t index) const;
+
+public:
+  /**
+   * @brief Empty constructor
+   */
+  PredicateEngine();
+
+  /**
+   * @brief Add a variable set by the user, at configuration time
+   * @param name the unique name of the variable
+   * @param value the initial value of the variable
+   * @return the index of the variable
+   */
+  std::size_t add_variable(const std::string& name, double value = 0);
+
+  /**
+   * @brief Add a variable sampled from a function at each evaluation, at configuration time
+   * @param name the unique name of the variable
+   * @param sampler the function returning the value of the variable, e.g. the distance between two states
+   * @return the index of the variable
+   */
+  std::size_t add_variable(const std::string& name, const std::function<double()>& sampler);
+
+  /**
+   * @brief Getter of the index of a variable
+   * @param name the name of the variable
+   */
+  std::size_t get_variable_index(const std::string& name) const;
+
+  /**
+   * @brief Getter of the value of a variable
+   * @param index the index of the variable
+   */
+  double get_variable(std::size_t index) const;
+
+  /**
+   * @brief Setter of the value of a variable, used at the next evaluation
+   * @param index the index of the variable
+   * @param value the new value
+   */
+  void set_variable(std::size_t index, double value);
+
+  /**
+   * @brief Setter of the value of a variable by name, used at the next evaluation
+   * @param name the name of the variable
+   * @param value the new value
+   */
+  void set_variable(const std::string& name, double value);
+
+  /**
+   * @brief Add a condition comparing a variable with a threshold, at configuration time
+   * @param name the unique name of the condition
+   * @param variable the name of the variable
+   * @param comparison the comparison operator, the variable being on the left-hand side
+   * @param threshold the threshold
+   * @return the index of the condition
+   */
+  std::size_t add_condition(
+      const std::string& name, const std::string& variable, ComparisonOperator comparison, double threshold
+  );
+
+  /**
+   * @brief Add a condition true when all the given conditions are true, at configuration time
+   * @param name the unique name of the condition
+   * @param conditions the names of the conditions, already added
+   * @return the index of the condition
+   */
+  std::size_t add_all_of(const std::string& name, const std::vector<std::string>& conditions);
+
+  /**
+   * @brief Add a condition true when any of the given conditions is true, at configuration time
+   * @param name the unique name of the condition
+   * @param conditions the names of the conditions, already added
+   * @return the index of the condition
+   */
+  std::size_t add_any_of(const std::string& name, const std::vector<std::string>& conditions);
+
+  /**
+   * @brief Setter of the threshold of a comparison
+   * @param index the index of the condition, which has to be a comparison
+   * @param threshold the new threshold
+   */
+  void set_threshold(std::size_t index, double threshold);
+
+  /**
+   * @brief Add a callback notified when a condition changes, at configuration time
+   * @param condition the name of the condition
+   * @param callback the callback
+   * @param edge the edge on which the callback is notified
+   */
+  void add_callback(
+      const std::string& condition, const EdgeCallback& callback, PredicateEdge edge = PredicateEdge::ANY
+  );
+
+  /**
+   * @brief Bind a predicate to a condition, at configuration time. The value of the predicate is set each
+   * time the condition changes, such that an Event is true once per rising edge of the condition
+   * @param condition the name of the condition
+   * @param predicate the predicate
+   */
+  void bind_predicate(const std::string& condition, const std::shared_ptr<Predicate>& predicate);
+
+  /**
+   * @brief Sample the variables, evaluate all the conditions, detect the edges and notify the callbacks and
+   * the predicates of the conditions that changed
+   * @return the number of conditions that changed
+   */
+  std::size_t evaluate();
+
+  /**
+   * @brief Getter of the number of conditions
+   */
+  std::size_t get_size() const;
+
+  /**
+   * @brief Getter of the index of a condition
+   * @param name the name of the condition
+   */
+  std::size_t get_index(const std::string& name) const;
+
+  /**
+   * @brief Getter of the name of a condition
+   * @param index the index of the condition
+   */
+  const std::string& get_name(std::size_t index) const;
+
+  /**
+   * @brief Getter of the value of a condition at the last evaluation
+   * @param index the index of the condition
+   */
+  bool get_value(std::size_t index) const;
+
+  /**
+   * @brief Getter of the value of a condition at the last evaluation
+   * @param name the name of the condition
+   */
+  bool get_value(const std::string& name) const;
+
+  /**
+   * @brief Check if a condition changed from false to true at the last evaluation
+   * @param index the index of the condition
+   */
+  bool is_rising(std::size_t index) const;
+
+  /**
+   * @brief Check if a condition changed from true to false at the last evaluation
+   * @param index the index of the condition
+   */
+  bool is_falling(std::size_t index) const;
+
+  /**
+   * @brief Getter of the indices of the conditions changed at the last evaluation
+   */
+  const std::vector<std::size_t>& get_changed() const;
+};
+}// namespace state_representation
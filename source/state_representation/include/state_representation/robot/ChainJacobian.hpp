@@ -0,0 +1,198 @@
+#pragma once
+
+#include "state_representation/robot/Jacobian.hpp"
+
+namespace state_representation {
+/**
+ * @class ChainJacobian
+ * @brief Jacobian of a frame stored in a chain-sparse form, i.e. a dense 6xk block for the k joints of the
+ * kinematic chain of the frame and the indices of those joints in the full table of joint names of the robot.
+ * The columns of the joints outside the chain are zero and are neither stored nor used in the computations,
+ * such that memory and operations scale with the length of the chain rather than the number of joints.
+ */
+class ChainJacobian {
+private:
+  SharedJointNames joint_names_;      ///< shared table of the names of all the joints of the robot
+  std::vector<unsigned int> columns_; ///< sorted indices of the joints of the chain in the table of joint names
+  Jacobian block_;                    ///< dense Jacobian of the joints of the chain
+
+  /**
+   * @brief Scatter the values of the joints of the chain in a vector of all the joints filled with zeros
+   * @param vector the vector of size the number of joints of the chain
+   * @return the vector of size the number of joints
+   */
+  Eigen::VectorXd scatter(const Eigen::VectorXd& vector) const;
+
+public:
+  /**
+   * @brief Empty constructor for a ChainJacobian
+   */
+  ChainJacobian();
+
+  /**
+   * @brief Constructor with name, shared table of joint names, columns of the chain, frame name and reference frame
+   * @param robot_name the name of the associated robot
+   * @param joint_names the shared table of all the joint names of the robot
+   * @param columns the indices of the joints of the chain in the table of joint names
+   * @param frame the name of the frame at which the Jacobian is computed
+   * @param reference_frame the name of the reference frame in which the Jacobian is expressed (default "world")
+   */
+  ChainJacobian(const std::string& robot_name,
+                const SharedJointNames& joint_names,
+                const std::vector<unsigned int>& columns,
+                const std::string& frame,
+                const std::string& reference_frame = "world");
+
+  /**
+   * @brief Constructor from a dense Jacobian, keeping only its non-zero columns
+   * @param jacobian the dense Jacobian
+   * @param tolerance the norm under which a column is considered to be zero
+   */
+  explicit ChainJacobian(const Jacobian& jacobian, double tolerance = 0.);
+
+  /**
+   * @brief Getter of the name of the associated robot
+   */
+  const std::string& get_name() const;
+
+  /**
+   * @brief Check if the block of the Jacobian is empty
+   */
+  bool is_empty() const;
+
+  /**
+   * @brief Getter of the number of rows
+   */
+  unsigned int rows() const;
+
+  /**
+   * @brief Getter of the number of columns of the equivalent dense Jacobian, i.e. the number of joints
+   */
+  unsigned int cols() const;
+
+  /**
+   * @brief Getter of the joint names of the robot
+   */
+  const std::vector<std::string>& get_joint_names() const;
+
+  /**
+   * @brief Getter of the shared table of joint names of the robot
+   */
+  const SharedJointNames& get_shared_joint_names() const;
+
+  /**
+   * @brief Getter of the indices of the joints of the chain
+   */
+  const std::vector<unsigned int>& get_chain_columns() const;
+
+  /**
+   * @brief Getter of the frame attribute
+   */
+  const std::string& get_frame() const;
+
+  /**
+   * @brief Getter of the reference_frame attribute
+   */
+  const std::string& get_reference_frame() const;
+
+  /**
+   * @brief Getter of the dense Jacobian of the joints of the chain
+   */
+  const Jacobian& get_block() const;
+
+  /**
+   * @brief Setter of the values of the dense Jacobian of the joints of the chain
+   * @param data the 6xk matrix of the chain
+   */
+  void set_block_data(const Eigen::MatrixXd& data);
+
+  /**
+   * @brief Setter of the values from a dense Jacobian matrix of all the joints, the columns outside the chain are ignored
+   * @param data the 6xn matrix of all the joints
+   */
+  void set_data(const Eigen::MatrixXd& data);
+
+  /**
+   * @brief Return the equivalent dense Jacobian
+   * @return the dense Jacobian
+   */
+  Jacobian to_jacobian() const;
+
+  /**
+   * @brief Overload the * operator with a matrix of n rows
+   * @param matrix the matrix to multiply with
+   * @return the Jacobian matrix multiplied by the matrix in parameter
+   */
+  Eigen::MatrixXd operator*(const Eigen::MatrixXd& matrix) const;
+
+  /**
+   * @brief Overload the * operator with a JointVelocities
+   * @param dq the joint velocity to multiply with
+   * @return this result into the CartesianTwist of the frame
+   */
+  CartesianTwist operator*(const JointVelocities& dq) const;
+
+  /**
+   * @brief Multiply a wrench with the transpose of the Jacobian
+   * @param wrench the cartesian wrench
+   * @return the resulting joint torques J^T*F, zero for the joints outside the chain
+   */
+  JointTorques transpose_multiply(const CartesianWrench& wrench) const;
+
+  /**
+   * @brief Solve the system dX = J*dq to obtain dq. Only the block of the chain is factorized and
+   * the velocities of the joints outside the chain are zero
+   * @param twist the cartesian velocity
+   * @return the joint velocities solution of the system
+   */
+  JointVelocities solve(const CartesianTwist& twist) const;
+
+  /**
+   * @brief Overload the ostream operator for printing
+   * @param os the ostream to append the string representing the matrix to
+   * @param jacobian the ChainJacobian to print
+   * @return the appended ostream
+   */
+  friend std::ostream& operator<<(std::ostream& os, const ChainJacobian& jacobian);
+};
+
+inline const std::string& ChainJacobian::get_name() const {
+  return this->block_.get_name();
+}
+
+inline bool ChainJacobian::is_empty() const {
+  return this->block_.is_empty();
+}
+
+inline unsigned int ChainJacobian::rows() const {
+  return this->block_.rows();
+}
+
+inline unsigned int ChainJacobian::cols() const {
+  return this->joint_names_->size();
+}
+
+inline const std::vector<std::string>& ChainJacobian::get_joint_names() const {
+  return *this->joint_names_;
+}
+
+inline const SharedJointNames& ChainJacobian::get_shared_joint_names() const {
+  return this->joint_names_;
+}
+
+inline const std::vector<unsigned int>& ChainJacobian::get_chain_columns() const {
+  return this->columns_;
+}
+
+inline const std::string& ChainJacobian::get_frame() const {
+  return this->block_.get_frame();
+}
+
+inline const std::string& ChainJacobian::get_reference_frame() const {
+  return this->block_.get_reference_frame();
+}
+
+inline const Jacobian& ChainJacobian::get_block() const {
+  return this->block_;
+}
+}// namespace state_representation
@@ -0,0 +1,548 @@
+#pragma once
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/robot/Jacobian.hpp"
+#include "state_representation/robot/JointState.hpp"
+#include <type_traits>
+
+namespace state_representation {
+template<int N>
+class FixedJointState;
+
+/**
+ * @brief Joint state with a number of joints known at compile time. Eigen::Dynamic
+ * maps to the dynamically sized JointState, any other size to FixedJointState
+ * @tparam N the number of joints or Eigen::Dynamic
+ */
+template<int N>
+using JointStateN = typename std::conditional<N == Eigen::Dynamic, JointState, FixedJointState<N>>::type;
+
+/**
+ * @class FixedJointState
+ * @brief Class to define a state in joint space with a number of joints fixed at compile time.
+ * All the state variables are stored in fixed-size vectors such that the state does not
+ * allocate on the heap and the arithmetic operations are unrolled by Eigen
+ * @tparam N the number of joints
+ */
+template<int N>
+class FixedJointState : public State {
+  static_assert(N > 0, "The number of joints of a FixedJointState must be positive, use JointState otherwise");
+
+public:
+  typedef Eigen::Matrix<double, N, 1> VectorNd;
+
+private:
+  SharedJointNames names_;  ///< shared table of the names of the joints
+  VectorNd positions_;      ///< joints positions
+  VectorNd velocities_;     ///< joints velocities
+  VectorNd accelerations_;  ///< joints accelerations
+  VectorNd torques_;        ///< joints torques
+
+  /**
+   * @brief Throw if the state given as argument is not compatible with the current one
+   * @param state the state to check compatibility with
+   */
+  void check_compatibility(const FixedJointState<N>& state) const;
+
+public:
+  /**
+   * @brief Empty constructor
+   */
+  explicit FixedJointState();
+
+  /**
+   * @brief Constructor with name provided, the joints are given default names
+   * @param robot_name the name of the associated robot
+   */
+  explicit FixedJointState(const std::string& robot_name);
+
+  /**
+   * @brief Constructor with name and list of joint names provided
+   * @param robot_name the name of the associated robot
+   * @param joint_names list of joint names
+   */
+  explicit FixedJointState(const std::string& robot_name, const std::vector<std::string>& joint_names);
+
+  /**
+   * @brief Constructor with name and shared table of joint names provided
+   * @param robot_name the name of the associated robot
+   * @param joint_names shared table of joint names, interned if not obtained from joint_names::intern or another state
+   */
+  explicit FixedJointState(const std::string& robot_name, const SharedJointNames& joint_names);
+
+  /**
+   * @brief Conversion constructor from a dynamically sized JointState
+   * @param state the JointState with exactly N joints
+   */
+  explicit FixedJointState(const JointState& state);
+
+  /**
+   * @brief Copy constructor
+   */
+  FixedJointState(const FixedJointState<N>& state) = default;
+
+  /**
+   * @brief Copy assignment operator
+   */
+  FixedJointState<N>& operator=(const FixedJointState<N>& state) = default;
+
+  /**
+   * @brief Constructor for the zero JointState
+   * @param robot_name the name of the associated robot
+   * @return FixedJointState with zero values in all attributes
+   */
+  static FixedJointState<N> Zero(const std::string& robot_name);
+
+  /**
+   * @brief Constructor for the random JointState
+   * @param robot_name the name of the associated robot
+   * @return FixedJointState with random values in all attributes
+   */
+  static FixedJointState<N> Random(const std::string& robot_name);
+
+  /**
+   * @brief Conversion to a dynamically sized JointState sharing the same joint names
+   */
+  explicit operator JointState() const;
+
+  /**
+   * @brief Getter of the size, known at compile time
+   */
+  static constexpr unsigned int get_size();
+
+  /**
+   * @brief Getter of the names attribute
+   */
+  const std::vector<std::string>& get_names() const;
+
+  /**
+   * @brief Getter of the shared table of joint names
+   */
+  const SharedJointNames& get_shared_names() const;
+
+  /**
+   * @brief Setter of the names attribute
+   */
+  void set_names(const std::vector<std::string>& names);
+
+  /**
+   * @brief Getter of the positions attribute
+   */
+  const VectorNd& get_positions() const;
+
+  /**
+   * @brief Setter of the positions attribute
+   */
+  void set_positions(const VectorNd& positions);
+
+  /**
+   * @brief Getter of the velocities attribute
+   */
+  const VectorNd& get_velocities() const;
+
+  /**
+   * @brief Setter of the velocities attribute
+   */
+  void set_velocities(const VectorNd& velocities);
+
+  /**
+   * @brief Getter of the accelerations attribute
+   */
+  const VectorNd& get_accelerations() const;
+
+  /**
+   * @brief Setter of the accelerations attribute
+   */
+  void set_accelerations(const VectorNd& accelerations);
+
+  /**
+   * @brief Getter of the torques attribute
+   */
+  const VectorNd& get_torques() const;
+
+  /**
+   * @brief Setter of the torques attribute
+   */
+  void set_torques(const VectorNd& torques);
+
+  /**
+   * @brief Set the FixedJointState to a zero value
+   */
+  void set_zero();
+
+  /**
+   * @brief Return the concatenated data of all the state variables
+   * @return the data vector of size 4N
+   */
+  Eigen::Matrix<double, 4 * N, 1> data() const;
+
+  /**
+   * @brief Check if the state is compatible for operations with the state given as argument
+   * @param state the state to check compatibility with
+   */
+  bool is_compatible(const State& state) const override;
+
+  /**
+   * @brief Initialize the FixedJointState to zero values
+   */
+  void initialize() override;
+
+  /**
+   * @brief Overload the += operator
+   * @param state FixedJointState to add
+   * @return the current FixedJointState added the FixedJointState given in argument
+   */
+  FixedJointState<N>& operator+=(const FixedJointState<N>& state);
+
+  /**
+   * @brief Overload the + operator
+   * @param state FixedJointState to add
+   * @return the current FixedJointState added the FixedJointState given in argument
+   */
+  FixedJointState<N> operator+(const FixedJointState<N>& state) const;
+
+  /**
+   * @brief Overload the -= operator
+   * @param state FixedJointState to subtract
+   * @return the current FixedJointState subtracted the FixedJointState given in argument
+   */
+  FixedJointState<N>& operator-=(const FixedJointState<N>& state);
+
+  /**
+   * @brief Overload the - operator
+   * @param state FixedJointState to subtract
+   * @return the current FixedJointState subtracted the FixedJointState given in argument
+   */
+  FixedJointState<N> operator-(const FixedJointState<N>& state) const;
+
+  /**
+   * @brief Overload the *= operator with a scalar
+   * @param lambda the scalar to multiply with
+   * @return the FixedJointState multiplied by lambda
+   */
+  FixedJointState<N>& operator*=(double lambda);
+
+  /**
+   * @brief Overload the * operator with a scalar
+   * @param lambda the scalar to multiply with
+   * @return the FixedJointState multiplied by lambda
+   */
+  FixedJointState<N> operator*(double lambda) const;
+
+  /**
+   * @brief Overload the /= operator with a scalar
+   * @param lambda the scalar to divide with
+   * @return the FixedJointState divided by lambda
+   */
+  FixedJointState<N>& operator/=(double lambda);
+
+  /**
+   * @brief Overload the / operator with a scalar
+   * @param lambda the scalar to divide with
+   * @return the FixedJointState divided by lambda
+   */
+  FixedJointState<N> operator/(double lambda) const;
+
+  /**
+   * @brief Overload the * operator with a scalar
+   * @param lambda the scalar to multiply with
+   * @param state the FixedJointState to be multiplied
+   * @return the FixedJointState multiplied by lambda
+   */
+  friend FixedJointState<N> operator*(double lambda, const FixedJointState<N>& state) {
+    return state * lambda;
+  }
+
+  /**
+   * @brief Overload the * operator of a Jacobian with the velocities of a FixedJointState
+   * @param jacobian the Jacobian, sharing the joint names of the state
+   * @param state the FixedJointState with the joint velocities
+   * @return the CartesianTwist at the frame of the Jacobian
+   */
+  friend CartesianTwist operator*(const Jacobian& jacobian, const FixedJointState<N>& state) {
+    if (CHECKED_OPERATIONS && jacobian.is_empty()) {
+      throw exceptions::EmptyStateException(jacobian.get_name() + " state is empty");
+    }
+    if (CHECKED_OPERATIONS && state.is_empty()) {
+      throw exceptions::EmptyStateException(state.get_name() + " state is empty");
+    }
+    if (CHECKED_OPERATIONS
+        && (jacobian.get_name() != state.get_name() || jacobian.get_shared_joint_names() != state.names_)) {
+      throw exceptions::IncompatibleStatesException("The Jacobian and the input FixedJointState are incompatible");
+    }
+    Eigen::Matrix<double, 6, 1> twist = jacobian.data() * state.velocities_;
+    return CartesianTwist(jacobian.get_frame(), twist, jacobian.get_reference_frame());
+  }
+
+  /**
+   * @brief Overload the ostream operator for printing
+   * @param os the ostream to append the string representing the state
+   * @param state the state to print
+   * @return the appended ostream
+   */
+  friend std::ostream& operator<<(std::ostream& os, const FixedJointState<N>& state) {
+    if (state.is_empty()) {
+      os << "Empty " << state.get_name() << " FixedJointState";
+    } else {
+      os << static_cast<JointState>(state);
+    }
+    return os;
+  }
+};
+
+template<int N>
+FixedJointState<N>::FixedJointState() :
+    State(StateType::FIXEDJOINTSTATE), names_(joint_names::intern(N)) {
+  this->initialize();
+}
+
+template<int N>
+FixedJointState<N>::FixedJointState(const std::string& robot_name) :
+    State(StateType::FIXEDJOINTSTATE, robot_name), names_(joint_names::intern(N)) {
+  this->initialize();
+}
+
+template<int N>
+FixedJointState<N>::FixedJointState(const std::string& robot_name, const std::vector<std::string>& joint_names) :
+    FixedJointState(robot_name) {
+  this->set_names(joint_names);
+}
+
+template<int N>
+FixedJointState<N>::FixedJointState(const std::string& robot_name, const SharedJointNames& joint_names) :
+    State(StateType::FIXEDJOINTSTATE, robot_name), names_(joint_names::intern(joint_names)) {
+  if (this->names_->size() != N) {
+    throw exceptions::IncompatibleSizeException(
+        "Input number of joints is of incorrect size, expected " + std::to_string(N) + " got "
+            + std::to_string(this->names_->size()));
+  }
+  this->initialize();
+}
+
+template<int N>
+FixedJointState<N>::FixedJointState(const JointState& state) :
+    FixedJointState(state.get_name(), state.get_shared_names()) {
+  this->positions_ = state.get_positions();
+  this->velocities_ = state.get_velocities();
+  this->accelerations_ = state.get_accelerations();
+  this->torques_ = state.get_torques();
+  this->set_empty(state.is_empty());
+}
+
+template<int N>
+FixedJointState<N> FixedJointState<N>::Zero(const std::string& robot_name) {
+  FixedJointState<N> zero(robot_name);
+  // as opposed to the constructor specify this state to be filled
+  zero.set_filled();
+  return zero;
+}
+
+template<int N>
+FixedJointState<N> FixedJointState<N>::Random(const std::string& robot_name) {
+  FixedJointState<N> random(robot_name);
+  random.positions_.setRandom();
+  random.velocities_.setRandom();
+  random.accelerations_.setRandom();
+  random.torques_.setRandom();
+  random.set_filled();
+  return random;
+}
+
+template<int N>
+FixedJointState<N>::operator JointState() const {
+  JointState state(this->get_name(), this->names_);
+  if (!this->is_empty()) {
+    state.set_positions(this->positions_);
+    state.set_velocities(this->velocities_);
+    state.set_accelerations(this->accelerations_);
+    state.set_torques(this->torques_);
+  }
+  return state;
+}
+
+template<int N>
+constexpr unsigned int FixedJointState<N>::get_size() {
+  return N;
+}
+
+template<int N>
+inline const std::vector<std::string>& FixedJointState<N>::get_names() const {
+  return *this->names_;
+}
+
+template<int N>
+inline const SharedJointNames& FixedJointState<N>::get_shared_names() const {
+  return this->names_;
+}
+
+template<int N>
+inline void FixedJointState<N>::set_names(const std::vector<std::string>& names) {
+  if (names.size() != N) {
+    throw exceptions::IncompatibleSizeException(
+        "Input number of joints is of incorrect size, expected " + std::to_string(N) + " got "
+            + std::to_string(names.size()));
+  }
+  this->names_ = joint_names::intern(names);
+}
+
+template<int N>
+inline const typename FixedJointState<N>::VectorNd& FixedJointState<N>::get_positions() const {
+  return this->positions_;
+}
+
+template<int N>
+inline void FixedJointState<N>::set_positions(const VectorNd& positions) {
+  this->set_filled();
+  this->positions_ = positions;
+}
+
+template<int N>
+inline const typename FixedJointState<N>::VectorNd& FixedJointState<N>::get_velocities() const {
+  return this->velocities_;
+}
+
+template<int N>
+inline void FixedJointState<N>::set_velocities(const VectorNd& velocities) {
+  this->set_filled();
+  this->velocities_ = velocities;
+}
+
+template<int N>
+inline const typename FixedJointState<N>::VectorNd& FixedJointState<N>::get_accelerations() const {
+  return this->accelerations_;
+}
+
+template<int N>
+inline void FixedJointState<N>::set_accelerations(const VectorNd& accelerations) {
+  this->set_filled();
+  this->accelerations_ = accelerations;
+}
+
+template<int N>
+inline const typename FixedJointState<N>::VectorNd& FixedJointState<N>::get_torques() const {
+  return this->torques_;
+}
+
+template<int N>
+inline void FixedJointState<N>::set_torques(const VectorNd& torques) {
+  this->set_filled();
+  this->torques_ = torques;
+}
+
+template<int N>
+inline void FixedJointState<N>::set_zero() {
+  this->positions_.setZero();
+  this->velocities_.setZero();
+  this->accelerations_.setZero();
+  this->torques_.setZero();
+}
+
+template<int N>
+inline Eigen::Matrix<double, 4 * N, 1> FixedJointState<N>::data() const {
+  Eigen::Matrix<double, 4 * N, 1> all_fields;
+  all_fields << this->positions_, this->velocities_, this->accelerations_, this->torques_;
+  return all_fields;
+}
+
+template<int N>
+inline bool FixedJointState<N>::is_compatible(const State& state) const {
+  switch (state.get_type()) {
+    case StateType::FIXEDJOINTSTATE: {
+      auto fixed_state = dynamic_cast<const FixedJointState<N>*>(&state);
+      return fixed_state != nullptr && this->State::is_compatible(state) && this->names_ == fixed_state->names_;
+    }
+    case StateType::JOINTSTATE:
+      return this->State::is_compatible(state)
+          && this->names_ == static_cast<const JointState&>(state).get_shared_names();
+    case StateType::JACOBIANMATRIX:
+      return this->State::is_compatible(state)
+          && this->names_ == static_cast<const Jacobian&>(state).get_shared_joint_names();
+    default:
+      return false;
+  }
+}
+
+template<int N>
+inline void FixedJointState<N>::initialize() {
+  this->State::initialize();
+  this->set_zero();
+}
+
+template<int N>
+inline void FixedJointState<N>::check_compatibility(const FixedJointState<N>& state) const {
+  if (CHECKED_OPERATIONS && (this->get_name() != state.get_name() || this->names_ != state.names_)) {
+    throw exceptions::IncompatibleStatesException(
+        "The two joint states are incompatible, check name, joint names and order or size");
+  }
+}
+
+template<int N>
+inline FixedJointState<N>& FixedJointState<N>::operator+=(const FixedJointState<N>& state) {
+  this->check_compatibility(state);
+  this->set_filled();
+  this->positions_ += state.positions_;
+  this->velocities_ += state.velocities_;
+  this->accelerations_ += state.accelerations_;
+  this->torques_ += state.torques_;
+  return (*this);
+}
+
+template<int N>
+inline FixedJointState<N> FixedJointState<N>::operator+(const FixedJointState<N>& state) const {
+  FixedJointState<N> result(*this);
+  result += state;
+  return result;
+}
+
+template<int N>
+inline FixedJointState<N>& FixedJointState<N>::operator-=(const FixedJointState<N>& state) {
+  this->check_compatibility(state);
+  this->set_filled();
+  this->positions_ -= state.positions_;
+  this->velocities_ -= state.velocities_;
+  this->accelerations_ -= state.accelerations_;
+  this->torques_ -= state.torques_;
+  return (*this);
+}
+
+template<int N>
+inline FixedJointState<N> FixedJointState<N>::operator-(const FixedJointState<N>& state) const {
+  FixedJointState<N> result(*this);
+  result -= state;
+  return result;
+}
+
+template<int N>
+inline FixedJointState<N>& FixedJointState<N>::operator*=(double lambda) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
+    throw exceptions::EmptyStateException(this->get_name() + " state is empty");
+  }
+  this->set_filled();
+  this->positions_ *= lambda;
+  this->velocities_ *= lambda;
+  this->accelerations_ *= lambda;
+  this->torques_ *= lambda;
+  return (*this);
+}
+
+template<int N>
+inline FixedJointState<N> FixedJointState<N>::operator*(double lambda) const {
+  FixedJointState<N> result(*this);
+  result *= lambda;
+  return result;
+}
+
+template<int N>
+inline FixedJointState<N>& FixedJointState<N>::operator/=(double lambda) {
+  return (*this) *= (1 / lambda);
+}
+
+template<int N>
+inline FixedJointState<N> FixedJointState<N>::operator/(double lambda) const {
+  FixedJointState<N> result(*this);
+  result /= lambda;
+  return result;
+}
+}// namespace state_representation
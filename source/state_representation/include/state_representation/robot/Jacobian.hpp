@@ -25,13 +25,17 @@ class JointTorques;
  */
 class Jacobian : public State {
 private:
-  std::vector<std::string> joint_names_;///< names of the joints
+  SharedJointNames joint_names_;        ///< shared table of the names of the joints
   std::string frame_;                   ///< name of the frame at which the Jacobian is computed
   std::string reference_frame_;         ///< name of the reference frame in which the Jacobian is expressed
   unsigned int rows_;                   ///< number of rows
   unsigned int cols_;                   ///< number of columns
   Eigen::MatrixXd data_;                ///< internal storage of the Jacobian matrix
 
+  friend class JacobianView;
+  friend class JacobianSolver;
+  friend class ChainJacobian;
+
 public:
   /**
    * @brief Empty constructor for a Jacobian
@@ -88,6 +92,20 @@ public:
            const Eigen::MatrixXd& data,
            const std::string& reference_frame = "world");
 
+  /**
+   * @brief Constructor with name, shared table of joint names, frame name, Jacobian matrix and reference frame provided
+   * @param robot_name the name of the associated robot
+   * @param joint_names the shared table of joint names of the robot, as obtained from joint_names::intern or a state
+   * @param frame the name of the frame at which the Jacobian is computed
+   * @param data the values of the Jacobian matrix
+   * @param reference_frame the name of the reference frame in which the Jacobian is expressed (default "world")
+   */
+  Jacobian(const std::string& robot_name,
+           const SharedJointNames& joint_names,
+           const std::string& frame,
+           const Eigen::MatrixXd& data,
+           const std::string& reference_frame = "world");
+
   /**
    * @brief Copy constructor of a Jacobian
    */
@@ -174,6 +192,11 @@ public:
    */
   void set_joint_names(const std::vector<std::string>& joint_names);
 
+  /**
+   * @brief Getter of the shared table of joint names
+   */
+  const SharedJointNames& get_shared_joint_names() const;
+
   /**
    * @brief Getter of the frame attribute
    */
@@ -364,27 +387,29 @@ inline Eigen::VectorXd Jacobian::col(unsigned int index) const {
 }
 
 inline const std::vector<std::string>& Jacobian::get_joint_names() const {
-  return this->joint_names_;
+  return *this->joint_names_;
 }
 
 inline void Jacobian::set_joint_names(unsigned int nb_joints) {
-  if (this->joint_names_.size() != nb_joints) {
+  if (this->joint_names_->size() != nb_joints) {
     throw exceptions::IncompatibleSizeException("Input number of joints is of incorrect size, expected "
-                                                    + std::to_string(this->joint_names_.size())
+                                                    + std::to_string(this->joint_names_->size())
                                                     + " got " + std::to_string(nb_joints));
   }
-  for (unsigned int i = 0; i < nb_joints; ++i) {
-    this->joint_names_[i] = "joint" + std::to_string(i);
-  }
+  this->joint_names_ = joint_names::intern(nb_joints);
 }
 
 inline void Jacobian::set_joint_names(const std::vector<std::string>& joint_names) {
-  if (this->joint_names_.size() != joint_names.size()) {
+  if (this->joint_names_->size() != joint_names.size()) {
     throw exceptions::IncompatibleSizeException("Input vector of joint names is of incorrect size, expected "
-                                                    + std::to_string(this->joint_names_.size())
+                                                    + std::to_string(this->joint_names_->size())
                                                     + " got " + std::to_string(joint_names.size()));
   }
-  this->joint_names_ = joint_names;
+  this->joint_names_ = joint_names::intern(joint_names);
+}
+
+inline const SharedJointNames& Jacobian::get_shared_joint_names() const {
+  return this->joint_names_;
 }
 
 inline const std::string& Jacobian::get_frame() const {
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <eigen3/Eigen/Dense>
+
+#include "state_representation/robot/Jacobian.hpp"
+
+namespace state_representation {
+/**
+ * @enum JacobianSolverMethod
+ * @brief Decomposition used by the JacobianSolver
+ */
+enum class JacobianSolverMethod {
+  COMPLETE_ORTHOGONAL_DECOMPOSITION,
+  SINGULAR_VALUE_DECOMPOSITION,
+  DAMPED_LEAST_SQUARES
+};
+
+/**
+ * @class JacobianSolver
+ * @brief Factorization of a Jacobian matrix computed once per update and reused for solves,
+ * pseudoinverse and null space projection. The decomposition and the workspaces are kept
+ * between calls to compute such that updating a Jacobian of constant size does not reallocate.
+ */
+class JacobianSolver {
+private:
+  JacobianSolverMethod method_;          ///< decomposition used to factorize the Jacobian
+  double damping_;                       ///< damping factor of the damped least squares and SVD methods
+  Jacobian jacobian_;                    ///< copy of the factorized Jacobian
+  bool computed_;                        ///< true if a Jacobian has been factorized
+  Eigen::CompleteOrthogonalDecomposition<Eigen::MatrixXd> cod_;    ///< complete orthogonal decomposition of J
+  Eigen::JacobiSVD<Eigen::MatrixXd> svd_;                          ///< singular value decomposition of J
+  Eigen::LDLT<Eigen::MatrixXd> ldlt_;                              ///< LDLT decomposition of the damped normal matrix
+  Eigen::MatrixXd normal_matrix_;        ///< workspace holding the damped normal matrix
+  mutable Eigen::MatrixXd pseudoinverse_;///< cached pseudoinverse of the Jacobian
+  mutable bool pseudoinverse_computed_;  ///< true if the pseudoinverse is up to date with the factorization
+
+  /**
+   * @brief Throw if no Jacobian has been factorized yet
+   */
+  void assert_computed() const;
+
+  /**
+   * @brief Compute the pseudoinverse in the cache if it is not up to date
+   */
+  void compute_pseudoinverse() const;
+
+public:
+  /**
+   * @brief Constructor with the decomposition method and damping factor
+   * @param method the decomposition used to factorize the Jacobian
+   * @param damping the damping factor used by the damped least squares method and, if positive,
+   * to filter the small singular values of the SVD method. Ignored by the complete orthogonal decomposition
+   */
+  explicit JacobianSolver(JacobianSolverMethod method = JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION,
+                          double damping = 0.);
+
+  /**
+   * @brief Constructor factorizing a Jacobian
+   * @param jacobian the Jacobian to factorize
+   * @param method the decomposition used to factorize the Jacobian
+   * @param damping the damping factor, see the constructor above
+   */
+  explicit JacobianSolver(const Jacobian& jacobian,
+                          JacobianSolverMethod method = JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION,
+                          double damping = 0.);
+
+  /**
+   * @brief Getter of the decomposition method
+   */
+  JacobianSolverMethod get_method() const;
+
+  /**
+   * @brief Getter of the damping factor
+   */
+  double get_damping() const;
+
+  /**
+   * @brief Setter of the damping factor, the Jacobian is factorized again if one has been computed
+   * @param damping the new damping factor
+   */
+  void set_damping(double damping);
+
+  /**
+   * @brief Getter of the factorized Jacobian
+   */
+  const Jacobian& get_jacobian() const;
+
+  /**
+   * @brief Check if a Jacobian has been factorized
+   */
+  bool is_computed() const;
+
+  /**
+   * @brief Factorize the Jacobian, to be called once per update of the Jacobian
+   * @param jacobian the Jacobian to factorize
+   * @return reference to the solver
+   */
+  JacobianSolver& compute(const Jacobian& jacobian);
+
+  /**
+   * @brief Getter of the rank of the factorized Jacobian. The damped least squares method returns the
+   * rank of the damped normal matrix, which is always full
+   * @return the rank of the Jacobian
+   */
+  unsigned int rank() const;
+
+  /**
+   * @brief Solve the system J*X = M in the least squares sense using the cached factorization
+   * @param matrix the right hand side of the system
+   * @return the solution X
+   */
+  Eigen::MatrixXd solve(const Eigen::MatrixXd& matrix) const;
+
+  /**
+   * @brief Solve the system J*x = b into a preallocated vector
+   * @param vector the right hand side of the system
+   * @param result the vector to write the solution into, resized only if it has not the number of columns of J
+   */
+  void solve(const Eigen::VectorXd& vector, Eigen::VectorXd& result) const;
+
+  /**
+   * @brief Solve the system dX = J*dq to obtain dq using the cached factorization
+   * @param twist the cartesian velocity
+   * @return the joint velocities solution of the system
+   */
+  JointVelocities solve(const CartesianTwist& twist) const;
+
+  /**
+   * @brief Return the (damped) pseudoinverse of the Jacobian matrix, computed once per factorization
+   * @return the pseudoinverse matrix
+   */
+  const Eigen::MatrixXd& pseudoinverse_matrix() const;
+
+  /**
+   * @brief Return the (damped) pseudoinverse of the Jacobian with the metadata of the factorized Jacobian
+   * @return the pseudoinverse of the Jacobian
+   */
+  Jacobian pseudoinverse() const;
+
+  /**
+   * @brief Return the projector I - J^+ J on the null space of the Jacobian
+   * @return the null space projector
+   */
+  Eigen::MatrixXd null_space_projector() const;
+
+  /**
+   * @brief Project joint velocities on the null space of the Jacobian
+   * @param velocities the joint velocities to project
+   * @return the projected joint velocities
+   */
+  JointVelocities project_on_null_space(const JointVelocities& velocities) const;
+
+  /**
+   * @brief Multiply a wrench with the transpose of the factorized Jacobian without forming the transpose
+   * @param wrench the cartesian wrench
+   * @return the resulting joint torques J^T*F
+   */
+  JointTorques transpose_multiply(const CartesianWrench& wrench) const;
+};
+
+inline JacobianSolverMethod JacobianSolver::get_method() const {
+  return this->method_;
+}
+
+inline double JacobianSolver::get_damping() const {
+  return this->damping_;
+}
+
+inline const Jacobian& JacobianSolver::get_jacobian() const {
+  return this->jacobian_;
+}
+
+inline bool JacobianSolver::is_computed() const {
+  return this->computed_;
+}
+}// namespace state_representation
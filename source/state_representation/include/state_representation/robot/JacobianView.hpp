@@ -0,0 +1,64 @@
+#pragma once
+
+#include "state_representation/robot/Jacobian.hpp"
+
+namespace state_representation {
+/**
+ * @class JacobianView
+ * @brief Read-only view of a Jacobian matrix stored in an external column-major buffer.
+ * The view does not own nor copy the memory, which has to outlive it
+ */
+class JacobianView {
+private:
+  Eigen::Map<const Eigen::MatrixXd> data_;///< view of the Jacobian matrix
+
+public:
+  /**
+   * @brief Constructor of a view over a column-major buffer of 6 rows and nb_joints columns
+   * @param data pointer to the 6 * nb_joints values
+   * @param nb_joints the number of joints, i.e. of columns
+   */
+  explicit JacobianView(const double* data, unsigned int nb_joints);
+
+  /**
+   * @brief Constructor of a view over a column-major buffer of arbitrary size, e.g. for a transposed Jacobian
+   * @param data pointer to the rows * cols values
+   * @param rows the number of rows
+   * @param cols the number of columns
+   */
+  explicit JacobianView(const double* data, unsigned int rows, unsigned int cols);
+
+  /**
+   * @brief Getter of the number of rows
+   */
+  unsigned int rows() const;
+
+  /**
+   * @brief Getter of the number of columns
+   */
+  unsigned int cols() const;
+
+  /**
+   * @brief Getter of the view of the matrix
+   */
+  const Eigen::Map<const Eigen::MatrixXd>& data() const;
+
+  /**
+   * @brief Copy the viewed matrix into the existing storage of a Jacobian, without any allocation
+   * @param jacobian the Jacobian to copy into, of the same size as the view
+   */
+  void copy_to(Jacobian& jacobian) const;
+};
+
+inline unsigned int JacobianView::rows() const {
+  return this->data_.rows();
+}
+
+inline unsigned int JacobianView::cols() const {
+  return this->data_.cols();
+}
+
+inline const Eigen::Map<const Eigen::MatrixXd>& JacobianView::data() const {
+  return this->data_;
+}
+}// namespace state_representation
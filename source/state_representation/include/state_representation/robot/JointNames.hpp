@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace state_representation {
+/**
+ * @typedef SharedJointNames
+ * @brief Immutable and reference counted table of joint names. Tables are interned, such that
+ * two tables holding the same names in the same order are the same object and can be compared by pointer
+ */
+typedef std::shared_ptr<const std::vector<std::string>> SharedJointNames;
+
+namespace joint_names {
+/**
+ * @brief Get the interned table corresponding to a vector of joint names
+ * @param names the names of the joints
+ * @return the shared table of joint names
+ */
+SharedJointNames intern(const std::vector<std::string>& names);
+
+/**
+ * @brief Get the interned table corresponding to a shared table of joint names, such that a table that was not
+ * obtained from intern can still be compared by pointer
+ * @param names the shared table of joint names
+ * @return the interned table, names itself if it is already interned
+ */
+SharedJointNames intern(const SharedJointNames& names);
+
+/**
+ * @brief Get the interned table of default joint names (joint0, joint1, ...)
+ * @param nb_joints the number of joints
+ * @return the shared table of joint names
+ */
+SharedJointNames intern(unsigned int nb_joints);
+}// namespace joint_names
+}// namespace state_representation
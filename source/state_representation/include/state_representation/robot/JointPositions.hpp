@@ -23,6 +23,7 @@ public:
   const Eigen::VectorXd& get_velocities() const = delete;
   void set_velocities(const Eigen::VectorXd& velocities) = delete;
   void set_velocities(const std::vector<double>& velocities) = delete;
+  void set_velocity(const units::AngularVelocity& velocity, unsigned int joint_index) = delete;
   const Eigen::VectorXd& get_accelerations() const = delete;
   void set_accelerations(const Eigen::VectorXd& accelerations) = delete;
   void set_accelerations(const std::vector<double>& accelerations) = delete;
@@ -65,16 +66,35 @@ public:
   explicit JointPositions(const std::string& robot_name, const std::vector<std::string>& joint_names,
                           const Eigen::VectorXd& positions);
 
+  /**
+   * @brief Constructor with name, a shared table of joint names and position values provided
+   * @brief name the name of the state
+   * @brief joint_names shared table of joint names
+   * @brief positions the vector of positions
+   */
+  explicit JointPositions(const std::string& robot_name, const SharedJointNames& joint_names,
+                          const Eigen::VectorXd& positions);
+
   /**
    * @brief Copy constructor
    */
   JointPositions(const JointPositions& positions);
 
+  /**
+   * @brief Move constructor
+   */
+  JointPositions(JointPositions&& positions) = default;
+
   /**
    * @brief Copy constructor from a JointState
    */
   JointPositions(const JointState& state);
 
+  /**
+   * @brief Move constructor from a JointState, reusing its storage
+   */
+  JointPositions(JointState&& state);
+
   /**
    * @brief Copy constructor from a JointVelocities by considering that it is equivalent to multiplying the velocities by 1 second
    */
@@ -119,6 +139,13 @@ public:
    */
   JointPositions& operator=(const JointPositions& positions) = default;
 
+  /**
+   * @brief Move assignment operator
+   * @param positions the state with value to assign
+   * @return reference to the current state with new values
+   */
+  JointPositions& operator=(JointPositions&& positions) = default;
+
   /**
    * @brief Overload the += operator
    * @param positions JointPositions to add
@@ -131,7 +158,14 @@ public:
    * @param positions JointPositions to add
    * @return the current JointPositions added the JointPositions given in argument
    */
-  JointPositions operator+(const JointPositions& positions) const;
+  JointPositions operator+(const JointPositions& positions) const&;
+
+  /**
+   * @brief Overload the + operator on a temporary JointPositions, reusing its storage for the result
+   * @param positions JointPositions to add
+   * @return the current JointPositions added the JointPositions given in argument
+   */
+  JointPositions operator+(const JointPositions& positions)&&;
 
   /**
    * @brief Overload the -= operator
@@ -145,7 +179,14 @@ public:
    * @param positions JointPositions to subtract
    * @return the current JointPositions subtracted the JointPositions given in argument
    */
-  JointPositions operator-(const JointPositions& positions) const;
+  JointPositions operator-(const JointPositions& positions) const&;
+
+  /**
+   * @brief Overload the - operator on a temporary JointPositions, reusing its storage for the result
+   * @param positions JointPositions to subtract
+   * @return the current JointPositions subtracted the JointPositions given in argument
+   */
+  JointPositions operator-(const JointPositions& positions)&&;
 
   /**
    * @brief Overload the *= operator with a double gain
@@ -159,7 +200,14 @@ public:
    * @param lambda the gain to multiply with
    * @return the JointPositions multiplied by lambda
    */
-  JointPositions operator*(double lambda) const;
+  JointPositions operator*(double lambda) const&;
+
+  /**
+   * @brief Overload the * operator with a double gain on a temporary JointPositions, reusing its storage for the result
+   * @param lambda the gain to multiply with
+   * @return the JointPositions multiplied by lambda
+   */
+  JointPositions operator*(double lambda)&&;
 
   /**
    * @brief Overload the *= operator with an array of gains
@@ -201,7 +249,14 @@ public:
    * @param lambda the scalar to divide with
    * @return the JointPositions divided by lambda
    */
-  JointPositions operator/(double lambda) const;
+  JointPositions operator/(double lambda) const&;
+
+  /**
+   * @brief Overload the / operator with a scalar on a temporary JointPositions, reusing its storage for the result
+   * @param lambda the scalar to divide with
+   * @return the JointPositions divided by lambda
+   */
+  JointPositions operator/(double lambda)&&;
 
   /**
    * @brief Overload the / operator with a time period
@@ -237,6 +292,13 @@ public:
    */
   friend JointPositions operator*(double lambda, const JointPositions& positions);
 
+  /**
+   * @brief Overload the * operator with a scalar on a temporary JointPositions, reusing its storage for the result
+   * @param lambda the scalar to multiply with
+   * @return the JointPositions provided multiply by lambda
+   */
+  friend JointPositions operator*(double lambda, JointPositions&& positions);
+
   /**
    * @brief Overload the * operator with an array of gains
    * @param lambda the array to multiply with
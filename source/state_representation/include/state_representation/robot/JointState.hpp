@@ -6,7 +6,9 @@
 #pragma once
 
 #include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/robot/JointNames.hpp"
 #include "state_representation/State.hpp"
+#include "state_representation/units/Velocity.hpp"
 #include <eigen3/Eigen/Core>
 #include <iostream>
 #include <math.h>
@@ -49,12 +51,14 @@ double dist(const JointState& s1,
  */
 class JointState : public State {
 private:
-  std::vector<std::string> names_;///< names of the joints
+  SharedJointNames names_;        ///< shared table of the names of the joints
   Eigen::VectorXd positions_;     ///< joints positions
   Eigen::VectorXd velocities_;    ///< joints velocities
   Eigen::VectorXd accelerations_; ///< joints accelerations
   Eigen::VectorXd torques_;       ///< joints torques
 
+  friend class JointStateView;
+
   /**
    * @brief Getter of all the state variables (positions, velocities, accelerations and torques)
    * @return the concatenated vector of all the state variables
@@ -75,6 +79,14 @@ private:
    */
   void set_state_variable(Eigen::VectorXd& state_variable, const std::vector<double>& new_value);
 
+  /**
+   * @brief Set the value of a single joint of a state variable
+   * @param state_variable the state variable to fill
+   * @param new_value the new value of the joint
+   * @param joint_index the index of the joint
+   */
+  void set_state_variable(Eigen::VectorXd& state_variable, double new_value, unsigned int joint_index);
+
   /**
    * @brief Set new_value in the provided all the state variables (positions, velocities, accelerations and torques)
    */
@@ -109,6 +121,12 @@ protected:
    */
   void set_state_variable(const Eigen::VectorXd& new_value, const JointStateVariable& state_variable_type);
 
+  /**
+   * @brief Set the variable corresponding to the input to a zero value, without affecting the others
+   * @param state_variable_type the type of variable to set to zero
+   */
+  void set_zero(const JointStateVariable& state_variable_type);
+
 public:
   /**
    * @brief Empty constructor for a JointState
@@ -129,11 +147,23 @@ public:
    */
   explicit JointState(const std::string& robot_name, const std::vector<std::string>& joint_names);
 
+  /**
+   * @brief Constructor with name and shared table of joint names provided
+   * @param robot_name the name of the associated robot
+   * @param joint_names shared table of joint names, interned if not obtained from joint_names::intern or another state
+   */
+  explicit JointState(const std::string& robot_name, const SharedJointNames& joint_names);
+
   /**
    * @brief Copy constructor of a JointState
    */
   JointState(const JointState& state) = default;
 
+  /**
+   * @brief Move constructor of a JointState
+   */
+  JointState(JointState&& state) = default;
+
   /**
    * @brief Constructor for the zero JointState
    * @param robot_name the name of the associated robot
@@ -180,6 +210,13 @@ public:
    */
   JointState& operator=(const JointState& state);
 
+  /**
+   * @brief Move assignment operator that reuses the storage of the moved state
+   * @param state the state with value to assign
+   * @return reference to the current state with new values
+   */
+  JointState& operator=(JointState&& state);
+
   /**
    * @brief Getter of the size from the attributes
    */
@@ -200,6 +237,17 @@ public:
    */
   void set_names(const std::vector<std::string>& names);
 
+  /**
+   * @brief Getter of the shared table of joint names
+   */
+  const SharedJointNames& get_shared_names() const;
+
+  /**
+   * @brief Setter of the names attribute from a shared table of joint names
+   * @param names shared table of joint names, interned if not obtained from joint_names::intern or another state
+   */
+  void set_shared_names(const SharedJointNames& names);
+
   /**
    * @brief Getter of the positions attribute
    */
@@ -215,6 +263,13 @@ public:
    */
   void set_positions(const std::vector<double>& positions);
 
+  /**
+   * @brief Setter of the position of a single joint from a typed angle, taken as given without wrapping
+   * @param position the position of the joint, e.g. 90.0_deg or 270.0_deg
+   * @param joint_index the index of the joint
+   */
+  void set_position(const units::Angle& position, unsigned int joint_index);
+
   /**
    * @brief Getter of the velocities attribute
    */
@@ -230,6 +285,13 @@ public:
    */
   void set_velocities(const std::vector<double>& velocities);
 
+  /**
+   * @brief Setter of the velocity of a single joint from a typed angular velocity
+   * @param velocity the velocity of the joint, e.g. 30.0_deg_s
+   * @param joint_index the index of the joint
+   */
+  void set_velocity(const units::AngularVelocity& velocity, unsigned int joint_index);
+
   /**
    * @brief Getter of the accelerations attribute
    */
@@ -330,7 +392,14 @@ public:
    * @param state JointState to add
    * @return the current JointState added the JointState given in argument
    */
-  JointState operator+(const JointState& state) const;
+  JointState operator+(const JointState& state) const&;
+
+  /**
+   * @brief Overload the + operator on a temporary JointState, reusing its storage for the result
+   * @param state JointState to add
+   * @return the current JointState added the JointState given in argument
+   */
+  JointState operator+(const JointState& state)&&;
 
   /**
    * @brief Overload the -= operator
@@ -344,7 +413,14 @@ public:
    * @param state JointState to subtract
    * @return the current JointState subtracted the JointState given in argument
    */
-  JointState operator-(const JointState& state) const;
+  JointState operator-(const JointState& state) const&;
+
+  /**
+   * @brief Overload the - operator on a temporary JointState, reusing its storage for the result
+   * @param state JointState to subtract
+   * @return the current JointState subtracted the JointState given in argument
+   */
+  JointState operator-(const JointState& state)&&;
 
   /**
    * @brief Overload the *= operator with a double gain
@@ -358,7 +434,14 @@ public:
    * @param lambda the gain to multiply with
    * @return the JointState multiplied by lambda
    */
-  JointState operator*(double lambda) const;
+  JointState operator*(double lambda) const&;
+
+  /**
+   * @brief Overload the * operator with a double gain on a temporary JointState, reusing its storage for the result
+   * @param lambda the gain to multiply with
+   * @return the JointState multiplied by lambda
+   */
+  JointState operator*(double lambda)&&;
 
   /**
    * @brief Overload the *= operator with an array of gains
@@ -400,7 +483,14 @@ public:
    * @param lambda the scalar to divide with
    * @return the JointState divided by lambda
    */
-  JointState operator/(double lambda) const;
+  JointState operator/(double lambda) const&;
+
+  /**
+   * @brief Overload the / operator with a scalar on a temporary JointState, reusing its storage for the result
+   * @param lambda the scalar to divide with
+   * @return the JointState divided by lambda
+   */
+  JointState operator/(double lambda)&&;
 
   /**
    * @brief Compute the distance to another state as the sum of distances between each features
@@ -426,6 +516,13 @@ public:
    */
   friend JointState operator*(double lambda, const JointState& state);
 
+  /**
+   * @brief Overload the * operator with a scalar on a temporary JointState, reusing its storage for the result
+   * @param lambda the scalar to multiply with
+   * @return the JointState provided multiply by lambda
+   */
+  friend JointState operator*(double lambda, JointState&& state);
+
   /**
    * @brief Overload the * operator with an array of gains
    * @param lambda the gain array to multiply with
@@ -468,6 +565,11 @@ inline JointState& JointState::operator=(const JointState& state) {
   return *this;
 }
 
+inline JointState& JointState::operator=(JointState&& state) {
+  swap(*this, state);
+  return *this;
+}
+
 inline Eigen::VectorXd JointState::get_all_state_variables() const {
   Eigen::VectorXd all_fields(this->get_size() * 4);
   all_fields << this->get_positions(), this->get_velocities(), this->get_accelerations(), this->get_torques();
@@ -488,6 +590,17 @@ inline void JointState::set_state_variable(Eigen::VectorXd& state_variable, cons
   this->set_state_variable(state_variable, Eigen::VectorXd::Map(new_value.data(), new_value.size()));
 }
 
+inline void
+JointState::set_state_variable(Eigen::VectorXd& state_variable, double new_value, unsigned int joint_index) {
+  if (joint_index >= this->get_size()) {
+    throw IncompatibleSizeException(
+        "Index of the joint out of range: expected less than " + std::to_string(this->get_size()) + ", given "
+            + std::to_string(joint_index));
+  }
+  this->set_filled();
+  state_variable(joint_index) = new_value;
+}
+
 inline void JointState::set_all_state_variables(const Eigen::VectorXd& new_values) {
   this->set_positions(new_values.segment(0, this->get_size()));
   this->set_velocities(new_values.segment(this->get_size(), this->get_size()));
@@ -496,22 +609,20 @@ inline void JointState::set_all_state_variables(const Eigen::VectorXd& new_value
 }
 
 inline bool JointState::is_compatible(const State& state) const {
-  bool compatible = this->State::is_compatible(state);
-  compatible = compatible && (this->names_.size() == dynamic_cast<const JointState&>(state).names_.size());
-  if (compatible) {
-    for (unsigned int i = 0; i < this->names_.size(); ++i) {
-      compatible = (compatible && this->names_[i] == dynamic_cast<const JointState&>(state).names_[i]);
-    }
+  if (state.get_type() == StateType::FIXEDJOINTSTATE) {
+    // the size of a FixedJointState is a template parameter, such that it checks the compatibility itself
+    return state.is_compatible(*this);
   }
-  return compatible;
+  // joint names are interned, such that identical names and order share the same table
+  return this->State::is_compatible(state) && this->names_ == dynamic_cast<const JointState&>(state).names_;
 }
 
 inline unsigned int JointState::get_size() const {
-  return this->names_.size();
+  return this->names_->size();
 }
 
 inline const std::vector<std::string>& JointState::get_names() const {
-  return this->names_;
+  return *this->names_;
 }
 
 inline void JointState::set_names(unsigned int nb_joints) {
@@ -520,10 +631,7 @@ inline void JointState::set_names(unsigned int nb_joints) {
         "Input number of joints is of incorrect size, expected " + std::to_string(this->get_size()) + " got "
             + std::to_string(nb_joints));
   }
-  this->names_.resize(nb_joints);
-  for (unsigned int i = 0; i < nb_joints; ++i) {
-    this->names_[i] = "joint" + std::to_string(i);
-  }
+  this->names_ = joint_names::intern(nb_joints);
 }
 
 inline void JointState::set_names(const std::vector<std::string>& names) {
@@ -532,7 +640,21 @@ inline void JointState::set_names(const std::vector<std::string>& names) {
         "Input number of joints is of incorrect size, expected " + std::to_string(this->get_size()) + " got "
             + std::to_string(names.size()));
   }
-  this->names_ = names;
+  this->names_ = joint_names::intern(names);
+}
+
+inline const SharedJointNames& JointState::get_shared_names() const {
+  return this->names_;
+}
+
+inline void JointState::set_shared_names(const SharedJointNames& names) {
+  SharedJointNames table = joint_names::intern(names);
+  if (this->get_size() != table->size()) {
+    throw exceptions::IncompatibleSizeException(
+        "Input number of joints is of incorrect size, expected " + std::to_string(this->get_size()) + " got "
+            + std::to_string(table->size()));
+  }
+  this->names_ = std::move(table);
 }
 
 inline const Eigen::VectorXd& JointState::get_positions() const {
@@ -547,6 +669,10 @@ inline void JointState::set_positions(const std::vector<double>& positions) {
   this->set_state_variable(this->positions_, positions);
 }
 
+inline void JointState::set_position(const units::Angle& position, unsigned int joint_index) {
+  this->set_state_variable(this->positions_, position.get_unwrapped_value(), joint_index);
+}
+
 inline const Eigen::VectorXd& JointState::get_velocities() const {
   return this->velocities_;
 }
@@ -559,6 +685,10 @@ inline void JointState::set_velocities(const std::vector<double>& velocities) {
   this->set_state_variable(this->velocities_, velocities);
 }
 
+inline void JointState::set_velocity(const units::AngularVelocity& velocity, unsigned int joint_index) {
+  this->set_state_variable(this->velocities_, velocity.get_value(), joint_index);
+}
+
 inline const Eigen::VectorXd& JointState::get_accelerations() const {
   return this->accelerations_;
 }
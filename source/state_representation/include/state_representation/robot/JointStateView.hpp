@@ -0,0 +1,96 @@
+#pragma once
+
+#include "state_representation/robot/JointState.hpp"
+
+namespace state_representation {
+/**
+ * @class JointStateView
+ * @brief Read-only view of joint state variables stored in an external buffer, such as a
+ * driver packet in shared memory or a NumPy array. The view does not own nor copy the
+ * memory, which has to outlive it
+ */
+class JointStateView {
+private:
+  unsigned int size_;                               ///< number of joints
+  Eigen::Map<const Eigen::VectorXd> positions_;     ///< view of the joints positions
+  Eigen::Map<const Eigen::VectorXd> velocities_;    ///< view of the joints velocities
+  Eigen::Map<const Eigen::VectorXd> accelerations_; ///< view of the joints accelerations
+  Eigen::Map<const Eigen::VectorXd> torques_;       ///< view of the joints torques
+
+public:
+  /**
+   * @brief Constructor of a view over a contiguous buffer with the layout of JointState::data(),
+   * i.e. positions, velocities, accelerations and torques of each nb_joints values
+   * @param data pointer to the first of the 4 * nb_joints values
+   * @param nb_joints the number of joints
+   */
+  explicit JointStateView(const double* data, unsigned int nb_joints);
+
+  /**
+   * @brief Constructor of a view over a separate buffer per state variable. A null pointer
+   * leaves the corresponding state variable out of the view
+   * @param nb_joints the number of joints
+   * @param positions pointer to the nb_joints positions or nullptr
+   * @param velocities pointer to the nb_joints velocities or nullptr
+   * @param accelerations pointer to the nb_joints accelerations or nullptr
+   * @param torques pointer to the nb_joints torques or nullptr
+   */
+  explicit JointStateView(unsigned int nb_joints,
+                          const double* positions,
+                          const double* velocities = nullptr,
+                          const double* accelerations = nullptr,
+                          const double* torques = nullptr);
+
+  /**
+   * @brief Getter of the number of joints
+   */
+  unsigned int get_size() const;
+
+  /**
+   * @brief Getter of the view of the positions, empty if not part of the view
+   */
+  const Eigen::Map<const Eigen::VectorXd>& get_positions() const;
+
+  /**
+   * @brief Getter of the view of the velocities, empty if not part of the view
+   */
+  const Eigen::Map<const Eigen::VectorXd>& get_velocities() const;
+
+  /**
+   * @brief Getter of the view of the accelerations, empty if not part of the view
+   */
+  const Eigen::Map<const Eigen::VectorXd>& get_accelerations() const;
+
+  /**
+   * @brief Getter of the view of the torques, empty if not part of the view
+   */
+  const Eigen::Map<const Eigen::VectorXd>& get_torques() const;
+
+  /**
+   * @brief Copy the viewed state variables into the existing storage of a JointState, without
+   * any allocation. The state variables that are not part of the view are left untouched
+   * @param state the JointState to copy into, of the same size as the view
+   */
+  void copy_to(JointState& state) const;
+};
+
+inline unsigned int JointStateView::get_size() const {
+  return this->size_;
+}
+
+inline const Eigen::Map<const Eigen::VectorXd>& JointStateView::get_positions() const {
+  return this->positions_;
+}
+
+inline const Eigen::Map<const Eigen::VectorXd>& JointStateView::get_velocities() const {
+  return this->velocities_;
+}
+
+inline const Eigen::Map<const Eigen::VectorXd>& JointStateView::get_accelerations() const {
+  return this->accelerations_;
+}
+
+inline const Eigen::Map<const Eigen::VectorXd>& JointStateView::get_torques() const {
+  return this->torques_;
+}
+}// namespace state_representation
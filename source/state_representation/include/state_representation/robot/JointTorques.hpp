@@ -20,9 +20,11 @@ public:
   const Eigen::VectorXd& get_positions() const = delete;
   void set_positions(const Eigen::VectorXd& positions) = delete;
   void set_positions(const std::vector<double>& positions) = delete;
+  void set_position(const units::Angle& position, unsigned int joint_index) = delete;
   const Eigen::VectorXd& get_velocities() const = delete;
   void set_velocities(const Eigen::VectorXd& velocities) = delete;
   void set_velocities(const std::vector<double>& velocities) = delete;
+  void set_velocity(const units::AngularVelocity& velocity, unsigned int joint_index) = delete;
   const Eigen::VectorXd& get_accelerations() const = delete;
   void set_accelerations(const Eigen::VectorXd& accelerations) = delete;
   void set_accelerations(const std::vector<double>& accelerations) = delete;
@@ -62,16 +64,35 @@ public:
   explicit JointTorques(const std::string& robot_name, const std::vector<std::string>& joint_names,
                         const Eigen::VectorXd& torques);
 
+  /**
+   * @brief Constructor with name, a shared table of joint names and torque values provided
+   * @brief name the name of the state
+   * @brief joint_names shared table of joint names
+   * @brief torques the vector of torques
+   */
+  explicit JointTorques(const std::string& robot_name, const SharedJointNames& joint_names,
+                        const Eigen::VectorXd& torques);
+
   /**
    * @brief Copy constructor
    */
   JointTorques(const JointTorques& torques);
 
+  /**
+   * @brief Move constructor
+   */
+  JointTorques(JointTorques&& torques) = default;
+
   /**
    * @brief Copy constructor from a JointState
    */
   JointTorques(const JointState& state);
 
+  /**
+   * @brief Move constructor from a JointState, reusing its storage
+   */
+  JointTorques(JointState&& state);
+
   /**
    * @brief Constructor for the zero JointTorques
    * @param robot_name the name of the associated robot
@@ -111,6 +132,13 @@ public:
    */
   JointTorques& operator=(const JointTorques& torques) = default;
 
+  /**
+   * @brief Move assignment operator
+   * @param torques the state with value to assign
+   * @return reference to the current state with new values
+   */
+  JointTorques& operator=(JointTorques&& torques) = default;
+
   /**
    * @brief Overload the += operator
    * @param torques JointTorques to add
@@ -123,7 +151,14 @@ public:
    * @param torques JointTorques to add
    * @return the current JointTorques added the JointTorques given in argument
    */
-  JointTorques operator+(const JointTorques& torques) const;
+  JointTorques operator+(const JointTorques& torques) const&;
+
+  /**
+   * @brief Overload the + operator on a temporary JointTorques, reusing its storage for the result
+   * @param torques JointTorques to add
+   * @return the current JointTorques added the JointTorques given in argument
+   */
+  JointTorques operator+(const JointTorques& torques)&&;
 
   /**
    * @brief Overload the -= operator
@@ -137,7 +172,14 @@ public:
    * @param torques JointTorques to subtract
    * @return the current JointTorques subtracted the JointTorques given in argument
    */
-  JointTorques operator-(const JointTorques& torques) const;
+  JointTorques operator-(const JointTorques& torques) const&;
+
+  /**
+   * @brief Overload the - operator on a temporary JointTorques, reusing its storage for the result
+   * @param torques JointTorques to subtract
+   * @return the current JointTorques subtracted the JointTorques given in argument
+   */
+  JointTorques operator-(const JointTorques& torques)&&;
 
   /**
    * @brief Overload the *= operator with a double gain
@@ -151,7 +193,14 @@ public:
    * @param lambda the gain to multiply with
    * @return the JointTorques multiplied by lambda
    */
-  JointTorques operator*(double lambda) const;
+  JointTorques operator*(double lambda) const&;
+
+  /**
+   * @brief Overload the * operator with a double gain on a temporary JointTorques, reusing its storage for the result
+   * @param lambda the gain to multiply with
+   * @return the JointTorques multiplied by lambda
+   */
+  JointTorques operator*(double lambda)&&;
 
   /**
    * @brief Overload the *= operator with an array of gains
@@ -193,7 +242,14 @@ public:
    * @param lambda the scalar to divide with
    * @return the JointTorques divided by lambda
    */
-  JointTorques operator/(double lambda) const;
+  JointTorques operator/(double lambda) const&;
+
+  /**
+   * @brief Overload the / operator with a scalar on a temporary JointTorques, reusing its storage for the result
+   * @param lambda the scalar to divide with
+   * @return the JointTorques divided by lambda
+   */
+  JointTorques operator/(double lambda)&&;
 
   /**
    * @brief Return a copy of the JointTorques
@@ -256,6 +312,13 @@ public:
    */
   friend JointTorques operator*(double lambda, const JointTorques& torques);
 
+  /**
+   * @brief Overload the * operator with a scalar on a temporary JointTorques, reusing its storage for the result
+   * @param lambda the scalar to multiply with
+   * @return the JointTorques provided multiply by lambda
+   */
+  friend JointTorques operator*(double lambda, JointTorques&& torques);
+
   /**
    * @brief Overload the * operator with an array of gains
    * @param lambda the array to multiply with
@@ -23,6 +23,7 @@ public:
   const Eigen::VectorXd& get_positions() const = delete;
   void set_positions(const Eigen::VectorXd& positions) = delete;
   void set_positions(const std::vector<double>& positions) = delete;
+  void set_position(const units::Angle& position, unsigned int joint_index) = delete;
   const Eigen::VectorXd& get_accelerations() const = delete;
   void set_accelerations(const Eigen::VectorXd& accelerations) = delete;
   void set_accelerations(const std::vector<double>& accelerations) = delete;
@@ -65,16 +66,35 @@ public:
   explicit JointVelocities(const std::string& robot_name, const std::vector<std::string>& joint_names,
                            const Eigen::VectorXd& velocities);
 
+  /**
+   * @brief Constructor with name, a shared table of joint names and velocity values provided
+   * @brief name the name of the state
+   * @brief joint_names shared table of joint names
+   * @brief velocities the vector of velocities
+   */
+  explicit JointVelocities(const std::string& robot_name, const SharedJointNames& joint_names,
+                           const Eigen::VectorXd& velocities);
+
   /**
    * @brief Copy constructor
    */
   JointVelocities(const JointVelocities& velocities);
 
+  /**
+   * @brief Move constructor
+   */
+  JointVelocities(JointVelocities&& velocities) = default;
+
   /**
    * @brief Copy constructor from a JointState
    */
   JointVelocities(const JointState& state);
 
+  /**
+   * @brief Move constructor from a JointState, reusing its storage
+   */
+  JointVelocities(JointState&& state);
+
   /**
    * @brief Copy constructor from a JointPositions by considering that it is equivalent to dividing the positions by 1 second
    */
@@ -119,6 +139,13 @@ public:
    */
   JointVelocities& operator=(const JointVelocities& velocities) = default;
 
+  /**
+   * @brief Move assignment operator
+   * @param velocities the state with value to assign
+   * @return reference to the current state with new values
+   */
+  JointVelocities& operator=(JointVelocities&& velocities) = default;
+
   /**
    * @brief Overload the += operator
    * @param velocities JointVelocities to add
@@ -131,7 +158,14 @@ public:
    * @param velocities JointVelocities to add
    * @return the current JointVelocities added the JointVelocities given in argument
    */
-  JointVelocities operator+(const JointVelocities& velocities) const;
+  JointVelocities operator+(const JointVelocities& velocities) const&;
+
+  /**
+   * @brief Overload the + operator on a temporary JointVelocities, reusing its storage for the result
+   * @param velocities JointVelocities to add
+   * @return the current JointVelocities added the JointVelocities given in argument
+   */
+  JointVelocities operator+(const JointVelocities& velocities)&&;
 
   /**
    * @brief Overload the -= operator
@@ -145,7 +179,14 @@ public:
    * @param velocities JointVelocities to subtract
    * @return the current JointVelocities subtracted the JointVelocities given in argument
    */
-  JointVelocities operator-(const JointVelocities& velocities) const;
+  JointVelocities operator-(const JointVelocities& velocities) const&;
+
+  /**
+   * @brief Overload the - operator on a temporary JointVelocities, reusing its storage for the result
+   * @param velocities JointVelocities to subtract
+   * @return the current JointVelocities subtracted the JointVelocities given in argument
+   */
+  JointVelocities operator-(const JointVelocities& velocities)&&;
 
   /**
    * @brief Overload the *= operator with a double gain
@@ -159,7 +200,14 @@ public:
    * @param lambda the gain to multiply with
    * @return the JointVelocities multiplied by lambda
    */
-  JointVelocities operator*(double lambda) const;
+  JointVelocities operator*(double lambda) const&;
+
+  /**
+   * @brief Overload the * operator with a double gain on a temporary JointVelocities, reusing its storage for the result
+   * @param lambda the gain to multiply with
+   * @return the JointVelocities multiplied by lambda
+   */
+  JointVelocities operator*(double lambda)&&;
 
   /**
    * @brief Overload the *= operator with an array of gains
@@ -201,7 +249,14 @@ public:
    * @param lambda the scalar to divide with
    * @return the JointVelocities divided by lambda
    */
-  JointVelocities operator/(double lambda) const;
+  JointVelocities operator/(double lambda) const&;
+
+  /**
+   * @brief Overload the / operator with a scalar on a temporary JointVelocities, reusing its storage for the result
+   * @param lambda the scalar to divide with
+   * @return the JointVelocities divided by lambda
+   */
+  JointVelocities operator/(double lambda)&&;
 
   /**
    * @brief Overload the * operator with a time period
@@ -272,6 +327,13 @@ public:
    */
   friend JointVelocities operator*(double lambda, const JointVelocities& velocities);
 
+  /**
+   * @brief Overload the * operator with a scalar on a temporary JointVelocities, reusing its storage for the result
+   * @param lambda the scalar to multiply with
+   * @return the JointVelocities provided multiply by lambda
+   */
+  friend JointVelocities operator*(double lambda, JointVelocities&& velocities);
+
   /**
    * @brief Overload the * operator with an array of gains
    * @param lambda the array to multiply with
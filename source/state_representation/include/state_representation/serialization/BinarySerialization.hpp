@@ -0,0 +1,293 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "state_representation/geometry/Ellipsoid.hpp"
+#include "state_representation/parameters/ParameterInterface.hpp"
+#include "state_representation/robot/FixedJointState.hpp"
+#include "state_representation/robot/Jacobian.hpp"
+#include "state_representation/robot/JacobianView.hpp"
+#include "state_representation/robot/JointState.hpp"
+#include "state_representation/robot/JointStateView.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
+#include "state_representation/space/cartesian/CartesianStateView.hpp"
+#include "state_representation/trajectories/Trajectory.hpp"
+
+/**
+ * Compact binary encoding of the states. Each message is laid out as follows:
+ * - a header of 16 bytes: magic "SR", format version, message type, flags, state type,
+ *   size of the frame name table (uint16), number of doubles (uint32) and message size (uint32)
+ * - the frame name table, in which the names of the state and its frames are stored only once
+ * - the indices of the names in the table and the type specific fields (joint names, sizes)
+ * - padding to a multiple of 8 bytes followed by the packed doubles
+ * - the nested messages, if any (e.g. the points of a trajectory)
+ * All integers and doubles are little-endian and every message size is a multiple of 8 bytes,
+ * such that the doubles of a message encoded in an 8-byte aligned buffer can be viewed in place.
+ */
+namespace state_representation::serialization {
+/**
+ * @brief Version of the binary format written in the header of each message
+ */
+constexpr uint8_t BINARY_FORMAT_VERSION = 1;
+
+/**
+ * @enum MessageType
+ * @brief Type of the encoded object stored in the header of a message
+ */
+enum class MessageType : uint8_t {
+  STATE = 1,
+  CARTESIAN_STATE = 2,
+  JOINT_STATE = 3,
+  JACOBIAN = 4,
+  ELLIPSOID = 5,
+  PARAMETER = 6,
+  TRAJECTORY = 7
+};
+
+/**
+ * @brief Read the type of the message stored in a buffer
+ * @param buffer the buffer holding the message
+ * @param size the size of the buffer
+ * @return the type of the message
+ */
+MessageType get_message_type(const uint8_t* buffer, std::size_t size);
+
+/**
+ * @brief Compute the size of the message encoding the state, only the name, type and emptiness
+ * of the State are encoded
+ * @param state the state to encode
+ * @return the size of the message in bytes
+ */
+std::size_t get_encoded_size(const State& state);
+
+/**
+ * @copydoc get_encoded_size(const State&)
+ */
+std::size_t get_encoded_size(const CartesianState& state);
+
+/**
+ * @copydoc get_encoded_size(const State&)
+ */
+std::size_t get_encoded_size(const JointState& state);
+
+/**
+ * @copydoc get_encoded_size(const State&)
+ */
+std::size_t get_encoded_size(const Jacobian& state);
+
+/**
+ * @copydoc get_encoded_size(const State&)
+ */
+std::size_t get_encoded_size(const Ellipsoid& state);
+
+/**
+ * @copydoc get_encoded_size(const State&)
+ */
+std::size_t get_encoded_size(const ParameterInterface& state);
+
+/**
+ * @copydoc get_encoded_size(const State&)
+ */
+std::size_t get_encoded_size(const Trajectory<CartesianState>& state);
+
+/**
+ * @copydoc get_encoded_size(const State&)
+ */
+std::size_t get_encoded_size(const Trajectory<JointState>& state);
+
+/**
+ * @brief Encode the state into a preallocated buffer, without allocation. Only the name, type
+ * and emptiness of the State are encoded
+ * @param state the state to encode
+ * @param buffer the buffer to write into, 8-byte aligned to allow decoding views in place
+ * @param capacity the capacity of the buffer in bytes
+ * @return the number of bytes written
+ */
+std::size_t encode(const State& state, uint8_t* buffer, std::size_t capacity);
+
+/**
+ * @copydoc encode(const State&, uint8_t*, std::size_t)
+ */
+std::size_t encode(const CartesianState& state, uint8_t* buffer, std::size_t capacity);
+
+/**
+ * @copydoc encode(const State&, uint8_t*, std::size_t)
+ */
+std::size_t encode(const JointState& state, uint8_t* buffer, std::size_t capacity);
+
+/**
+ * @copydoc encode(const State&, uint8_t*, std::size_t)
+ */
+std::size_t encode(const Jacobian& state, uint8_t* buffer, std::size_t capacity);
+
+/**
+ * @copydoc encode(const State&, uint8_t*, std::size_t)
+ */
+std::size_t encode(const Ellipsoid& state, uint8_t* buffer, std::size_t capacity);
+
+/**
+ * @copydoc encode(const State&, uint8_t*, std::size_t)
+ */
+std::size_t encode(const ParameterInterface& state, uint8_t* buffer, std::size_t capacity);
+
+/**
+ * @copydoc encode(const State&, uint8_t*, std::size_t)
+ */
+std::size_t encode(const Trajectory<CartesianState>& state, uint8_t* buffer, std::size_t capacity);
+
+/**
+ * @copydoc encode(const State&, uint8_t*, std::size_t)
+ */
+std::size_t encode(const Trajectory<JointState>& state, uint8_t* buffer, std::size_t capacity);
+
+namespace detail {
+/**
+ * @brief Encode the state variables of a joint state as a JointState message, shared by the JointState and
+ * FixedJointState encoders. Without buffer it only computes the size of the message
+ * @param state the state of which the name, type and emptiness are encoded
+ * @param joint_names the names of the joints
+ * @param positions the positions of the joints
+ * @param velocities the velocities of the joints
+ * @param accelerations the accelerations of the joints
+ * @param torques the torques of the joints
+ * @param buffer the buffer to write into, or null to only compute the size
+ * @param capacity the capacity of the buffer in bytes
+ * @return the number of bytes written
+ */
+std::size_t encode_joint_state(const State& state, const std::vector<std::string>& joint_names,
+                               const double* positions, const double* velocities, const double* accelerations,
+                               const double* torques, uint8_t* buffer, std::size_t capacity);
+}// namespace detail
+
+/**
+ * @brief Encode the state into a preallocated buffer, without allocation. The message is a JointState message,
+ * such that it can be decoded into a JointState as well as into a FixedJointState of the same size
+ * @param state the state to encode
+ * @param buffer the buffer to write into, 8-byte aligned to allow decoding views in place
+ * @param capacity the capacity of the buffer in bytes
+ * @return the number of bytes written
+ */
+template<int N>
+std::size_t encode(const FixedJointState<N>& state, uint8_t* buffer, std::size_t capacity) {
+  return detail::encode_joint_state(state, state.get_names(), state.get_positions().data(),
+                                    state.get_velocities().data(), state.get_accelerations().data(),
+                                    state.get_torques().data(), buffer, capacity);
+}
+
+/**
+ * @copydoc get_encoded_size(const State&)
+ */
+template<int N>
+std::size_t get_encoded_size(const FixedJointState<N>& state) {
+  return encode(state, nullptr, 0);
+}
+
+/**
+ * @brief Encode an object into a newly allocated buffer
+ * @param object the object to encode
+ * @return the buffer holding the message
+ */
+template<class T>
+std::vector<uint8_t> encode(const T& object) {
+  std::vector<uint8_t> buffer(get_encoded_size(object));
+  encode(object, buffer.data(), buffer.size());
+  return buffer;
+}
+
+/**
+ * @brief Decode a message into an existing state. Only the name and emptiness of the State are decoded
+ * @param buffer the buffer holding the message
+ * @param size the size of the buffer
+ * @param state the state to decode into
+ * @return the number of bytes read
+ */
+std::size_t decode(const uint8_t* buffer, std::size_t size, State& state);
+
+/**
+ * @brief Decode a message into an existing state. The state keeps its storage and joint name table
+ * when the sizes and names of the message match, such that decoding a stream does not allocate
+ * @param buffer the buffer holding the message
+ * @param size the size of the buffer
+ * @param state the state to decode into
+ * @return the number of bytes read
+ */
+std::size_t decode(const uint8_t* buffer, std::size_t size, CartesianState& state);
+
+/**
+ * @copydoc decode(const uint8_t*, std::size_t, CartesianState&)
+ */
+std::size_t decode(const uint8_t* buffer, std::size_t size, JointState& state);
+
+/**
+ * @copydoc decode(const uint8_t*, std::size_t, CartesianState&)
+ */
+std::size_t decode(const uint8_t* buffer, std::size_t size, Jacobian& state);
+
+/**
+ * @copydoc decode(const uint8_t*, std::size_t, CartesianState&)
+ */
+std::size_t decode(const uint8_t* buffer, std::size_t size, Ellipsoid& state);
+
+/**
+ * @copydoc decode(const uint8_t*, std::size_t, CartesianState&)
+ */
+std::size_t decode(const uint8_t* buffer, std::size_t size, Trajectory<CartesianState>& state);
+
+/**
+ * @copydoc decode(const uint8_t*, std::size_t, CartesianState&)
+ */
+std::size_t decode(const uint8_t* buffer, std::size_t size, Trajectory<JointState>& state);
+
+/**
+ * @brief Decode a JointState message into an existing FixedJointState. The message is decoded through a JointState,
+ * such that it allocates
+ * @param buffer the buffer holding the message
+ * @param size the size of the buffer
+ * @param state the state to decode into, of the size of the encoded state
+ * @return the number of bytes read
+ */
+template<int N>
+std::size_t decode(const uint8_t* buffer, std::size_t size, FixedJointState<N>& state) {
+  JointState joint_state(state.get_name(), state.get_shared_names());
+  std::size_t nb_bytes = decode(buffer, size, joint_state);
+  state = FixedJointState<N>(joint_state);
+  return nb_bytes;
+}
+
+/**
+ * @brief Decode a parameter message into a new parameter of the encoded type
+ * @param buffer the buffer holding the message
+ * @param size the size of the buffer
+ * @return the decoded parameter
+ */
+std::shared_ptr<ParameterInterface> decode_parameter(const uint8_t* buffer, std::size_t size);
+
+/**
+ * @brief Decode a CartesianState message as a view over the doubles of the buffer, without copy.
+ * Requires a little-endian host and an 8-byte aligned buffer
+ * @param buffer the buffer holding the message, which has to outlive the view
+ * @param size the size of the buffer
+ * @return the view of the encoded state variables
+ */
+CartesianStateView decode_cartesian_state_view(const uint8_t* buffer, std::size_t size);
+
+/**
+ * @brief Decode a JointState message as a view over the doubles of the buffer, without copy.
+ * Requires a little-endian host and an 8-byte aligned buffer
+ * @param buffer the buffer holding the message, which has to outlive the view
+ * @param size the size of the buffer
+ * @return the view of the encoded state variables
+ */
+JointStateView decode_joint_state_view(const uint8_t* buffer, std::size_t size);
+
+/**
+ * @brief Decode a Jacobian message as a view over the doubles of the buffer, without copy.
+ * Requires a little-endian host and an 8-byte aligned buffer
+ * @param buffer the buffer holding the message, which has to outlive the view
+ * @param size the size of the buffer
+ * @return the view of the encoded matrix
+ */
+JacobianView decode_jacobian_view(const uint8_t* buffer, std::size_t size);
+}// namespace state_representation::serialization
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace state_representation::serialization {
+/**
+ * @brief Check if the host stores integers and doubles in little-endian byte order
+ */
+inline bool is_little_endian_host() {
+  const uint16_t value = 1;
+  uint8_t first_byte;
+  std::memcpy(&first_byte, &value, 1);
+  return first_byte == 1;
+}
+
+/**
+ * @brief Store an integer in little-endian byte order, whatever the byte order of the host
+ * @tparam T the type of the integer
+ * @param data the destination of the sizeof(T) bytes, without alignment requirement
+ * @param value the integer to store
+ */
+template<typename T>
+inline void store_little_endian(uint8_t* data, T value) {
+  static_assert(std::is_integral<T>::value, "Only integers can be stored in little-endian byte order");
+  auto bits = static_cast<typename std::make_unsigned<T>::type>(value);
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    data[i] = static_cast<uint8_t>(bits >> (8 * i));
+  }
+}
+
+/**
+ * @brief Load an integer stored in little-endian byte order, whatever the byte order of the host
+ * @tparam T the type of the integer
+ * @param data the source of the sizeof(T) bytes, without alignment requirement
+ * @return the integer
+ */
+template<typename T>
+inline T load_little_endian(const uint8_t* data) {
+  static_assert(std::is_integral<T>::value, "Only integers can be loaded in little-endian byte order");
+  typename std::make_unsigned<T>::type bits = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    bits |= static_cast<decltype(bits)>(data[i]) << (8 * i);
+  }
+  return static_cast<T>(bits);
+}
+}// namespace state_representation::serialization
@@ -0,0 +1,373 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <thread>
+
+#include "state_representation/serialization/BinarySerialization.hpp"
+
+/**
+ * Append-only log of timestamped states, organized in named channels. The file is laid out as follows:
+ * - a header of 32 bytes: magic "SRLOG", format version and size of the header
+ * - the records, each made of a header of 16 bytes (kind, channel, size of the payload and time in nanoseconds)
+ *   followed by its payload: the name of the channel for a channel declaration, or a binary message of the
+ *   serialization module for a state
+ * - when the log is closed, the index of each channel (its name, the times of its records and their offsets in
+ *   the file, stored as columns) and a trailer of 24 bytes pointing to the index
+ * Every record starts on an 8-byte boundary, such that the file can be memory mapped and the states viewed in place.
+ * A log that was not closed, e.g. after a crash, has no index and is read by scanning its complete records.
+ * The integers of the header, the records and the index are little-endian, as the messages of the serialization module.
+ */
+namespace state_representation::serialization {
+/**
+ * @brief Version of the log format written in the header of the file
+ */
+constexpr uint32_t STATE_LOG_FORMAT_VERSION = 1;
+
+/**
+ * @enum StateLogRecordKind
+ * @brief Kind of a record stored in its header
+ */
+enum class StateLogRecordKind : uint16_t {
+  CHANNEL = 1, ///< declaration of a channel
+  STATE = 2,   ///< timestamped state of a channel
+  PADDING = 3  ///< padding at the end of the queue of the writer, never written to the file
+};
+
+/**
+ * @class StateLogWriter
+ * @brief Writer of a state log. States are encoded by the calling thread in a preallocated lock-free
+ * single-producer single-consumer queue and written to the file by a background thread, such that
+ * writing from a control loop neither blocks nor allocates. All the writing methods have to be called
+ * from the same thread.
+ */
+class StateLogWriter {
+private:
+  FILE* file_;                               ///< the log file
+  std::unique_ptr<uint64_t[]> queue_;        ///< storage of the queue, 8-byte aligned
+  std::size_t capacity_;                     ///< capacity of the queue in bytes
+  std::atomic<std::size_t> head_;            ///< number of bytes pushed in the queue by the producer
+  std::atomic<std::size_t> tail_;            ///< number of bytes popped from the queue by the consumer
+  std::size_t pending_head_;                 ///< position of the record being encoded by the producer
+  std::chrono::microseconds flush_period_;   ///< period at which the queue is checked when it is empty
+  std::atomic<bool> stop_;                   ///< flag to stop the background thread
+  std::atomic<bool> failed_;                 ///< flag indicating that the background thread stopped on an error
+  std::exception_ptr error_;                 ///< error of the background thread, set before failed_
+  std::thread flush_thread_;                 ///< background thread writing the queue to the file
+  bool closed_;                              ///< flag indicating that the log is closed
+  std::size_t dropped_;                      ///< number of states dropped because the queue was full
+  std::vector<std::string> channel_names_;   ///< names of the channels, on the producer side
+  std::vector<int64_t> last_times_;          ///< time of the last record of each channel, on the producer side
+  std::size_t file_offset_;                  ///< current size of the file, on the consumer side
+  std::vector<std::string> index_names_;     ///< names of the channels, on the consumer side
+  std::vector<std::vector<int64_t>> index_times_;   ///< times of the records of each channel
+  std::vector<std::vector<uint64_t>> index_offsets_;///< offsets of the records of each channel in the file
+
+  /**
+   * @brief Reserve space in the queue for a record
+   * @param payload_size the size of the payload in bytes, a multiple of 8
+   * @return a pointer to the payload, or nullptr if the queue is full
+   */
+  uint8_t* reserve(std::size_t payload_size);
+
+  /**
+   * @brief Publish the record reserved last to the consumer
+   * @param kind the kind of record
+   * @param channel the index of the channel
+   * @param time the time of the record in nanoseconds
+   * @param payload_size the size of the payload in bytes
+   */
+  void commit(StateLogRecordKind kind, uint16_t channel, int64_t time, std::size_t payload_size);
+
+  /**
+   * @brief Check that the channel exists and that the time does not precede the last record of the channel
+   * @param channel the index of the channel
+   * @param time the time of the new record
+   */
+  void check_record(uint16_t channel, const std::chrono::nanoseconds& time) const;
+
+  /**
+   * @brief Rethrow on the calling thread the error that stopped the background thread, if any
+   */
+  void check_error() const;
+
+  /**
+   * @brief Write the records of the queue to the file, from the background thread
+   * @return true if records were written
+   */
+  bool drain();
+
+  /**
+   * @brief Loop of the background thread, which stops on the first error writing the file and keeps it
+   * to be rethrown by the next call of the writing methods
+   */
+  void run();
+
+  /**
+   * @brief Write the index of the channels and the trailer at the end of the file
+   */
+  void write_index();
+
+public:
+  /**
+   * @brief Create a log file, replacing any existing file, and start the background thread
+   * @param path the path of the file
+   * @param queue_capacity the capacity of the queue in bytes, which bounds the size of a single state
+   * @param flush_period the period at which the background thread checks the queue when it is empty
+   */
+  explicit StateLogWriter(const std::string& path,
+                          std::size_t queue_capacity = 1 << 22,
+                          const std::chrono::microseconds& flush_period = std::chrono::milliseconds(1));
+
+  StateLogWriter(const StateLogWriter&) = delete;
+
+  StateLogWriter& operator=(const StateLogWriter&) = delete;
+
+  /**
+   * @brief Destructor closing the log
+   */
+  ~StateLogWriter();
+
+  /**
+   * @brief Declare a new channel. This call may wait for space in the queue
+   * @param name the unique name of the channel
+   * @return the index of the channel, to be used to write its states
+   */
+  uint16_t add_channel(const std::string& name);
+
+  /**
+   * @brief Append a state to a channel, without blocking nor allocating
+   * @param channel the index of the channel
+   * @param time the time of the state, which cannot precede the time of the last state of the channel
+   * @param state the state to write
+   * @return false if the state was dropped because the queue was full
+   * @throws SerializationException if the background thread failed to write the file
+   */
+  template<class T>
+  bool write(uint16_t channel, const std::chrono::nanoseconds& time, const T& state);
+
+  /**
+   * @brief Append the points of a trajectory to a channel at the times of the trajectory.
+   * This call may wait for space in the queue
+   * @param channel the index of the channel
+   * @param trajectory the trajectory to write
+   * @param start_time the time added to the times of the points
+   */
+  template<class StateT>
+  void write_trajectory(uint16_t channel, const Trajectory<StateT>& trajectory,
+                        const std::chrono::nanoseconds& start_time = std::chrono::nanoseconds(0));
+
+  /**
+   * @brief Wait until all the pushed records are written to the file. Throws the error of the background thread
+   * if it failed to write the file
+   */
+  void flush();
+
+  /**
+   * @brief Write the remaining records and the index, then close the file. Any further write throws, as well as
+   * closing a log of which the background thread failed to write the file
+   */
+  void close();
+
+  /**
+   * @brief Getter of the number of states dropped because the queue was full
+   */
+  std::size_t get_dropped_count() const;
+};
+
+/**
+ * @class StateLogReader
+ * @brief Reader of a state log, which maps the file in memory. The states of a channel are accessed
+ * by index or looked up by time with a binary search on the time index of the channel.
+ */
+class StateLogReader {
+private:
+  struct Channel {
+    std::string name;                   ///< name of the channel
+    std::size_t size = 0;               ///< number of records of the channel
+    const int64_t* times = nullptr;     ///< times of the records, in the mapped index or in owned_times
+    const uint64_t* offsets = nullptr;  ///< offsets of the records, in the mapped index or in owned_offsets
+    std::vector<int64_t> owned_times;   ///< times of the records of a log without index or on a big-endian host
+    std::vector<uint64_t> owned_offsets;///< offsets of the records of a log without index or on a big-endian host
+  };
+
+  const uint8_t* data_;           ///< the mapped file
+  std::size_t size_;              ///< the size of the mapped file
+  bool indexed_;                  ///< flag indicating that the index was read from the file
+  std::vector<Channel> channels_; ///< the channels of the log
+
+  /**
+   * @brief Read the index at the end of the file
+   * @return false if the file has no valid index
+   */
+  bool read_index();
+
+  /**
+   * @brief Build the index by scanning the complete records of the file
+   */
+  void scan_records();
+
+  /**
+   * @brief Getter of a channel checking its index
+   * @param channel the index of the channel
+   */
+  const Channel& get_channel(uint16_t channel) const;
+
+public:
+  /**
+   * @brief Open and map a log file
+   * @param path the path of the file
+   */
+  explicit StateLogReader(const std::string& path);
+
+  StateLogReader(const StateLogReader&) = delete;
+
+  StateLogReader& operator=(const StateLogReader&) = delete;
+
+  /**
+   * @brief Destructor unmapping the file
+   */
+  ~StateLogReader();
+
+  /**
+   * @brief Check if the index was read from the file, i.e. if the log was closed properly
+   */
+  bool is_indexed() const;
+
+  /**
+   * @brief Getter of the number of channels
+   */
+  uint16_t get_number_of_channels() const;
+
+  /**
+   * @brief Getter of the name of a channel
+   * @param channel the index of the channel
+   */
+  const std::string& get_channel_name(uint16_t channel) const;
+
+  /**
+   * @brief Find a channel by name
+   * @param name the name of the channel
+   * @return the index of the channel
+   */
+  uint16_t find_channel(const std::string& name) const;
+
+  /**
+   * @brief Getter of the number of states of a channel
+   * @param channel the index of the channel
+   */
+  std::size_t get_size(uint16_t channel) const;
+
+  /**
+   * @brief Getter of the time of a state
+   * @param channel the index of the channel
+   * @param index the index of the state in the channel
+   */
+  std::chrono::nanoseconds get_time(uint16_t channel, std::size_t index) const;
+
+  /**
+   * @brief Find the last state of a channel at or before a time, in logarithmic time
+   * @param channel the index of the channel
+   * @param time the time to look up
+   * @return the index of the state, or -1 if the time precedes the first state of the channel
+   */
+  std::ptrdiff_t find_index(uint16_t channel, const std::chrono::nanoseconds& time) const;
+
+  /**
+   * @brief Getter of the encoded message of a state, which can be decoded in place with the view decoders
+   * @param channel the index of the channel
+   * @param index the index of the state in the channel
+   * @param size the size of the message
+   * @return a pointer to the message in the mapped file
+   */
+  const uint8_t* get_message(uint16_t channel, std::size_t index, std::size_t& size) const;
+
+  /**
+   * @brief Decode a state into an existing state, see decode
+   * @param channel the index of the channel
+   * @param index the index of the state in the channel
+   * @param state the state to decode into
+   */
+  template<class T>
+  void read(uint16_t channel, std::size_t index, T& state) const;
+
+  /**
+   * @brief Read the states of a channel in a time interval as a trajectory, the times of the
+   * points being the times of the states
+   * @param channel the index of the channel
+   * @param start_time the start of the interval
+   * @param end_time the end of the interval, included
+   * @return the trajectory
+   */
+  template<class StateT>
+  Trajectory<StateT> read_trajectory(uint16_t channel,
+                                     const std::chrono::nanoseconds& start_time = std::chrono::nanoseconds::min(),
+                                     const std::chrono::nanoseconds& end_time = std::chrono::nanoseconds::max()) const;
+};
+
+template<class T>
+bool StateLogWriter::write(uint16_t channel, const std::chrono::nanoseconds& time, const T& state) {
+  this->check_record(channel, time);
+  std::size_t size = get_encoded_size(state);
+  uint8_t* payload = this->reserve(size);
+  if (payload == nullptr) {
+    ++this->dropped_;
+    return false;
+  }
+  encode(state, payload, size);
+  this->commit(StateLogRecordKind::STATE, channel, time.count(), size);
+  this->last_times_[channel] = time.count();
+  return true;
+}
+
+template<class StateT>
+void StateLogWriter::write_trajectory(uint16_t channel, const Trajectory<StateT>& trajectory,
+                                      const std::chrono::nanoseconds& start_time) {
+  for (int i = 0; i < trajectory.get_size(); ++i) {
+    std::chrono::nanoseconds time = start_time + trajectory.get_times()[i];
+    const StateT& point = trajectory.get_points()[i];
+    this->check_record(channel, time);
+    std::size_t size = get_encoded_size(point);
+    uint8_t* payload;
+    while ((payload = this->reserve(size)) == nullptr) {
+      this->check_error();
+      std::this_thread::sleep_for(this->flush_period_);
+    }
+    encode(point, payload, size);
+    this->commit(StateLogRecordKind::STATE, channel, time.count(), size);
+    this->last_times_[channel] = time.count();
+  }
+}
+
+template<class T>
+void StateLogReader::read(uint16_t channel, std::size_t index, T& state) const {
+  std::size_t size;
+  const uint8_t* message = this->get_message(channel, index, size);
+  decode(message, size, state);
+}
+
+template<class StateT>
+Trajectory<StateT> StateLogReader::read_trajectory(uint16_t channel,
+                                                   const std::chrono::nanoseconds& start_time,
+                                                   const std::chrono::nanoseconds& end_time) const {
+  const Channel& log_channel = this->get_channel(channel);
+  Trajectory<StateT> trajectory(log_channel.name);
+  auto first = std::lower_bound(log_channel.times, log_channel.times + log_channel.size, start_time.count());
+  StateT point;
+  std::chrono::nanoseconds previous_time(0);
+  for (auto i = static_cast<std::size_t>(first - log_channel.times); i < log_channel.size; ++i) {
+    std::chrono::nanoseconds time(log_channel.times[i]);
+    if (time > end_time) {
+      break;
+    }
+    this->read(channel, i, point);
+    trajectory.add_point(point, time - previous_time);
+    previous_time = time;
+  }
+  return trajectory;
+}
+}// namespace state_representation::serialization
@@ -241,6 +241,17 @@ public:
    */
   Eigen::VectorXd data() const override;
 
+  /**
+   * @brief Getter of the position as a typed vector, referring to the position of the pose without copy
+   * @return the view on the position in meter
+   */
+  units::Vector3View<units::Distance> get_typed_position() const&;
+
+  /**
+   * @brief The view on the position of a temporary pose would dangle
+   */
+  units::Vector3View<units::Distance> get_typed_position() && = delete;
+
   /**
    * @brief Compute the norms of the state variable specified by the input type (default is full pose)
    * @param state_variable_type the type of state variable to compute the norms on
@@ -290,6 +301,10 @@ public:
   void from_std_vector(const std::vector<double>& value) override;
 };
 
+inline units::Vector3View<units::Distance> CartesianPose::get_typed_position() const& {
+  return units::Vector3View<units::Distance>(this->get_position());
+}
+
 inline std::vector<double> CartesianPose::norms(const CartesianStateVariable& state_variable_type) const {
   return CartesianState::norms(state_variable_type);
 }
@@ -7,6 +7,7 @@
 
 #include "state_representation/exceptions/IncompatibleSizeException.hpp"
 #include "state_representation/space/SpatialState.hpp"
+#include "state_representation/units/Vector3.hpp"
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/Dense>
 #include <iostream>
@@ -249,6 +250,20 @@ public:
    */
   void set_position(const double& x, const double& y, const double& z);
 
+  /**
+   * @brief Setter of the position from three typed coordinates, converted to meter at compile time for literals
+   * @param x the x coordinate
+   * @param y the y coordinate
+   * @param z the z coordinate
+   */
+  void set_position(const units::Distance& x, const units::Distance& y, const units::Distance& z);
+
+  /**
+   * @brief Setter of the position from a typed vector
+   * @param position the position
+   */
+  void set_position(const units::Distance3& position);
+
   /**
    * @brief Setter of the orientation
    */
@@ -294,11 +309,43 @@ public:
    */
   void set_linear_velocity(const Eigen::Vector3d& linear_velocity);
 
+  /**
+   * @brief Setter of the linear velocity from three typed coordinates, converted to m/s
+   * @param x the x coordinate
+   * @param y the y coordinate
+   * @param z the z coordinate
+   */
+  void set_linear_velocity(const units::LinearVelocity& x,
+                           const units::LinearVelocity& y,
+                           const units::LinearVelocity& z);
+
+  /**
+   * @brief Setter of the linear velocity from a typed vector
+   * @param linear_velocity the linear velocity
+   */
+  void set_linear_velocity(const units::Velocity3& linear_velocity);
+
   /**
    * @brief Setter of the angular velocity attribute
    */
   void set_angular_velocity(const Eigen::Vector3d& angular_velocity);
 
+  /**
+   * @brief Setter of the angular velocity from three typed coordinates, converted to rad/s
+   * @param x the x coordinate
+   * @param y the y coordinate
+   * @param z the z coordinate
+   */
+  void set_angular_velocity(const units::AngularVelocity& x,
+                            const units::AngularVelocity& y,
+                            const units::AngularVelocity& z);
+
+  /**
+   * @brief Setter of the angular velocity from a typed vector
+   * @param angular_velocity the angular velocity
+   */
+  void set_angular_velocity(const units::AngularVelocity3& angular_velocity);
+
   /**
    * @brief Setter of the linear and angular velocities from a 6d twist vector
    */
@@ -675,6 +722,15 @@ inline void CartesianState::set_position(const double& x, const double& y, const
   this->set_position(Eigen::Vector3d(x, y, z));
 }
 
+inline void
+CartesianState::set_position(const units::Distance& x, const units::Distance& y, const units::Distance& z) {
+  this->set_position(Eigen::Vector3d(x.get_value(), y.get_value(), z.get_value()));
+}
+
+inline void CartesianState::set_position(const units::Distance3& position) {
+  this->set_position(position.get_value());
+}
+
 inline void CartesianState::set_orientation(const Eigen::Quaterniond& orientation) {
   this->set_filled();
   this->orientation_ = orientation.normalized();
@@ -713,10 +769,30 @@ inline void CartesianState::set_linear_velocity(const Eigen::Vector3d& linear_ve
   this->set_state_variable(this->linear_velocity_, linear_velocity);
 }
 
+inline void CartesianState::set_linear_velocity(const units::LinearVelocity& x,
+                                                const units::LinearVelocity& y,
+                                                const units::LinearVelocity& z) {
+  this->set_linear_velocity(Eigen::Vector3d(x.get_value(), y.get_value(), z.get_value()));
+}
+
+inline void CartesianState::set_linear_velocity(const units::Velocity3& linear_velocity) {
+  this->set_linear_velocity(linear_velocity.get_value());
+}
+
 inline void CartesianState::set_angular_velocity(const Eigen::Vector3d& angular_velocity) {
   this->set_state_variable(this->angular_velocity_, angular_velocity);
 }
 
+inline void CartesianState::set_angular_velocity(const units::AngularVelocity& x,
+                                                 const units::AngularVelocity& y,
+                                                 const units::AngularVelocity& z) {
+  this->set_angular_velocity(Eigen::Vector3d(x.get_value(), y.get_value(), z.get_value()));
+}
+
+inline void CartesianState::set_angular_velocity(const units::AngularVelocity3& angular_velocity) {
+  this->set_angular_velocity(angular_velocity.get_value());
+}
+
 inline void CartesianState::set_twist(const Eigen::Matrix<double, 6, 1>& twist) {
   this->set_state_variable(this->linear_velocity_, this->angular_velocity_, twist);
 }
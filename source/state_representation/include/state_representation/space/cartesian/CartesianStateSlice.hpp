@@ -0,0 +1,243 @@
+#pragma once
+
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/space/cartesian/CartesianTwist.hpp"
+#include "state_representation/space/cartesian/CartesianWrench.hpp"
+
+namespace state_representation {
+/**
+ * @class CartesianStateSlice
+ * @brief Read-only slice of a CartesianState, referring to its state variables without copy, such that
+ * reading e.g. the twist of a feedback state does not copy the whole state as CartesianTwist(state) does.
+ * The sliced state has to outlive the slice, and the slice of a temporary state or of a state of another type,
+ * e.g. the twist of a CartesianPose, does not compile.
+ */
+class CartesianStateSlice {
+private:
+  const CartesianState* state_; ///< sliced state
+
+protected:
+  /**
+   * @brief Constructor with the sliced state
+   * @param state the sliced state
+   */
+  explicit CartesianStateSlice(const CartesianState& state);
+
+public:
+  /**
+   * @brief Getter of the sliced state
+   */
+  const CartesianState& get_state() const;
+
+  /**
+   * @brief Getter of the name of the sliced state
+   */
+  const std::string& get_name() const;
+
+  /**
+   * @brief Getter of the reference frame of the sliced state
+   */
+  const std::string& get_reference_frame() const;
+
+  /**
+   * @brief Check if the sliced state is empty
+   */
+  bool is_empty() const;
+};
+
+/**
+ * @class CartesianPoseSlice
+ * @brief Read-only slice of the pose of a CartesianState
+ */
+class CartesianPoseSlice : public CartesianStateSlice {
+public:
+  /**
+   * @brief Constructor with the sliced state
+   * @param state the sliced state
+   */
+  explicit CartesianPoseSlice(const CartesianState& state);
+
+  explicit CartesianPoseSlice(CartesianState&& state) = delete;
+
+  explicit CartesianPoseSlice(const CartesianTwist& state) = delete;
+
+  explicit CartesianPoseSlice(const CartesianWrench& state) = delete;
+
+  /**
+   * @brief Getter of the position of the sliced state
+   */
+  const Eigen::Vector3d& get_position() const;
+
+  /**
+   * @brief Getter of the position of the sliced state as a typed vector
+   */
+  units::Vector3View<units::Distance> get_typed_position() const;
+
+  /**
+   * @brief Getter of the orientation of the sliced state
+   */
+  const Eigen::Quaterniond& get_orientation() const;
+
+  /**
+   * @brief Copy the slice into a CartesianPose
+   * @return the pose of the sliced state
+   */
+  CartesianPose copy() const;
+};
+
+/**
+ * @class CartesianTwistSlice
+ * @brief Read-only slice of the twist of a CartesianState
+ */
+class CartesianTwistSlice : public CartesianStateSlice {
+public:
+  /**
+   * @brief Constructor with the sliced state
+   * @param state the sliced state
+   */
+  explicit CartesianTwistSlice(const CartesianState& state);
+
+  explicit CartesianTwistSlice(CartesianState&& state) = delete;
+
+  explicit CartesianTwistSlice(const CartesianPose& state) = delete;
+
+  explicit CartesianTwistSlice(const CartesianWrench& state) = delete;
+
+  /**
+   * @brief Getter of the linear velocity of the sliced state
+   */
+  const Eigen::Vector3d& get_linear_velocity() const;
+
+  /**
+   * @brief Getter of the linear velocity of the sliced state as a typed vector
+   */
+  units::Vector3View<units::LinearVelocity> get_typed_linear_velocity() const;
+
+  /**
+   * @brief Getter of the angular velocity of the sliced state
+   */
+  const Eigen::Vector3d& get_angular_velocity() const;
+
+  /**
+   * @brief Getter of the angular velocity of the sliced state as a typed vector
+   */
+  units::Vector3View<units::AngularVelocity> get_typed_angular_velocity() const;
+
+  /**
+   * @brief Copy the slice into a CartesianTwist
+   * @return the twist of the sliced state
+   */
+  CartesianTwist copy() const;
+};
+
+/**
+ * @class CartesianWrenchSlice
+ * @brief Read-only slice of the wrench of a CartesianState
+ */
+class CartesianWrenchSlice : public CartesianStateSlice {
+public:
+  /**
+   * @brief Constructor with the sliced state
+   * @param state the sliced state
+   */
+  explicit CartesianWrenchSlice(const CartesianState& state);
+
+  explicit CartesianWrenchSlice(CartesianState&& state) = delete;
+
+  explicit CartesianWrenchSlice(const CartesianPose& state) = delete;
+
+  explicit CartesianWrenchSlice(const CartesianTwist& state) = delete;
+
+  /**
+   * @brief Getter of the force of the sliced state
+   */
+  const Eigen::Vector3d& get_force() const;
+
+  /**
+   * @brief Getter of the torque of the sliced state
+   */
+  const Eigen::Vector3d& get_torque() const;
+
+  /**
+   * @brief Copy the slice into a CartesianWrench
+   * @return the wrench of the sliced state
+   */
+  CartesianWrench copy() const;
+};
+
+inline CartesianStateSlice::CartesianStateSlice(const CartesianState& state) :
+    state_(&state) {}
+
+inline const CartesianState& CartesianStateSlice::get_state() const {
+  return *this->state_;
+}
+
+inline const std::string& CartesianStateSlice::get_name() const {
+  return this->state_->get_name();
+}
+
+inline const std::string& CartesianStateSlice::get_reference_frame() const {
+  return this->state_->get_reference_frame();
+}
+
+inline bool CartesianStateSlice::is_empty() const {
+  return this->state_->is_empty();
+}
+
+inline CartesianPoseSlice::CartesianPoseSlice(const CartesianState& state) :
+    CartesianStateSlice(state) {}
+
+inline const Eigen::Vector3d& CartesianPoseSlice::get_position() const {
+  return this->get_state().get_position();
+}
+
+inline units::Vector3View<units::Distance> CartesianPoseSlice::get_typed_position() const {
+  return units::Vector3View<units::Distance>(this->get_position());
+}
+
+inline const Eigen::Quaterniond& CartesianPoseSlice::get_orientation() const {
+  return this->get_state().get_orientation();
+}
+
+inline CartesianPose CartesianPoseSlice::copy() const {
+  return CartesianPose(this->get_state());
+}
+
+inline CartesianTwistSlice::CartesianTwistSlice(const CartesianState& state) :
+    CartesianStateSlice(state) {}
+
+inline const Eigen::Vector3d& CartesianTwistSlice::get_linear_velocity() const {
+  return this->get_state().get_linear_velocity();
+}
+
+inline units::Vector3View<units::LinearVelocity> CartesianTwistSlice::get_typed_linear_velocity() const {
+  return units::Vector3View<units::LinearVelocity>(this->get_linear_velocity());
+}
+
+inline const Eigen::Vector3d& CartesianTwistSlice::get_angular_velocity() const {
+  return this->get_state().get_angular_velocity();
+}
+
+inline units::Vector3View<units::AngularVelocity> CartesianTwistSlice::get_typed_angular_velocity() const {
+  return units::Vector3View<units::AngularVelocity>(this->get_angular_velocity());
+}
+
+inline CartesianTwist CartesianTwistSlice::copy() const {
+  return CartesianTwist(this->get_state());
+}
+
+inline CartesianWrenchSlice::CartesianWrenchSlice(const CartesianState& state) :
+    CartesianStateSlice(state) {}
+
+inline const Eigen::Vector3d& CartesianWrenchSlice::get_force() const {
+  return this->get_state().get_force();
+}
+
+inline const Eigen::Vector3d& CartesianWrenchSlice::get_torque() const {
+  return this->get_state().get_torque();
+}
+
+inline CartesianWrench CartesianWrenchSlice::copy() const {
+  return CartesianWrench(this->get_state());
+}
+}// namespace state_representation
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "state_representation/space/cartesian/CartesianState.hpp"
+
+namespace state_representation {
+/**
+ * @class CartesianStateView
+ * @brief Read-only view of Cartesian state variables stored in an external buffer, such as a
+ * driver packet in shared memory or a NumPy array. The view does not own nor copy the
+ * memory, which has to outlive it. The orientation is expected in (w, x, y, z) order
+ */
+class CartesianStateView {
+private:
+  Eigen::Map<const Eigen::Matrix<double, 7, 1>> pose_;         ///< view of the pose
+  Eigen::Map<const Eigen::Matrix<double, 6, 1>> twist_;        ///< view of the twist
+  Eigen::Map<const Eigen::Matrix<double, 6, 1>> accelerations_;///< view of the accelerations
+  Eigen::Map<const Eigen::Matrix<double, 6, 1>> wrench_;       ///< view of the wrench
+
+public:
+  /**
+   * @brief Constructor of a view over a contiguous buffer with the layout of CartesianState::data(),
+   * i.e. pose (7), twist (6), accelerations (6) and wrench (6)
+   * @param data pointer to the first of the 25 values
+   */
+  explicit CartesianStateView(const double* data);
+
+  /**
+   * @brief Constructor of a view over a separate buffer per state variable. A null pointer
+   * leaves the corresponding state variable out of the view
+   * @param pose pointer to the 7 pose values or nullptr
+   * @param twist pointer to the 6 twist values or nullptr
+   * @param accelerations pointer to the 6 acceleration values or nullptr
+   * @param wrench pointer to the 6 wrench values or nullptr
+   */
+  explicit CartesianStateView(const double* pose,
+                              const double* twist,
+                              const double* accelerations = nullptr,
+                              const double* wrench = nullptr);
+
+  /**
+   * @brief Check if a state variable is part of the view
+   * @param state_variable_type the state variable to check among POSE, TWIST, ACCELERATIONS and WRENCH
+   */
+  bool has_state_variable(const CartesianStateVariable& state_variable_type) const;
+
+  /**
+   * @brief Getter of the view of the pose
+   */
+  const Eigen::Map<const Eigen::Matrix<double, 7, 1>>& get_pose() const;
+
+  /**
+   * @brief Getter of the view of the twist
+   */
+  const Eigen::Map<const Eigen::Matrix<double, 6, 1>>& get_twist() const;
+
+  /**
+   * @brief Getter of the view of the accelerations
+   */
+  const Eigen::Map<const Eigen::Matrix<double, 6, 1>>& get_accelerations() const;
+
+  /**
+   * @brief Getter of the view of the wrench
+   */
+  const Eigen::Map<const Eigen::Matrix<double, 6, 1>>& get_wrench() const;
+
+  /**
+   * @brief Copy the viewed state variables into a CartesianState, without any allocation.
+   * The state variables that are not part of the view are left untouched
+   * @param state the CartesianState to copy into
+   */
+  void copy_to(CartesianState& state) const;
+};
+
+inline const Eigen::Map<const Eigen::Matrix<double, 7, 1>>& CartesianStateView::get_pose() const {
+  return this->pose_;
+}
+
+inline const Eigen::Map<const Eigen::Matrix<double, 6, 1>>& CartesianStateView::get_twist() const {
+  return this->twist_;
+}
+
+inline const Eigen::Map<const Eigen::Matrix<double, 6, 1>>& CartesianStateView::get_accelerations() const {
+  return this->accelerations_;
+}
+
+inline const Eigen::Map<const Eigen::Matrix<double, 6, 1>>& CartesianStateView::get_wrench() const {
+  return this->wrench_;
+}
+}// namespace state_representation
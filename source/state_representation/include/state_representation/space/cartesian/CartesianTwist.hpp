@@ -224,6 +224,20 @@ public:
    */
   void clamp(double max_linear, double max_angular, double linear_noise_ratio = 0, double angular_noise_ratio = 0);
 
+  /**
+   * @brief Clamp inplace the magnitude of the twist to typed limits, e.g. 0.5_m_s and 90.0_deg_s
+   * @param max_linear the maximum magnitude of the linear velocity
+   * @param max_angular the maximum magnitude of the angular velocity
+   * @param linear_noise_ratio if provided, this value will be used to apply a deadzone under which
+   * the linear velocity will be set to 0
+   * @param angular_noise_ratio if provided, this value will be used to apply a deadzone under which
+   * the angular velocity will be set to 0
+   */
+  void clamp(const units::LinearVelocity& max_linear,
+             const units::AngularVelocity& max_angular,
+             double linear_noise_ratio = 0,
+             double angular_noise_ratio = 0);
+
   /**
    * @brief Return the clamped twist
    * @param max_linear the maximum magnitude of the linear velocity
@@ -257,6 +271,29 @@ public:
    */
   CartesianTwist inverse() const;
 
+  /**
+   * @brief Getter of the linear velocity as a typed vector, referring to the linear velocity of the twist without copy
+   * @return the view on the linear velocity in m/s
+   */
+  units::Vector3View<units::LinearVelocity> get_typed_linear_velocity() const&;
+
+  /**
+   * @brief The view on the linear velocity of a temporary twist would dangle
+   */
+  units::Vector3View<units::LinearVelocity> get_typed_linear_velocity() && = delete;
+
+  /**
+   * @brief Getter of the angular velocity as a typed vector, referring to the angular velocity of the twist without
+   * copy
+   * @return the view on the angular velocity in rad/s
+   */
+  units::Vector3View<units::AngularVelocity> get_typed_angular_velocity() const&;
+
+  /**
+   * @brief The view on the angular velocity of a temporary twist would dangle
+   */
+  units::Vector3View<units::AngularVelocity> get_typed_angular_velocity() && = delete;
+
   /**
    * @brief Compute the norms of the state variable specified by the input type (default is full twist)
    * @param state_variable_type the type of state variable to compute the norms on
@@ -308,6 +345,14 @@ public:
   friend CartesianPose operator*(const std::chrono::nanoseconds& dt, const CartesianTwist& twist);
 };
 
+inline units::Vector3View<units::LinearVelocity> CartesianTwist::get_typed_linear_velocity() const& {
+  return units::Vector3View<units::LinearVelocity>(this->get_linear_velocity());
+}
+
+inline units::Vector3View<units::AngularVelocity> CartesianTwist::get_typed_angular_velocity() const& {
+  return units::Vector3View<units::AngularVelocity>(this->get_angular_velocity());
+}
+
 inline std::vector<double> CartesianTwist::norms(const CartesianStateVariable& state_variable_type) const {
   return CartesianState::norms(state_variable_type);
 }
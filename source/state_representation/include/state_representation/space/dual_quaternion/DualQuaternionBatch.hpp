@@ -0,0 +1,165 @@
+#pragma once
+
+#include <vector>
+
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+
+namespace state_representation {
+/**
+ * @class DualQuaternionBatch
+ * @brief Batch of unit dual quaternions representing rigid transformations, stored as a structure of arrays:
+ * each of the 8 components (primary w, x, y, z then dual w, x, y, z) is a contiguous column of the data matrix.
+ * The batched operations are plain loops over those columns, without rotation matrices nor allocation, such that
+ * the compiler can vectorize them once the result has the right size. The result can alias the operands.
+ */
+class DualQuaternionBatch {
+private:
+  Eigen::Matrix<double, Eigen::Dynamic, 8> data_; ///< components of the dual quaternions, one column per component
+
+public:
+  /**
+   * @brief Constructor of a batch of identity transformations
+   * @param size the number of dual quaternions
+   */
+  explicit DualQuaternionBatch(std::size_t size = 0);
+
+  /**
+   * @brief Constructor of a batch from Cartesian poses
+   * @param poses the poses
+   */
+  explicit DualQuaternionBatch(const std::vector<CartesianPose>& poses);
+
+  /**
+   * @brief Getter of the number of dual quaternions
+   */
+  std::size_t get_size() const;
+
+  /**
+   * @brief Resize the batch, the new dual quaternions being identity transformations
+   * @param size the number of dual quaternions
+   */
+  void resize(std::size_t size);
+
+  /**
+   * @brief Getter of the data matrix, of size get_size() x 8
+   */
+  const Eigen::Matrix<double, Eigen::Dynamic, 8>& data() const;
+
+  /**
+   * @brief Getter of the data matrix, of size get_size() x 8
+   */
+  Eigen::Matrix<double, Eigen::Dynamic, 8>& data();
+
+  /**
+   * @brief Setter of a dual quaternion from a position and an orientation
+   * @param index the index of the dual quaternion
+   * @param position the position
+   * @param orientation the unit quaternion of the orientation
+   */
+  void set(std::size_t index, const Eigen::Vector3d& position, const Eigen::Quaterniond& orientation);
+
+  /**
+   * @brief Setter of a dual quaternion from a Cartesian pose
+   * @param index the index of the dual quaternion
+   * @param pose the pose
+   */
+  void set(std::size_t index, const CartesianPose& pose);
+
+  /**
+   * @brief Setter of a dual quaternion from the motion of a 1-dof joint, i.e. a rotation around its axis for
+   * a revolute joint or a translation along its axis for a prismatic joint
+   * @param index the index of the dual quaternion
+   * @param axis the unit axis of the joint
+   * @param position the angle of a revolute joint or the displacement of a prismatic joint
+   * @param prismatic true for a prismatic joint, false for a revolute joint
+   */
+  void set_joint_motion(std::size_t index, const Eigen::Vector3d& axis, double position, bool prismatic);
+
+  /**
+   * @brief Getter of the primary part, i.e. the orientation, of a dual quaternion
+   * @param index the index of the dual quaternion
+   */
+  Eigen::Quaterniond get_primary(std::size_t index) const;
+
+  /**
+   * @brief Getter of the dual part of a dual quaternion
+   * @param index the index of the dual quaternion
+   */
+  Eigen::Quaterniond get_dual(std::size_t index) const;
+
+  /**
+   * @brief Getter of the position of the transformation represented by a dual quaternion
+   * @param index the index of the dual quaternion
+   */
+  Eigen::Vector3d get_position(std::size_t index) const;
+
+  /**
+   * @brief Set the pose of a Cartesian pose from a dual quaternion, keeping its name and reference frame
+   * @param index the index of the dual quaternion
+   * @param pose the pose to set
+   */
+  void get_pose(std::size_t index, CartesianPose& pose) const;
+
+  /**
+   * @brief Set the poses of Cartesian poses from the batch, keeping their names and reference frames
+   * @param poses the poses to set, of the size of the batch
+   */
+  void to_poses(std::vector<CartesianPose>& poses) const;
+
+  /**
+   * @brief Compute the products of the dual quaternions of two batches of the same size, element by element
+   * @param lhs the left-hand side operands
+   * @param rhs the right-hand side operands
+   * @param result the products lhs[i] * rhs[i], resized if needed
+   */
+  static void multiply(const DualQuaternionBatch& lhs, const DualQuaternionBatch& rhs, DualQuaternionBatch& result);
+
+  /**
+   * @brief Compute the conjugates, i.e. the inverse transformations, of the dual quaternions of a batch
+   * @param batch the dual quaternions
+   * @param result the conjugates, resized if needed
+   */
+  static void conjugate(const DualQuaternionBatch& batch, DualQuaternionBatch& result);
+
+  /**
+   * @brief Compute the screw linear interpolation (ScLERP) between the dual quaternions of two batches,
+   * element by element. The interpolated transformations move along the screw motion from start to end,
+   * with a constant rotation and translation rate along the screw axis
+   * @param start the start transformations
+   * @param end the end transformations
+   * @param t the interpolation parameter between 0 (start) and 1 (end)
+   * @param result the interpolated transformations, resized if needed
+   */
+  static void sclerp(const DualQuaternionBatch& start, const DualQuaternionBatch& end, double t,
+                     DualQuaternionBatch& result);
+
+  /**
+   * @brief Compute the cumulative products of the dual quaternions of a batch, i.e. the transformations
+   * of a kinematic chain given the relative transformations of its successive links
+   * @param batch the relative transformations
+   * @param result the products batch[0] * ... * batch[i], resized if needed
+   */
+  static void chain(const DualQuaternionBatch& batch, DualQuaternionBatch& result);
+
+  /**
+   * @brief Compute the transformations of the links of a kinematic tree given the relative transformations
+   * of each link with respect to its parent
+   * @param batch the relative transformations
+   * @param parents the index of the parent of each link, lower than the index of the link, or -1 for a root
+   * @param result the products result[parents[i]] * batch[i], resized if needed
+   */
+  static void chain(const DualQuaternionBatch& batch, const std::vector<int>& parents, DualQuaternionBatch& result);
+};
+
+inline std::size_t DualQuaternionBatch::get_size() const {
+  return static_cast<std::size_t>(this->data_.rows());
+}
+
+inline const Eigen::Matrix<double, Eigen::Dynamic, 8>& DualQuaternionBatch::data() const {
+  return this->data_;
+}
+
+inline Eigen::Matrix<double, Eigen::Dynamic, 8>& DualQuaternionBatch::data() {
+  return this->data_;
+}
+}// namespace state_representation
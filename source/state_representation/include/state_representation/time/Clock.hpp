@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace state_representation {
+/**
+ * @class Clock
+ * @brief Interface of the time sources of the timestamps of the states. The time points are expressed as
+ * steady clock time points, such that the timestamps of the states keep their type whatever the source.
+ */
+class Clock {
+public:
+  using time_point = std::chrono::time_point<std::chrono::steady_clock>;
+
+  /**
+   * @brief Virtual destructor
+   */
+  virtual ~Clock() = default;
+
+  /**
+   * @brief Get the current time of the clock
+   */
+  virtual time_point now() const = 0;
+};
+
+/**
+ * @class SteadyClock
+ * @brief Real time source reading the monotonic std::chrono::steady_clock
+ */
+class SteadyClock : public Clock {
+public:
+  /**
+   * @brief Get the current time of the steady clock
+   */
+  time_point now() const override;
+};
+
+/**
+ * @class SimulatedClock
+ * @brief Manually stepped time source for deterministic replay and faster than real time simulation, the time
+ * only changing with step or set_time. The clock can be stepped by one thread while others read it.
+ */
+class SimulatedClock : public Clock {
+private:
+  std::atomic<int64_t> time_; ///< time since the epoch of the steady clock [ns]
+
+public:
+  /**
+   * @brief Constructor with the initial time
+   * @param start the initial time, by default the epoch of the steady clock
+   */
+  explicit SimulatedClock(const time_point& start = time_point());
+
+  /**
+   * @brief Get the current simulated time
+   */
+  time_point now() const override;
+
+  /**
+   * @brief Advance the simulated time
+   * @param period the time step, e.g. the period of the control loop
+   * @return the new simulated time
+   */
+  time_point step(const std::chrono::nanoseconds& period);
+
+  /**
+   * @brief Setter of the simulated time, e.g. to the time of a replayed record
+   * @param time the new time
+   */
+  void set_time(const time_point& time);
+};
+
+/**
+ * @class SharedMemoryClock
+ * @brief Time source driven by a counter of hardware ticks in shared memory, e.g. incremented by the driver of
+ * the robot at each cycle of its controller. The time is the number of ticks times the period of a tick, such that
+ * a whole control stack runs at the pace of the process incrementing the counter.
+ */
+class SharedMemoryClock : public Clock {
+private:
+  const std::atomic<uint64_t>* ticks_; ///< counter of ticks
+  std::chrono::nanoseconds period_;    ///< period of a tick
+  void* mapping_;                      ///< mapped shared memory, or null if the counter is not owned
+  std::size_t mapping_size_;           ///< size of the mapped shared memory
+
+public:
+  /**
+   * @brief Constructor with a counter already in memory, which has to outlive the clock
+   * @param ticks the counter of ticks
+   * @param period the period of a tick
+   */
+  explicit SharedMemoryClock(const std::atomic<uint64_t>* ticks, const std::chrono::nanoseconds& period);
+
+  /**
+   * @brief Constructor with a POSIX shared memory object holding the counter, mapped read only
+   * @param name the name of the shared memory object, e.g. "/robot_ticks"
+   * @param period the period of a tick
+   * @param offset the offset of the counter in the shared memory object, aligned on 8 bytes
+   */
+  explicit SharedMemoryClock(const std::string& name, const std::chrono::nanoseconds& period, std::size_t offset = 0);
+
+  SharedMemoryClock(const SharedMemoryClock&) = delete;
+
+  SharedMemoryClock& operator=(const SharedMemoryClock&) = delete;
+
+  /**
+   * @brief Destructor unmapping the shared memory
+   */
+  ~SharedMemoryClock() override;
+
+  /**
+   * @brief Get the current time from the counter of ticks
+   */
+  time_point now() const override;
+
+  /**
+   * @brief Getter of the current number of ticks
+   */
+  uint64_t get_ticks() const;
+
+  /**
+   * @brief Getter of the period of a tick
+   */
+  const std::chrono::nanoseconds& get_period() const;
+};
+
+inline Clock::time_point SteadyClock::now() const {
+  return std::chrono::steady_clock::now();
+}
+
+inline Clock::time_point SimulatedClock::now() const {
+  return time_point(std::chrono::nanoseconds(this->time_.load(std::memory_order_acquire)));
+}
+
+inline Clock::time_point SharedMemoryClock::now() const {
+  return time_point(this->period_ * static_cast<int64_t>(this->get_ticks()));
+}
+
+inline uint64_t SharedMemoryClock::get_ticks() const {
+  return this->ticks_->load(std::memory_order_acquire);
+}
+
+inline const std::chrono::nanoseconds& SharedMemoryClock::get_period() const {
+  return this->period_;
+}
+}// namespace state_representation
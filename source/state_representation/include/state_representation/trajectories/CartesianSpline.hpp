@@ -0,0 +1,138 @@
+#pragma once
+
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/trajectories/CubicSpline.hpp"
+#include "state_representation/trajectories/Trajectory.hpp"
+
+namespace state_representation {
+/**
+ * @class CartesianSpline
+ * @brief Smooth Cartesian trajectory interpolating poses, with a cubic spline on the positions and a spherical
+ * quadrangle interpolation (SQUAD) on the orientations, both at rest at the ends of the trajectory
+ */
+class CartesianSpline {
+private:
+  std::string name_;                             ///< name of the frame
+  std::string reference_frame_;                  ///< name of the reference frame
+  CubicSpline position_spline_;                  ///< spline of the positions, holding the knot times
+  std::vector<Eigen::Quaterniond> orientations_; ///< orientations at the knots, in the same hemisphere
+  std::vector<Eigen::Quaterniond> controls_;     ///< intermediate control quaternions of the SQUAD
+
+  /**
+   * @brief Compute the control quaternions of the SQUAD from the orientations at the knots
+   */
+  void compute_controls();
+
+  /**
+   * @brief Compute the maximum angular velocity and acceleration, sampled on each segment
+   * @return the maximum norms of the angular velocity and acceleration
+   */
+  std::pair<double, double> max_angular_velocity_and_acceleration() const;
+
+  /**
+   * @brief Interpolate the orientation at a time in seconds
+   * @param time the time in seconds
+   * @return the orientation
+   */
+  Eigen::Quaterniond interpolate_orientation(double time) const;
+
+public:
+  /**
+   * @brief Empty constructor
+   */
+  CartesianSpline() = default;
+
+  /**
+   * @brief Fit the spline through the points of a trajectory, at the times of the trajectory
+   * @param trajectory the trajectory with at least two poses
+   */
+  explicit CartesianSpline(const Trajectory<CartesianPose>& trajectory);
+
+  /**
+   * @brief Fit the spline through waypoints and time it under the limits. The linear limits are applied
+   * on each axis of the position and the angular limits on the norm of the angular velocity and acceleration
+   * @param waypoints at least two poses
+   * @param max_linear_velocity the maximum linear velocity
+   * @param max_linear_acceleration the maximum linear acceleration
+   * @param max_angular_velocity the maximum angular velocity
+   * @param max_angular_acceleration the maximum angular acceleration
+   */
+  CartesianSpline(const std::vector<CartesianPose>& waypoints,
+                  double max_linear_velocity,
+                  double max_linear_acceleration,
+                  double max_angular_velocity,
+                  double max_angular_acceleration);
+
+  /**
+   * @brief Getter of the name of the frame
+   */
+  const std::string& get_name() const;
+
+  /**
+   * @brief Getter of the name of the reference frame
+   */
+  const std::string& get_reference_frame() const;
+
+  /**
+   * @brief Getter of the spline of the positions, with times in seconds
+   */
+  const CubicSpline& get_position_spline() const;
+
+  /**
+   * @brief Getter of the time of the first point
+   */
+  std::chrono::nanoseconds get_start_time() const;
+
+  /**
+   * @brief Getter of the duration of the spline
+   */
+  std::chrono::nanoseconds get_duration() const;
+
+  /**
+   * @brief Scale the time of the spline to the fastest timing that respects the limits, see the constructor
+   * @param max_linear_velocity the maximum linear velocity
+   * @param max_linear_acceleration the maximum linear acceleration
+   * @param max_angular_velocity the maximum angular velocity
+   * @param max_angular_acceleration the maximum angular acceleration
+   * @return the applied time scaling factor
+   */
+  double retime(double max_linear_velocity,
+                double max_linear_acceleration,
+                double max_angular_velocity,
+                double max_angular_acceleration);
+
+  /**
+   * @brief Sample the spline at the given time
+   * @param time the time at which to sample
+   * @return the Cartesian state with pose, twist and linear acceleration at the given time
+   */
+  CartesianState sample(const std::chrono::nanoseconds& time) const;
+
+  /**
+   * @brief Sample the poses of the whole spline at a constant period in one call
+   * @param period the sampling period
+   * @return the sampled poses as (x, y, z, qw, qx, qy, qz), one column per sample from the start to the end
+   * of the spline included
+   */
+  Eigen::MatrixXd sample_uniformly(const std::chrono::nanoseconds& period) const;
+
+  /**
+   * @brief Sample the spline at a constant period into a trajectory
+   * @param period the sampling period
+   * @return the trajectory of poses
+   */
+  Trajectory<CartesianPose> to_trajectory(const std::chrono::nanoseconds& period) const;
+};
+
+inline const std::string& CartesianSpline::get_name() const {
+  return this->name_;
+}
+
+inline const std::string& CartesianSpline::get_reference_frame() const {
+  return this->reference_frame_;
+}
+
+inline const CubicSpline& CartesianSpline::get_position_spline() const {
+  return this->position_spline_;
+}
+}// namespace state_representation
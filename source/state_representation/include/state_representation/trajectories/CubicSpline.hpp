@@ -0,0 +1,144 @@
+#pragma once
+
+#include <eigen3/Eigen/Core>
+
+namespace state_representation {
+/**
+ * @class CubicSpline
+ * @brief Twice continuously differentiable cubic spline interpolating points of dimension n at increasing
+ * knot times (in seconds), with prescribed velocities at both ends (rest to rest by default). The spline is
+ * stored as the points and the second derivatives at the knots, such that it can be evaluated at many times
+ * in one call and retimed without being fitted again.
+ */
+class CubicSpline {
+private:
+  Eigen::VectorXd times_;              ///< knot times in seconds
+  Eigen::MatrixXd points_;             ///< points at the knots, one column per knot
+  Eigen::MatrixXd second_derivatives_; ///< second derivatives at the knots, one column per knot
+
+  /**
+   * @brief Find the segment containing the given time
+   * @param time the time in seconds, clamped to the duration of the spline
+   * @return the index of the knot at the start of the segment
+   */
+  Eigen::Index find_segment(double time) const;
+
+public:
+  /**
+   * @brief Empty constructor
+   */
+  CubicSpline() = default;
+
+  /**
+   * @brief Fit the spline through the points at the given times
+   * @param times the knot times in seconds, strictly increasing
+   * @param points the points at the knots, one column per knot and at least two knots
+   * @param start_velocity the velocity at the first knot, zero if not provided
+   * @param end_velocity the velocity at the last knot, zero if not provided
+   */
+  CubicSpline(const Eigen::VectorXd& times, const Eigen::MatrixXd& points,
+              const Eigen::VectorXd& start_velocity = Eigen::VectorXd(),
+              const Eigen::VectorXd& end_velocity = Eigen::VectorXd());
+
+  /**
+   * @brief Fit a rest to rest spline through the points and time it under velocity and acceleration limits.
+   * Each segment is first given the duration of a bang-bang profile of its slowest axis, then the whole spline
+   * is scaled with retime
+   * @param points the points at the knots, one column per knot and at least two knots
+   * @param max_velocities the maximum absolute velocity of each dimension
+   * @param max_accelerations the maximum absolute acceleration of each dimension
+   * @return the timed spline
+   */
+  static CubicSpline from_waypoints(const Eigen::MatrixXd& points,
+                                    const Eigen::VectorXd& max_velocities,
+                                    const Eigen::VectorXd& max_accelerations);
+
+  /**
+   * @brief Getter of the dimension of the points
+   */
+  Eigen::Index dimension() const;
+
+  /**
+   * @brief Getter of the knot times in seconds
+   */
+  const Eigen::VectorXd& get_times() const;
+
+  /**
+   * @brief Getter of the points at the knots
+   */
+  const Eigen::MatrixXd& get_points() const;
+
+  /**
+   * @brief Getter of the duration of the spline in seconds
+   */
+  double get_duration() const;
+
+  /**
+   * @brief Evaluate the spline or one of its derivatives at a time. Times strictly outside of the spline return
+   * the first or last point and zero higher derivatives
+   * @param time the time in seconds
+   * @param derivative the order of the derivative, from 0 (position) to 2 (acceleration)
+   * @return the value at the given time
+   */
+  Eigen::VectorXd evaluate(double time, unsigned int derivative = 0) const;
+
+  /**
+   * @brief Evaluate the spline or one of its derivatives at many times in one call
+   * @param times the times in seconds
+   * @param derivative the order of the derivative, from 0 (position) to 2 (acceleration)
+   * @return the values at the given times, one column per time
+   */
+  Eigen::MatrixXd evaluate(const Eigen::VectorXd& times, unsigned int derivative = 0) const;
+
+  /**
+   * @brief Compute the times from the start to the end of the spline at a constant period
+   * @param period the period in seconds
+   * @return the times, the end of the spline included
+   */
+  Eigen::VectorXd get_uniform_times(double period) const;
+
+  /**
+   * @brief Compute the maximum absolute velocity of each dimension over the spline, analytically
+   * @return the maximum absolute velocities
+   */
+  Eigen::VectorXd max_velocities() const;
+
+  /**
+   * @brief Compute the maximum absolute acceleration of each dimension over the spline, reached at the knots
+   * @return the maximum absolute accelerations
+   */
+  Eigen::VectorXd max_accelerations() const;
+
+  /**
+   * @brief Scale the time of the spline by a factor, keeping its path and first knot time.
+   * Velocities are divided by the factor and accelerations by its square
+   * @param factor the strictly positive time scaling factor
+   */
+  void scale_time(double factor);
+
+  /**
+   * @brief Scale the time of the spline to the fastest timing that respects the limits, i.e. such that at
+   * least one limit is reached. The spline is slowed down or sped up accordingly
+   * @param max_velocities the maximum absolute velocity of each dimension
+   * @param max_accelerations the maximum absolute acceleration of each dimension
+   * @return the applied time scaling factor
+   */
+  double retime(const Eigen::VectorXd& max_velocities, const Eigen::VectorXd& max_accelerations);
+};
+
+inline Eigen::Index CubicSpline::dimension() const {
+  return this->points_.rows();
+}
+
+inline const Eigen::VectorXd& CubicSpline::get_times() const {
+  return this->times_;
+}
+
+inline const Eigen::MatrixXd& CubicSpline::get_points() const {
+  return this->points_;
+}
+
+inline double CubicSpline::get_duration() const {
+  return this->times_.size() ? this->times_(this->times_.size() - 1) - this->times_(0) : 0.;
+}
+}// namespace state_representation
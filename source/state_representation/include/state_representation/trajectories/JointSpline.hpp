@@ -0,0 +1,108 @@
+#pragma once
+
+#include "state_representation/robot/JointPositions.hpp"
+#include "state_representation/trajectories/CubicSpline.hpp"
+#include "state_representation/trajectories/Trajectory.hpp"
+
+namespace state_representation {
+/**
+ * @class JointSpline
+ * @brief Smooth joint trajectory interpolating joint positions with a cubic spline per joint, continuous up
+ * to the accelerations and at rest at both ends
+ */
+class JointSpline {
+private:
+  std::string name_;             ///< name of the associated robot
+  SharedJointNames joint_names_; ///< shared table of the joint names
+  CubicSpline spline_;           ///< spline of the joint positions
+
+public:
+  /**
+   * @brief Empty constructor
+   */
+  JointSpline();
+
+  /**
+   * @brief Fit the spline through the points of a trajectory, at the times of the trajectory
+   * @param trajectory the trajectory with at least two points of the same joints
+   */
+  explicit JointSpline(const Trajectory<JointPositions>& trajectory);
+
+  /**
+   * @brief Fit the spline through waypoints and time it under the joint limits
+   * @param waypoints at least two joint positions of the same joints
+   * @param max_velocities the maximum absolute velocity of each joint, e.g. the velocity limits of the robot model
+   * @param max_accelerations the maximum absolute acceleration of each joint
+   */
+  JointSpline(const std::vector<JointPositions>& waypoints,
+              const Eigen::VectorXd& max_velocities,
+              const Eigen::VectorXd& max_accelerations);
+
+  /**
+   * @brief Getter of the name of the associated robot
+   */
+  const std::string& get_name() const;
+
+  /**
+   * @brief Getter of the joint names
+   */
+  const std::vector<std::string>& get_joint_names() const;
+
+  /**
+   * @brief Getter of the underlying spline, with times in seconds
+   */
+  const CubicSpline& get_spline() const;
+
+  /**
+   * @brief Getter of the time of the first point
+   */
+  std::chrono::nanoseconds get_start_time() const;
+
+  /**
+   * @brief Getter of the duration of the spline
+   */
+  std::chrono::nanoseconds get_duration() const;
+
+  /**
+   * @brief Scale the time of the spline to the fastest timing that respects the joint limits
+   * @param max_velocities the maximum absolute velocity of each joint
+   * @param max_accelerations the maximum absolute acceleration of each joint
+   * @return the applied time scaling factor
+   */
+  double retime(const Eigen::VectorXd& max_velocities, const Eigen::VectorXd& max_accelerations);
+
+  /**
+   * @brief Sample the spline at the given time
+   * @param time the time at which to sample
+   * @return the joint state with positions, velocities and accelerations at the given time
+   */
+  JointState sample(const std::chrono::nanoseconds& time) const;
+
+  /**
+   * @brief Sample the whole spline at a constant period in one call
+   * @param period the sampling period
+   * @param derivative the order of the derivative, from 0 (positions) to 2 (accelerations)
+   * @return the sampled values, one column per sample from the start to the end of the spline included
+   */
+  Eigen::MatrixXd sample_uniformly(const std::chrono::nanoseconds& period, unsigned int derivative = 0) const;
+
+  /**
+   * @brief Sample the spline at a constant period into a trajectory
+   * @param period the sampling period
+   * @return the trajectory of joint positions
+   */
+  Trajectory<JointPositions> to_trajectory(const std::chrono::nanoseconds& period) const;
+};
+
+inline const std::string& JointSpline::get_name() const {
+  return this->name_;
+}
+
+inline const std::vector<std::string>& JointSpline::get_joint_names() const {
+  return *this->joint_names_;
+}
+
+inline const CubicSpline& JointSpline::get_spline() const {
+  return this->spline_;
+}
+}// namespace state_representation
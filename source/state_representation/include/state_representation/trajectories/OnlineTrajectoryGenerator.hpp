@@ -0,0 +1,201 @@
+#pragma once
+
+#include <chrono>
+
+#include "state_representation/robot/JointState.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
+
+namespace state_representation {
+/**
+ * @class OnlineTrajectoryGenerator
+ * @brief Online generation of jerk-limited setpoints towards a target that can change at any time. Each axis
+ * follows a cascade of braking laws: the velocity towards the target is limited such that the axis can still
+ * stop with the acceleration and jerk limits, the acceleration towards that velocity is limited such that it
+ * can be reached with the jerk limit, and the change of acceleration is clamped by the jerk limit. One update
+ * per control cycle takes a constant time linear in the number of axes and does not allocate memory.
+ */
+class OnlineTrajectoryGenerator {
+private:
+  double period_;                     ///< period of the control cycle in seconds
+  Eigen::VectorXd max_velocities_;    ///< maximum absolute velocity of each axis
+  Eigen::VectorXd max_accelerations_; ///< maximum absolute acceleration of each axis
+  Eigen::VectorXd max_jerks_;         ///< maximum absolute jerk of each axis
+  Eigen::VectorXd positions_;         ///< current positions of the setpoint
+  Eigen::VectorXd velocities_;        ///< current velocities of the setpoint
+  Eigen::VectorXd accelerations_;     ///< current accelerations of the setpoint
+  Eigen::VectorXd target_;            ///< target positions
+
+  /**
+   * @brief Check that a vector has the number of axes of the generator
+   * @param vector the vector to check
+   * @param name the name of the vector for the error message
+   */
+  void assert_size(const Eigen::VectorXd& vector, const std::string& name) const;
+
+public:
+  /**
+   * @brief Constructor with the control period and the limits of each axis, the setpoint being at rest at zero
+   * @param period the period of the control cycle
+   * @param max_velocities the maximum absolute velocity of each axis
+   * @param max_accelerations the maximum absolute acceleration of each axis
+   * @param max_jerks the maximum absolute jerk of each axis
+   */
+  OnlineTrajectoryGenerator(const std::chrono::nanoseconds& period,
+                            const Eigen::VectorXd& max_velocities,
+                            const Eigen::VectorXd& max_accelerations,
+                            const Eigen::VectorXd& max_jerks);
+
+  /**
+   * @brief Getter of the number of axes
+   */
+  Eigen::Index get_size() const;
+
+  /**
+   * @brief Getter of the current positions of the setpoint
+   */
+  const Eigen::VectorXd& get_positions() const;
+
+  /**
+   * @brief Getter of the current velocities of the setpoint
+   */
+  const Eigen::VectorXd& get_velocities() const;
+
+  /**
+   * @brief Getter of the current accelerations of the setpoint
+   */
+  const Eigen::VectorXd& get_accelerations() const;
+
+  /**
+   * @brief Getter of the target positions
+   */
+  const Eigen::VectorXd& get_target() const;
+
+  /**
+   * @brief Reset the setpoint to the given current state, e.g. the measured state of the robot
+   * @param positions the current positions
+   * @param velocities the current velocities, zero if not provided
+   * @param accelerations the current accelerations, zero if not provided
+   */
+  void reset(const Eigen::VectorXd& positions,
+             const Eigen::VectorXd& velocities = Eigen::VectorXd(),
+             const Eigen::VectorXd& accelerations = Eigen::VectorXd());
+
+  /**
+   * @brief Reset the setpoint to the positions, velocities and accelerations of a joint state
+   * @param state the current joint state
+   */
+  void reset(const JointState& state);
+
+  /**
+   * @brief Setter of the target positions, which can be changed during the motion
+   * @param target the target positions
+   */
+  void set_target(const Eigen::VectorXd& target);
+
+  /**
+   * @brief Setter of the target positions from the positions of a joint state
+   * @param target the target joint state
+   */
+  void set_target(const JointState& target);
+
+  /**
+   * @brief Compute the setpoint of the next control cycle
+   * @return true if the setpoint reached the target and is at rest
+   */
+  bool update();
+
+  /**
+   * @brief Compute the setpoint of the next control cycle and write it in a joint state of the same size,
+   * without allocation
+   * @param setpoint the joint state in which the positions, velocities and accelerations are written
+   * @return true if the setpoint reached the target and is at rest
+   */
+  bool update(JointState& setpoint);
+
+  /**
+   * @brief Check if the setpoint reached the target and is at rest
+   * @param tolerance the tolerance on the positions, velocities and accelerations
+   */
+  bool is_target_reached(double tolerance = 1e-9) const;
+};
+
+/**
+ * @class CartesianOnlineTrajectoryGenerator
+ * @brief Online generation of jerk-limited Cartesian setpoints, with an OnlineTrajectoryGenerator on the three
+ * axes of the position and the three axes of the rotation vector of the orientation relative to the orientation
+ * at reset. Targets have to be within half a turn of that orientation.
+ */
+class CartesianOnlineTrajectoryGenerator {
+private:
+  OnlineTrajectoryGenerator generator_;      ///< generator of the position and rotation vector axes
+  Eigen::Quaterniond reference_orientation_; ///< orientation at reset from which the rotation vector is expressed
+
+public:
+  /**
+   * @brief Constructor with the control period and the linear and angular limits
+   * @param period the period of the control cycle
+   * @param max_linear_velocity the maximum linear velocity on each axis
+   * @param max_linear_acceleration the maximum linear acceleration on each axis
+   * @param max_linear_jerk the maximum linear jerk on each axis
+   * @param max_angular_velocity the maximum angular velocity on each axis of the rotation vector
+   * @param max_angular_acceleration the maximum angular acceleration on each axis of the rotation vector
+   * @param max_angular_jerk the maximum angular jerk on each axis of the rotation vector
+   */
+  CartesianOnlineTrajectoryGenerator(const std::chrono::nanoseconds& period,
+                                     double max_linear_velocity,
+                                     double max_linear_acceleration,
+                                     double max_linear_jerk,
+                                     double max_angular_velocity,
+                                     double max_angular_acceleration,
+                                     double max_angular_jerk);
+
+  /**
+   * @brief Reset the setpoint to the given current state, keeping its twist and accelerations such that a reset
+   * during the motion continues it smoothly
+   * @param state the current Cartesian state
+   */
+  void reset(const CartesianState& state);
+
+  /**
+   * @brief Setter of the target pose, which can be changed during the motion
+   * @param target the target Cartesian state
+   */
+  void set_target(const CartesianState& target);
+
+  /**
+   * @brief Compute the setpoint of the next control cycle and write its pose, twist and accelerations
+   * @param setpoint the Cartesian state in which the setpoint is written
+   * @return true if the setpoint reached the target and is at rest
+   */
+  bool update(CartesianState& setpoint);
+
+  /**
+   * @brief Getter of the generator of the position and rotation vector axes
+   */
+  const OnlineTrajectoryGenerator& get_generator() const;
+};
+
+inline Eigen::Index OnlineTrajectoryGenerator::get_size() const {
+  return this->positions_.size();
+}
+
+inline const Eigen::VectorXd& OnlineTrajectoryGenerator::get_positions() const {
+  return this->positions_;
+}
+
+inline const Eigen::VectorXd& OnlineTrajectoryGenerator::get_velocities() const {
+  return this->velocities_;
+}
+
+inline const Eigen::VectorXd& OnlineTrajectoryGenerator::get_accelerations() const {
+  return this->accelerations_;
+}
+
+inline const Eigen::VectorXd& OnlineTrajectoryGenerator::get_target() const {
+  return this->target_;
+}
+
+inline const OnlineTrajectoryGenerator& CartesianOnlineTrajectoryGenerator::get_generator() const {
+  return this->generator_;
+}
+}// namespace state_representation
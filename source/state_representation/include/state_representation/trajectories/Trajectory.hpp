@@ -1,15 +1,21 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <deque>
+#include <type_traits>
 #include "state_representation/State.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/robot/JointState.hpp"
+#include "state_representation/space/cartesian/CartesianState.hpp"
 
 namespace state_representation {
 template<class StateT>
 class Trajectory : public State {
 private:
-  std::deque<StateT> points_;
-  std::deque<std::chrono::nanoseconds> times_;
+  std::deque<StateT> points_;                  ///< points of the trajectory
+  std::deque<std::chrono::nanoseconds> times_; ///< cumulated times of the points, sorted in increasing order
   std::string reference_frame_; ///< name of the reference frame
   std::vector<std::string> joint_names_; ///< names of the joints
 
@@ -72,6 +78,19 @@ public:
    */
   void delete_point();
 
+  /**
+   * @brief Delete first point and corresponding time from trajectory, in constant time
+   */
+  void delete_first_point();
+
+  /**
+   * @brief Delete all the points strictly before the given time, keeping the times of the remaining points.
+   * Used to trim a streamed trajectory from its front while points are appended at its back
+   * @param time the time before which the points are deleted
+   * @return the number of deleted points
+   */
+  unsigned int delete_points_before(const std::chrono::nanoseconds& time);
+
   /**
    * @brief Clear trajectory
    */
@@ -104,6 +123,22 @@ public:
    */
   int get_size() const;
 
+  /**
+   * @brief Find the index of the last point at or before the given time with a binary search on the times
+   * @param time the time to look up
+   * @return the index of the point, -1 if the time is before the first point
+   */
+  int find_index(const std::chrono::nanoseconds& time) const;
+
+  /**
+   * @brief Sample the trajectory at the given time, interpolating between the two surrounding points.
+   * Joint states are interpolated linearly and Cartesian states linearly except for the orientation
+   * which is interpolated spherically. Times outside of the trajectory return its first or last point
+   * @param time the time at which to sample
+   * @return the interpolated point
+   */
+  StateT sample(const std::chrono::nanoseconds& time) const;
+
   /**
    * @brief Operator overload for returning a single trajectory point and corresponding time
    */
@@ -211,6 +246,29 @@ void Trajectory<StateT>::delete_point() {
   }
 }
 
+template<class StateT>
+void Trajectory<StateT>::delete_first_point() {
+  this->set_filled();
+  if (!this->points_.empty()) {
+    this->points_.pop_front();
+  }
+  if (!this->times_.empty()) {
+    this->times_.pop_front();
+  }
+}
+
+template<class StateT>
+unsigned int Trajectory<StateT>::delete_points_before(const std::chrono::nanoseconds& time) {
+  auto end = std::lower_bound(this->times_.begin(), this->times_.end(), time);
+  auto nb_points = static_cast<unsigned int>(std::distance(this->times_.begin(), end));
+  if (nb_points > 0) {
+    this->set_filled();
+    this->times_.erase(this->times_.begin(), end);
+    this->points_.erase(this->points_.begin(), this->points_.begin() + nb_points);
+  }
+  return nb_points;
+}
+
 template<class StateT>
 void Trajectory<StateT>::clear() {
   this->points_.clear();
@@ -242,6 +300,57 @@ int Trajectory<StateT>::get_size() const {
   return this->points_.size();
 }
 
+template<class StateT>
+int Trajectory<StateT>::find_index(const std::chrono::nanoseconds& time) const {
+  auto it = std::upper_bound(this->times_.begin(), this->times_.end(), time);
+  return static_cast<int>(std::distance(this->times_.begin(), it)) - 1;
+}
+
+template<class StateT>
+StateT Trajectory<StateT>::sample(const std::chrono::nanoseconds& time) const {
+  if (this->points_.empty()) {
+    throw exceptions::EmptyStateException(this->get_name() + " trajectory is empty");
+  }
+  int index = this->find_index(time);
+  if (index < 0) {
+    return this->points_.front();
+  }
+  if (index + 1 >= this->get_size()) {
+    return this->points_.back();
+  }
+  const StateT& start = this->points_[index];
+  const StateT& end = this->points_[index + 1];
+  double t = std::chrono::duration<double>(time - this->times_[index]).count()
+      / std::chrono::duration<double>(this->times_[index + 1] - this->times_[index]).count();
+  StateT result(start);
+  if constexpr (std::is_base_of_v<JointState, StateT>) {
+    const auto& joint_start = static_cast<const JointState&>(start);
+    const auto& joint_end = static_cast<const JointState&>(end);
+    if (joint_start.get_size() != joint_end.get_size()) {
+      throw exceptions::IncompatibleSizeException("The points of the trajectory have different numbers of joints");
+    }
+    auto& joint_result = static_cast<JointState&>(result);
+    joint_result.set_positions((1 - t) * joint_start.get_positions() + t * joint_end.get_positions());
+    joint_result.set_velocities((1 - t) * joint_start.get_velocities() + t * joint_end.get_velocities());
+    joint_result.set_accelerations((1 - t) * joint_start.get_accelerations() + t * joint_end.get_accelerations());
+    joint_result.set_torques((1 - t) * joint_start.get_torques() + t * joint_end.get_torques());
+  } else if constexpr (std::is_base_of_v<CartesianState, StateT>) {
+    const auto& cartesian_start = static_cast<const CartesianState&>(start);
+    const auto& cartesian_end = static_cast<const CartesianState&>(end);
+    auto& cartesian_result = static_cast<CartesianState&>(result);
+    cartesian_result.set_position((1 - t) * cartesian_start.get_position() + t * cartesian_end.get_position());
+    cartesian_result.set_orientation(cartesian_start.get_orientation().slerp(t, cartesian_end.get_orientation()));
+    cartesian_result.set_twist((1 - t) * cartesian_start.get_twist() + t * cartesian_end.get_twist());
+    cartesian_result.set_accelerations(
+        (1 - t) * cartesian_start.get_accelerations() + t * cartesian_end.get_accelerations());
+    cartesian_result.set_wrench((1 - t) * cartesian_start.get_wrench() + t * cartesian_end.get_wrench());
+  } else {
+    static_assert(std::is_base_of_v<JointState, StateT> || std::is_base_of_v<CartesianState, StateT>,
+                  "Sampling is only available for trajectories of joint or Cartesian states");
+  }
+  return result;
+}
+
 template<class StateT>
 const std::pair<StateT, std::chrono::nanoseconds> Trajectory<StateT>::operator[](unsigned int idx) const {
   return std::make_pair(this->points_[idx], this->times_[idx]);
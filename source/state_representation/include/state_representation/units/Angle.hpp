@@ -23,14 +23,21 @@ constexpr Angle operator ""_deg(long double n);
 
 class Angle {
 private:
-  long double value; ///< value of the angle in radian (base unit)
+  double value; ///< value of the angle in radian (base unit), as given at construction
+
+  /**
+   * @brief Wrap a value in radian in [-pi,pi]
+   * @param n the value in radian
+   * @return the wrapped value
+   */
+  static constexpr double wrap(double n);
 
 public:
   /**
-   * @brief Constructor with a value in radian in [-pi,pi]
+   * @brief Constructor with a value in radian, wrapped in [-pi,pi] by get_value and by the operations
    * @param n the value in radian
    */
-  constexpr Angle(long double n = 0.0);
+  constexpr Angle(double n = 0.0);
 
   /**
    * @brief Copy constructor from another Angle
@@ -40,16 +47,22 @@ public:
 
   /**
    * @brief Getter of the value attribute
+   * @return the value in radian in [-pi,pi]
+   */
+  constexpr double get_value() const;
+
+  /**
+   * @brief Getter of the value as given at construction, e.g. beyond half a turn for the position of a joint
    * @return the value in radian
    */
-  constexpr long double get_value() const;
+  constexpr double get_unwrapped_value() const;
 
   /**
    * @brief Overload the = operator
    * @param n the angle value to assign in radian
    * @return the angle in radian
    */
-  constexpr Angle& operator=(long double n);
+  constexpr Angle& operator=(double n);
 
   /**
    * @brief Overload the - operator
@@ -185,18 +198,26 @@ public:
   friend constexpr Angle literals::operator ""_deg(long double n);
 };
 
-constexpr Angle::Angle(long double n) :
-    value(atan2(sin(n), cos(n))) {}
+constexpr double Angle::wrap(double n) {
+  return atan2(sin(n), cos(n));
+}
+
+constexpr Angle::Angle(double n) :
+    value(n) {}
 
 constexpr Angle::Angle(const Angle& ang) :
     value(ang.value) {}
 
-constexpr long double Angle::get_value() const {
+constexpr double Angle::get_value() const {
+  return wrap(this->value);
+}
+
+constexpr double Angle::get_unwrapped_value() const {
   return this->value;
 }
 
-constexpr Angle& Angle::operator=(long double n) {
-  this->value = atan2(sin(n), cos(n));
+constexpr Angle& Angle::operator=(double n) {
+  this->value = n;
   return (*this);
 }
 
@@ -206,8 +227,7 @@ constexpr Angle& Angle::operator-() {
 }
 
 constexpr Angle& Angle::operator+=(const Angle& rhs) {
-  double n = this->value + rhs.value;
-  this->value = atan2(sin(n), cos(n));
+  this->value = wrap(this->value + rhs.value);
   return (*this);
 }
 
@@ -218,8 +238,7 @@ constexpr Angle Angle::operator+(const Angle& rhs) const {
 }
 
 constexpr Angle& Angle::operator-=(const Angle& rhs) {
-  double n = this->value - rhs.value;
-  this->value = atan2(sin(n), cos(n));
+  this->value = wrap(this->value - rhs.value);
   return (*this);
 }
 
@@ -230,8 +249,7 @@ constexpr Angle Angle::operator-(const Angle& rhs) const {
 }
 
 constexpr Angle& Angle::operator*=(double lambda) {
-  double n = this->value * lambda;
-  this->value = atan2(sin(n), cos(n));
+  this->value = wrap(this->get_value() * lambda);
   return (*this);
 }
 
@@ -242,8 +260,7 @@ constexpr Angle Angle::operator*(double lambda) const {
 }
 
 constexpr Angle& Angle::operator/=(double lambda) {
-  double n = this->value / lambda;
-  this->value = atan2(sin(n), cos(n));
+  this->value = wrap(this->get_value() / lambda);
   return (*this);
 }
 
@@ -254,7 +271,7 @@ constexpr Angle Angle::operator/(double lambda) const {
 }
 
 constexpr bool Angle::operator==(const Angle& rhs) const {
-  return (abs(this->value - rhs.value) < 1e-4);
+  return (abs(this->get_value() - rhs.get_value()) < 1e-4);
 }
 
 constexpr bool Angle::operator!=(const Angle& rhs) const {
@@ -262,7 +279,7 @@ constexpr bool Angle::operator!=(const Angle& rhs) const {
 }
 
 constexpr bool Angle::operator>(const Angle& rhs) const {
-  return ((this->value - rhs.value) > 1e-4);
+  return ((this->get_value() - rhs.get_value()) > 1e-4);
 }
 
 constexpr bool Angle::operator>=(const Angle& rhs) const {
@@ -270,7 +287,7 @@ constexpr bool Angle::operator>=(const Angle& rhs) const {
 }
 
 constexpr bool Angle::operator<(const Angle& rhs) const {
-  return ((rhs.value - this->value) > 1e-4);
+  return ((rhs.get_value() - this->get_value()) > 1e-4);
 }
 
 constexpr bool Angle::operator<=(const Angle& rhs) const {
@@ -282,7 +299,7 @@ constexpr double operator/(const Angle& lhs, const Angle& rhs) {
 }
 
 constexpr Angle operator*(double lambda, const Angle& rhs) {
-  return Angle(lambda * rhs.value);
+  return Angle(Angle::wrap(lambda * rhs.get_value()));
 }
 
 inline namespace literals {
@@ -44,14 +44,14 @@ constexpr Distance operator ""_mm(long double n);
 
 class Distance {
 private:
-  long double value; ///< value of the distance in meter (base unit)
+  double value; ///< value of the distance in meter (base unit)
 
 public:
   /**
    * @brief Constructor with a value in meter
    * @param n the value in meter
    */
-  constexpr Distance(long double n = 0.0);
+  constexpr Distance(double n = 0.0);
 
   /**
    * @brief Copy constructor from another distance
@@ -63,7 +63,7 @@ public:
    * @brief Getter of the value attribute
    * @return the value in meter
    */
-  constexpr long double get_value() const;
+  constexpr double get_value() const;
 
   /**
    * @brief Overload the - operator
@@ -220,13 +220,13 @@ public:
   friend constexpr Distance literals::operator ""_mm(long double n);
 };
 
-constexpr Distance::Distance(long double n) :
+constexpr Distance::Distance(double n) :
     value(n) {}
 
 constexpr Distance::Distance(const Distance& dist) :
     value(dist.value) {}
 
-constexpr long double Distance::get_value() const {
+constexpr double Distance::get_value() const {
   return this->value;
 }
 
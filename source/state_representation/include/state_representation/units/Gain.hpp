@@ -0,0 +1,80 @@
+#pragma once
+
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation::units {
+/**
+ * @class Gain
+ * @brief Non-negative controller gain, e.g. a stiffness or a damping. The value is validated in the constexpr
+ * constructor, such that a negative gain known at compile time, e.g. `constexpr Gain k = -1.0;`, does not compile,
+ * while a negative gain only known at runtime throws an InvalidParameterException.
+ */
+class Gain {
+private:
+  double value; ///< value of the gain
+
+  /**
+   * @brief Check that a value is a valid gain
+   * @param n the value
+   * @return the value if it is positive or zero
+   */
+  static constexpr double validate(double n);
+
+public:
+  /**
+   * @brief Constructor with a positive or zero value
+   * @param n the value
+   */
+  constexpr Gain(double n = 0.0);
+
+  /**
+   * @brief Getter of the value attribute
+   * @return the value
+   */
+  constexpr double get_value() const;
+
+  /**
+   * @brief Overload the * operator with a scalar
+   * @param lambda the positive scalar to multiply with
+   * @return the Gain multiplied by lambda
+   */
+  constexpr Gain operator*(double lambda) const;
+
+  /**
+   * @brief Overload the == operator
+   * @param rhs the other Gain to check equality with
+   * @return bool true if the two Gains are equal
+   */
+  constexpr bool operator==(const Gain& rhs) const;
+
+  /**
+   * @brief Overload the != operator
+   * @param rhs the other Gain to check inequality with
+   * @return bool true if the two Gains are different
+   */
+  constexpr bool operator!=(const Gain& rhs) const;
+};
+
+constexpr double Gain::validate(double n) {
+  return n >= 0 ? n : throw exceptions::InvalidParameterException("A gain has to be positive or zero");
+}
+
+constexpr Gain::Gain(double n) :
+    value(validate(n)) {}
+
+constexpr double Gain::get_value() const {
+  return this->value;
+}
+
+constexpr Gain Gain::operator*(double lambda) const {
+  return Gain(this->value * lambda);
+}
+
+constexpr bool Gain::operator==(const Gain& rhs) const {
+  return this->value == rhs.value;
+}
+
+constexpr bool Gain::operator!=(const Gain& rhs) const {
+  return !((*this) == rhs);
+}
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <chrono>
+#include <type_traits>
+#include <eigen3/Eigen/Core>
+#include "state_representation/units/Distance.hpp"
+#include "state_representation/units/Velocity.hpp"
+
+namespace state_representation::units {
+/**
+ * @class Vector3
+ * @brief Three dimensional quantity of a scalar unit T, stored as an Eigen vector in the base unit of T such that
+ * the arithmetic uses the vectorized Eigen operations. The scalar coordinates are built with the literal
+ * operators of T, e.g. Distance3(1.0_m, 20.0_cm, 0.0_m), whose conversions to the base unit fold at compile time.
+ * With a map as storage, the vector is a view on an existing Eigen vector, e.g. the position of a CartesianPose,
+ * without copy.
+ * @tparam T the scalar unit
+ * @tparam Storage the storage of the coordinates, an Eigen::Vector3d or a map on one
+ */
+template<class T, class Storage = Eigen::Vector3d>
+class Vector3 {
+private:
+  Storage value; ///< coordinates in the base unit of T
+
+public:
+  /**
+   * @brief Empty constructor with zero coordinates
+   */
+  Vector3();
+
+  /**
+   * @brief Constructor with the three coordinates
+   * @param x the x coordinate
+   * @param y the y coordinate
+   * @param z the z coordinate
+   */
+  Vector3(const T& x, const T& y, const T& z);
+
+  /**
+   * @brief Constructor from coordinates in the base unit of T, copied by a vector and referred to by a view
+   * @param coordinates the coordinates in the base unit of T
+   */
+  explicit Vector3(const Eigen::Vector3d& coordinates);
+
+  /**
+   * @brief A view on temporary coordinates would dangle, only a vector can be constructed from them
+   */
+  template<class S = Storage, typename = std::enable_if_t<!std::is_same_v<S, Eigen::Vector3d>>>
+  explicit Vector3(Eigen::Vector3d&& coordinates) = delete;
+
+  /**
+   * @brief Conversion constructor from another storage, e.g. to copy a view
+   * @param other the vector to copy
+   */
+  template<class OtherStorage>
+  Vector3(const Vector3<T, OtherStorage>& other);
+
+  /**
+   * @brief Getter of the coordinates in the base unit of T
+   */
+  const Storage& get_value() const;
+
+  /**
+   * @brief Getter of a coordinate
+   * @param index the index of the coordinate
+   */
+  T operator[](Eigen::Index index) const;
+
+  /**
+   * @brief Getter of the x coordinate
+   */
+  T x() const;
+
+  /**
+   * @brief Getter of the y coordinate
+   */
+  T y() const;
+
+  /**
+   * @brief Getter of the z coordinate
+   */
+  T z() const;
+
+  /**
+   * @brief Compute the norm of the vector
+   */
+  T norm() const;
+
+  /**
+   * @brief Overload the - operator
+   * @return the opposite vector
+   */
+  Vector3<T> operator-() const;
+
+  /**
+   * @brief Overload the + operator
+   * @param rhs the vector to add
+   * @return the sum of the two vectors
+   */
+  template<class OtherStorage>
+  Vector3<T> operator+(const Vector3<T, OtherStorage>& rhs) const;
+
+  /**
+   * @brief Overload the - operator
+   * @param rhs the vector to subtract
+   * @return the difference of the two vectors
+   */
+  template<class OtherStorage>
+  Vector3<T> operator-(const Vector3<T, OtherStorage>& rhs) const;
+
+  /**
+   * @brief Overload the * operator with a scalar
+   * @param lambda the scalar to multiply with
+   * @return the vector multiplied by lambda
+   */
+  Vector3<T> operator*(double lambda) const;
+
+  /**
+   * @brief Overload the / operator with a scalar
+   * @param lambda the scalar to divide by
+   * @return the vector divided by lambda
+   */
+  Vector3<T> operator/(double lambda) const;
+
+  /**
+   * @brief Overload the == operator, with the tolerance of the scalar unit on each coordinate
+   * @param rhs the other vector to check equality with
+   * @return bool true if the two vectors are equal
+   */
+  template<class OtherStorage>
+  bool operator==(const Vector3<T, OtherStorage>& rhs) const;
+
+  /**
+   * @brief Overload the != operator
+   * @param rhs the other vector to check inequality with
+   * @return bool true if the two vectors are different
+   */
+  template<class OtherStorage>
+  bool operator!=(const Vector3<T, OtherStorage>& rhs) const;
+
+  /**
+   * @brief Overload the * operator with a scalar on the left side
+   * @param lambda the scalar to multiply with
+   * @param rhs the vector
+   * @return the vector multiplied by lambda
+   */
+  friend Vector3<T> operator*(double lambda, const Vector3<T, Storage>& rhs) {
+    return rhs * lambda;
+  }
+};
+
+/**
+ * @brief View on an existing Eigen vector as a three dimensional quantity of T
+ */
+template<class T>
+using Vector3View = Vector3<T, Eigen::Map<const Eigen::Vector3d>>;
+
+using Distance3 = Vector3<Distance>;
+using Velocity3 = Vector3<LinearVelocity>;
+using AngularVelocity3 = Vector3<AngularVelocity>;
+
+template<class T, class Storage>
+inline Vector3<T, Storage>::Vector3() :
+    value(Eigen::Vector3d::Zero()) {}
+
+template<class T, class Storage>
+inline Vector3<T, Storage>::Vector3(const T& x, const T& y, const T& z) :
+    value(x.get_value(), y.get_value(), z.get_value()) {}
+
+template<class T, class Storage>
+inline Vector3<T, Storage>::Vector3(const Eigen::Vector3d& coordinates) :
+    value(coordinates.data()) {}
+
+template<class T, class Storage>
+template<class OtherStorage>
+inline Vector3<T, Storage>::Vector3(const Vector3<T, OtherStorage>& other) :
+    value(other.get_value()) {}
+
+template<class T, class Storage>
+inline const Storage& Vector3<T, Storage>::get_value() const {
+  return this->value;
+}
+
+template<class T, class Storage>
+inline T Vector3<T, Storage>::operator[](Eigen::Index index) const {
+  return T(this->value(index));
+}
+
+template<class T, class Storage>
+inline T Vector3<T, Storage>::x() const {
+  return T(this->value.x());
+}
+
+template<class T, class Storage>
+inline T Vector3<T, Storage>::y() const {
+  return T(this->value.y());
+}
+
+template<class T, class Storage>
+inline T Vector3<T, Storage>::z() const {
+  return T(this->value.z());
+}
+
+template<class T, class Storage>
+inline T Vector3<T, Storage>::norm() const {
+  return T(this->value.norm());
+}
+
+template<class T, class Storage>
+inline Vector3<T> Vector3<T, Storage>::operator-() const {
+  return Vector3<T>(Eigen::Vector3d(-this->value));
+}
+
+template<class T, class Storage>
+template<class OtherStorage>
+inline Vector3<T> Vector3<T, Storage>::operator+(const Vector3<T, OtherStorage>& rhs) const {
+  return Vector3<T>(Eigen::Vector3d(this->value + rhs.get_value()));
+}
+
+template<class T, class Storage>
+template<class OtherStorage>
+inline Vector3<T> Vector3<T, Storage>::operator-(const Vector3<T, OtherStorage>& rhs) const {
+  return Vector3<T>(Eigen::Vector3d(this->value - rhs.get_value()));
+}
+
+template<class T, class Storage>
+inline Vector3<T> Vector3<T, Storage>::operator*(double lambda) const {
+  return Vector3<T>(Eigen::Vector3d(lambda * this->value));
+}
+
+template<class T, class Storage>
+inline Vector3<T> Vector3<T, Storage>::operator/(double lambda) const {
+  return Vector3<T>(Eigen::Vector3d(this->value / lambda));
+}
+
+template<class T, class Storage>
+template<class OtherStorage>
+inline bool Vector3<T, Storage>::operator==(const Vector3<T, OtherStorage>& rhs) const {
+  return this->x() == rhs.x() && this->y() == rhs.y() && this->z() == rhs.z();
+}
+
+template<class T, class Storage>
+template<class OtherStorage>
+inline bool Vector3<T, Storage>::operator!=(const Vector3<T, OtherStorage>& rhs) const {
+  return !((*this) == rhs);
+}
+
+/**
+ * @brief Overload the / operator of a vector quantity with a duration
+ * @param lhs the vector quantity, e.g. a displacement
+ * @param rhs the duration
+ * @return the vector velocity of the quantity
+ */
+template<class T, class Storage, class Rep, class DurationRatio>
+inline Vector3<Velocity<T>>
+operator/(const Vector3<T, Storage>& lhs, const std::chrono::duration<Rep, DurationRatio>& rhs) {
+  const auto rhsInSeconds = std::chrono::duration_cast<std::chrono::duration<double>>(rhs);
+  return Vector3<Velocity<T>>(Eigen::Vector3d(lhs.get_value() / rhsInSeconds.count()));
+}
+}
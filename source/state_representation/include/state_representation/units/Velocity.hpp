@@ -81,14 +81,14 @@ constexpr AngularVelocity operator ""_deg_s(long double n);
 template<class T>
 class Velocity {
 private:
-  long double value; ///< value of the velocity in the base unit of T
+  double value; ///< value of the velocity in the base unit of T
 
 public:
   /**
    * @brief Constructor with a value in the base unit of T
    * @param n the value in the base unit of T
    */
-  constexpr Velocity(long double n = 0.0);
+  constexpr Velocity(double n = 0.0);
 
   /**
    * @brief Copy constructor from another Velocity
@@ -100,7 +100,7 @@ public:
    * @brief Getter of the value attribute
    * @return the value in meter per second
    */
-  constexpr long double get_value() const;
+  constexpr double get_value() const;
 
   /**
    * @brief Overload the - operator
@@ -236,7 +236,7 @@ public:
 };
 
 template<class T>
-constexpr Velocity<T>::Velocity(long double n):
+constexpr Velocity<T>::Velocity(double n):
     value(n) {}
 
 template<class T>
@@ -244,7 +244,7 @@ constexpr Velocity<T>::Velocity(const Velocity<T>& vel):
     value(vel.value) {}
 
 template<class T>
-constexpr long double Velocity<T>::get_value() const {
+constexpr double Velocity<T>::get_value() const {
   return this->value;
 }
 
@@ -338,7 +338,7 @@ constexpr bool Velocity<T>::operator<=(const Velocity<T>& rhs) const {
 
 template<class T, class Rep, class DurationRatio>
 constexpr Velocity<T> operator/(const T& dist, const std::chrono::duration<Rep, DurationRatio>& rhs) {
-  const auto rhsInSeconds = std::chrono::duration_cast<std::chrono::seconds>(rhs);
+  const auto rhsInSeconds = std::chrono::duration_cast<std::chrono::duration<double>>(rhs);
   return Velocity<T>(dist.get_value() / rhsInSeconds.count());
 }
 
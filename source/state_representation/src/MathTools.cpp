@@ -1,21 +1,208 @@
 #include "state_representation/MathTools.hpp"
 
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+
 namespace state_representation::math_tools {
+namespace {
+/**
+ * @brief Polynomial approximation of atan on [-tan(pi/8), tan(pi/8)]
+ */
+inline double atan_kernel(double x) {
+  double z = x * x;
+  double w = z * z;
+  double odd = z * (3.33333333333329318027e-01 + w * (1.42857142725034663711e-01 + w * (9.09088713343650656196e-02
+      + w * (6.66107313738753120669e-02 + w * (4.97687799461593236017e-02 + w * 1.62858201153657823623e-02)))));
+  double even = w * (-1.99999999998764832476e-01 + w * (-1.11111104054623557880e-01 + w * (-7.69187620504482999495e-02
+      + w * (-5.83357013379057348645e-02 + w * -3.65315727442169155270e-02))));
+  return x - x * (odd + even);
+}
+
+/**
+ * @brief Branch free atan2 for a non negative y, reduced to the interval of atan_kernel by the symmetries of atan
+ * @return the angle in [0, pi]
+ */
+inline double positive_atan2(double y, double x) {
+  double ax = std::abs(x);
+  double high = std::max(ax, y);
+  double low = std::min(ax, y);
+  double ratio = high > 0 ? low / high : 0;
+  bool reduced = ratio > 0.41421356237309503;
+  double angle = (reduced ? M_PI_4 : 0) + atan_kernel(reduced ? (ratio - 1) / (ratio + 1) : ratio);
+  angle = y > ax ? M_PI_2 - angle : angle;
+  return x < 0 ? M_PI - angle : angle;
+}
+
+/**
+ * @brief Branch free sin and cos, with a Cody-Waite reduction of the angle to [-pi/4, pi/4]
+ */
+inline void sin_cos(double angle, double& sin, double& cos) {
+  double k = std::nearbyint(angle * M_2_PI);
+  double r = (angle - k * 1.57079632673412561417e+00) - k * 6.07710050650619224932e-11;
+  double z = r * r;
+  double sr = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03
+      + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08
+          + z * 1.58969099521155010221e-10)))));
+  double cr = 1 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03
+      + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09
+          + z * -1.13596475577881948265e-11)))));
+  auto quadrant = static_cast<long long>(k) & 3;
+  sin = quadrant == 0 ? sr : quadrant == 1 ? cr : quadrant == 2 ? -sr : -cr;
+  cos = quadrant == 0 ? cr : quadrant == 1 ? -sr : quadrant == 2 ? -cr : sr;
+}
+
+/**
+ * @brief Scale of the vector part of a unit quaternion in its log
+ */
+inline double log_scale(double norm, double w) {
+  return norm > 0 ? positive_atan2(norm, w) / norm : 0;
+}
+
+/**
+ * @brief Exp of a pure quaternion of vector part (x, y, z) scaled by lambda
+ */
+inline void exp_kernel(double x, double y, double z, double lambda, double* result) {
+  double norm = std::sqrt(x * x + y * y + z * z);
+  double sin, cos;
+  sin_cos(norm * lambda, sin, cos);
+  double scale = norm > 0 ? sin / norm : 0;
+  result[0] = cos;
+  result[1] = scale * x;
+  result[2] = scale * y;
+  result[3] = scale * z;
+}
+
+/**
+ * @brief Product of two quaternions p and q given as (w, x, y, z)
+ */
+inline void product(const double* p, const double* q, double* result) {
+  result[0] = p[0] * q[0] - p[1] * q[1] - p[2] * q[2] - p[3] * q[3];
+  result[1] = p[0] * q[1] + p[1] * q[0] + p[2] * q[3] - p[3] * q[2];
+  result[2] = p[0] * q[2] - p[1] * q[3] + p[2] * q[0] + p[3] * q[1];
+  result[3] = p[0] * q[3] + p[1] * q[2] - p[2] * q[1] + p[3] * q[0];
+}
+
+/**
+ * @brief Angle of the rotation between two unit quaternions p and q given as (w, x, y, z)
+ */
+inline double distance_kernel(const double* p, const double* q) {
+  double conjugate[4] = {p[0], -p[1], -p[2], -p[3]};
+  double difference[4];
+  product(conjugate, q, difference);
+  double norm = std::sqrt(difference[1] * difference[1] + difference[2] * difference[2]
+                              + difference[3] * difference[3]);
+  return 2 * positive_atan2(norm, std::abs(difference[0]));
+}
+
+/**
+ * @brief Spherical linear interpolation between two unit quaternions p and q given as (w, x, y, z)
+ */
+inline void slerp_kernel(const double* p, const double* q, double t, double* result) {
+  // the sine and cosine of the angle are read from the difference, which is accurate for small angles
+  double conjugate[4] = {p[0], -p[1], -p[2], -p[3]};
+  double difference[4];
+  product(conjugate, q, difference);
+  double sin_angle = std::sqrt(difference[1] * difference[1] + difference[2] * difference[2]
+                                   + difference[3] * difference[3]);
+  double angle = positive_atan2(sin_angle, std::abs(difference[0]));
+  double sin_start, cos_start, sin_end, cos_end;
+  sin_cos((1 - t) * angle, sin_start, cos_start);
+  sin_cos(t * angle, sin_end, cos_end);
+  double start_weight = sin_angle > 1e-12 ? sin_start / sin_angle : 1 - t;
+  double end_weight = sin_angle > 1e-12 ? sin_end / sin_angle : t;
+  // shortest path of the double cover
+  end_weight = difference[0] < 0 ? -end_weight : end_weight;
+  for (int j = 0; j < 4; ++j) {
+    result[j] = start_weight * p[j] + end_weight * q[j];
+  }
+}
+
+void assert_same_size(Eigen::Index lhs, Eigen::Index rhs) {
+  if (lhs != rhs) {
+    throw exceptions::IncompatibleSizeException("The arrays of quaternions are of different sizes "
+                                                    + std::to_string(lhs) + " and " + std::to_string(rhs));
+  }
+}
+}// namespace
+
 const Eigen::Quaterniond log(const Eigen::Quaterniond& q) {
   Eigen::Quaterniond log_q = Eigen::Quaterniond(0, 0, 0, 0);
-  double q_norm = q.vec().norm();
-  if (q_norm > 1e-4) { log_q.vec() = (q.vec() / q_norm) * acos(std::min<double>(std::max<double>(q.w(), -1), 1)); }
+  log_q.vec() = log_scale(q.vec().norm(), q.w()) * q.vec();
   return log_q;
 }
 
 const Eigen::Quaterniond exp(const Eigen::Quaterniond& q, double lambda) {
-  Eigen::Quaterniond exp_q = Eigen::Quaterniond::Identity();
-  double q_norm = q.vec().norm();
-  if (q_norm > 1e-4) {
-    exp_q.w() = cos(q_norm * lambda);
-    exp_q.vec() = (q.vec() / q_norm) * sin(q_norm * lambda);
+  double result[4];
+  exp_kernel(q.x(), q.y(), q.z(), lambda, result);
+  return Eigen::Quaterniond(result[0], result[1], result[2], result[3]);
+}
+
+double distance(const Eigen::Quaterniond& q1, const Eigen::Quaterniond& q2) {
+  double p[4] = {q1.w(), q1.x(), q1.y(), q1.z()};
+  double q[4] = {q2.w(), q2.x(), q2.y(), q2.z()};
+  return distance_kernel(p, q);
+}
+
+void log(const Eigen::Matrix<double, Eigen::Dynamic, 4>& quaternions,
+         Eigen::Matrix<double, Eigen::Dynamic, 3>& result) {
+  result.resize(quaternions.rows(), Eigen::NoChange);
+  for (Eigen::Index i = 0; i < quaternions.rows(); ++i) {
+    double x = quaternions(i, 1), y = quaternions(i, 2), z = quaternions(i, 3);
+    double scale = log_scale(std::sqrt(x * x + y * y + z * z), quaternions(i, 0));
+    result(i, 0) = scale * x;
+    result(i, 1) = scale * y;
+    result(i, 2) = scale * z;
+  }
+}
+
+void exp(const Eigen::Matrix<double, Eigen::Dynamic, 3>& vectors, double lambda,
+         Eigen::Matrix<double, Eigen::Dynamic, 4>& result) {
+  result.resize(vectors.rows(), Eigen::NoChange);
+  for (Eigen::Index i = 0; i < vectors.rows(); ++i) {
+    double q[4];
+    exp_kernel(vectors(i, 0), vectors(i, 1), vectors(i, 2), lambda, q);
+    result.row(i) << q[0], q[1], q[2], q[3];
+  }
+}
+
+void multiply(const Eigen::Matrix<double, Eigen::Dynamic, 4>& lhs,
+              const Eigen::Matrix<double, Eigen::Dynamic, 4>& rhs,
+              Eigen::Matrix<double, Eigen::Dynamic, 4>& result) {
+  assert_same_size(lhs.rows(), rhs.rows());
+  result.resize(lhs.rows(), Eigen::NoChange);
+  for (Eigen::Index i = 0; i < lhs.rows(); ++i) {
+    double p[4] = {lhs(i, 0), lhs(i, 1), lhs(i, 2), lhs(i, 3)};
+    double q[4] = {rhs(i, 0), rhs(i, 1), rhs(i, 2), rhs(i, 3)};
+    double r[4];
+    product(p, q, r);
+    result.row(i) << r[0], r[1], r[2], r[3];
+  }
+}
+
+void slerp(const Eigen::Matrix<double, Eigen::Dynamic, 4>& start,
+           const Eigen::Matrix<double, Eigen::Dynamic, 4>& end,
+           double t,
+           Eigen::Matrix<double, Eigen::Dynamic, 4>& result) {
+  assert_same_size(start.rows(), end.rows());
+  result.resize(start.rows(), Eigen::NoChange);
+  for (Eigen::Index i = 0; i < start.rows(); ++i) {
+    double p[4] = {start(i, 0), start(i, 1), start(i, 2), start(i, 3)};
+    double q[4] = {end(i, 0), end(i, 1), end(i, 2), end(i, 3)};
+    double r[4];
+    slerp_kernel(p, q, t, r);
+    result.row(i) << r[0], r[1], r[2], r[3];
+  }
+}
+
+void distance(const Eigen::Matrix<double, Eigen::Dynamic, 4>& lhs,
+              const Eigen::Matrix<double, Eigen::Dynamic, 4>& rhs,
+              Eigen::VectorXd& result) {
+  assert_same_size(lhs.rows(), rhs.rows());
+  result.resize(lhs.rows());
+  for (Eigen::Index i = 0; i < lhs.rows(); ++i) {
+    double p[4] = {lhs(i, 0), lhs(i, 1), lhs(i, 2), lhs(i, 3)};
+    double q[4] = {rhs(i, 0), rhs(i, 1), rhs(i, 2), rhs(i, 3)};
+    result(i) = distance_kernel(p, q);
   }
-  return exp_q;
 }
 
 const std::vector<double> linspace(double start, double end, unsigned int number_of_points) {
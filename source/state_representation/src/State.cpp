@@ -1,15 +1,65 @@
 #include "state_representation/State.hpp"
 
+#include <algorithm>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
+
 namespace state_representation {
+namespace {
+/**
+ * @brief Owners of the clocks of the states. The current clock is published to the readers as a raw pointer,
+ * such that the clocks that were set are retained to never be destroyed while a thread may still read them
+ */
+struct ClockRegistry {
+  std::mutex mutex;
+  std::shared_ptr<Clock> current = std::make_shared<SteadyClock>();
+  std::vector<std::shared_ptr<Clock>> retained;
+};
+
+ClockRegistry& get_clock_registry() {
+  static ClockRegistry registry;
+  return registry;
+}
+}// namespace
+
+std::atomic<Clock*> State::clock_(nullptr);
+thread_local TimestampPolicy State::timestamp_policy_ = TimestampPolicy::EAGER;
+thread_local std::chrono::time_point<std::chrono::steady_clock> State::cycle_time_;
+
+std::shared_ptr<Clock> State::get_clock() {
+  ClockRegistry& registry = get_clock_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.current;
+}
+
+void State::set_clock(const std::shared_ptr<Clock>& clock) {
+  ClockRegistry& registry = get_clock_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.current = clock != nullptr ? clock : std::make_shared<SteadyClock>();
+  // the steady clock is published as null, such that now() reads it directly
+  Clock* published = nullptr;
+  if (typeid(*registry.current) != typeid(SteadyClock)) {
+    published = registry.current.get();
+    if (std::find(registry.retained.begin(), registry.retained.end(), registry.current) == registry.retained.end()) {
+      registry.retained.push_back(registry.current);
+    }
+  }
+  clock_.store(published, std::memory_order_release);
+}
+
 State::State() : type_(StateType::STATE), name_("none"), empty_(true) {}
 
 State::State(const StateType& type) : type_(type), name_("none"), empty_(true) {}
 
 State::State(const StateType& type, const std::string& name, const bool& empty)
-    : type_(type), name_(name), empty_(empty), timestamp_(std::chrono::steady_clock::now()) {}
+    : type_(type),
+      name_(name),
+      empty_(empty),
+      timestamp_(timestamp_policy_ == TimestampPolicy::EXPLICIT ? now() : policy_timestamp({})) {}
 
 State::State(const State& state)
-    : type_(state.type_), name_(state.name_), empty_(state.empty_), timestamp_(std::chrono::steady_clock::now()) {}
+    : type_(state.type_), name_(state.name_), empty_(state.empty_), timestamp_(policy_timestamp(state.timestamp_)) {}
 
 std::ostream& operator<<(std::ostream& os, const State& state) {
   if (state.is_empty()) {
@@ -0,0 +1,164 @@
+#include "state_representation/geometry/EllipseFitter.hpp"
+
+#include <eigen3/Eigen/Eigenvalues>
+
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include "state_representation/exceptions/NoSolutionToFitException.hpp"
+
+namespace state_representation {
+EllipseFitter::EllipseFitter(double forgetting_factor) {
+  this->set_forgetting_factor(forgetting_factor);
+  this->reset();
+}
+
+void EllipseFitter::set_forgetting_factor(double forgetting_factor) {
+  if (forgetting_factor <= 0 || forgetting_factor > 1) {
+    throw exceptions::InvalidParameterException("The forgetting factor has to be in ]0, 1]");
+  }
+  this->forgetting_factor_ = forgetting_factor;
+}
+
+void EllipseFitter::reset() {
+  this->scatter_.setZero();
+  this->origin_.setZero();
+  this->nb_points_ = 0;
+}
+
+void EllipseFitter::add_point(double x, double y) {
+  if (this->nb_points_ == 0) {
+    this->origin_ << x, y;
+  }
+  double p = x - this->origin_(0);
+  double q = y - this->origin_(1);
+  Eigen::Matrix<double, 6, 1> monomials;
+  monomials << p * p, p * q, q * q, p, q, 1;
+  if (this->forgetting_factor_ < 1) {
+    this->scatter_ *= this->forgetting_factor_;
+  }
+  this->scatter_.noalias() += monomials * monomials.transpose();
+  ++this->nb_points_;
+}
+
+void EllipseFitter::add_points(const Eigen::Ref<const Eigen::Matrix2Xd>& points) {
+  for (Eigen::Index i = 0; i < points.cols(); ++i) {
+    this->add_point(points(0, i), points(1, i));
+  }
+}
+
+Eigen::Vector2d EllipseFitter::get_mean() const {
+  if (this->nb_points_ == 0) {
+    return this->origin_;
+  }
+  return this->origin_ + this->scatter_.block<1, 2>(5, 3).transpose() / this->get_weight();
+}
+
+Eigen::Vector2d EllipseFitter::get_standard_deviation() const {
+  if (this->nb_points_ == 0) {
+    return Eigen::Vector2d::Zero();
+  }
+  double weight = this->get_weight();
+  Eigen::Vector2d mean = this->scatter_.block<1, 2>(5, 3).transpose() / weight;
+  Eigen::Vector2d second_moments(this->scatter_(3, 3) / weight, this->scatter_(4, 4) / weight);
+  return (second_moments - mean.cwiseAbs2()).cwiseMax(0).cwiseSqrt();
+}
+
+std::vector<double> EllipseFitter::solve() const {
+  if (this->nb_points_ < 5) {
+    throw exceptions::NoSolutionToFitException("At least 5 points are required to fit an ellipse");
+  }
+  std::vector<double> coefficients(6);
+  if (!this->solve(coefficients)) {
+    throw exceptions::NoSolutionToFitException("No solution found for the ellipse fitting, the points are degenerated");
+  }
+  return coefficients;
+}
+
+bool EllipseFitter::solve(std::vector<double>& coefficients) const {
+  if (this->nb_points_ < 5) {
+    return false;
+  }
+  // mean and spread of the points relative to the origin, read from the scatter matrix
+  double weight = this->get_weight();
+  Eigen::Vector2d mean = this->get_mean() - this->origin_;
+  Eigen::Vector2d deviation = this->get_standard_deviation();
+  double mx = mean(0), my = mean(1), sx = deviation(0), sy = deviation(1);
+  if (sx < 1e-12 || sy < 1e-12) {
+    return false;
+  }
+
+  // change of variables u = (p - mx) / sx, v = (q - my) / sy of the monomials
+  Eigen::Matrix<double, 6, 6> normalization = Eigen::Matrix<double, 6, 6>::Zero();
+  normalization.row(0) << 1, 0, 0, -2 * mx, 0, mx * mx;
+  normalization.row(0) /= sx * sx;
+  normalization.row(1) << 0, 1, 0, -my, -mx, mx * my;
+  normalization.row(1) /= sx * sy;
+  normalization.row(2) << 0, 0, 1, 0, -2 * my, my * my;
+  normalization.row(2) /= sy * sy;
+  normalization.row(3) << 0, 0, 0, 1, 0, -mx;
+  normalization.row(3) /= sx;
+  normalization.row(4) << 0, 0, 0, 0, 1, -my;
+  normalization.row(4) /= sy;
+  normalization(5, 5) = 1;
+  Eigen::Matrix<double, 6, 6> scatter = normalization * this->scatter_ * normalization.transpose();
+
+  // reduced eigenproblem on the quadratic coefficients, the linear ones being their least square solution
+  Eigen::Matrix3d s1 = scatter.topLeftCorner<3, 3>();
+  Eigen::Matrix3d s2 = scatter.topRightCorner<3, 3>();
+  Eigen::Matrix3d s3 = scatter.bottomRightCorner<3, 3>();
+  Eigen::LDLT<Eigen::Matrix3d> s3_decomposition(s3);
+  if (s3_decomposition.info() != Eigen::Success || s3_decomposition.vectorD().minCoeff() < 1e-12 * weight) {
+    return false;
+  }
+  Eigen::Matrix3d linear = -s3_decomposition.solve(s2.transpose());
+  Eigen::Matrix3d reduced = s1 + s2 * linear;
+  // premultiply by the inverse of the constraint matrix 4ac - b2 = 1
+  Eigen::Matrix3d constrained;
+  constrained.row(0) = 0.5 * reduced.row(2);
+  constrained.row(1) = -reduced.row(1);
+  constrained.row(2) = 0.5 * reduced.row(0);
+  Eigen::EigenSolver<Eigen::Matrix3d> solver(constrained);
+
+  // the solution is the only eigenvector satisfying the ellipse constraint
+  Eigen::Vector3d quadratic;
+  double best_constraint = 0;
+  for (Eigen::Index i = 0; i < 3; ++i) {
+    if (std::abs(solver.eigenvalues()(i).imag()) > 1e-12) {
+      continue;
+    }
+    Eigen::Vector3d candidate = solver.eigenvectors().col(i).real();
+    double constraint = 4 * candidate(0) * candidate(2) - candidate(1) * candidate(1);
+    if (constraint > best_constraint) {
+      best_constraint = constraint;
+      quadratic = candidate;
+    }
+  }
+  if (best_constraint <= 0) {
+    return false;
+  }
+  Eigen::Matrix<double, 6, 1> solution;
+  solution << quadratic, linear * quadratic;
+
+  // unnormalize the parameters, the center of the normalization in the original coordinates
+  double kx = this->origin_(0) + mx;
+  double ky = this->origin_(1) + my;
+  double sx2 = sx * sx;
+  double sy2 = sy * sy;
+  coefficients.resize(6);
+  coefficients[0] = solution(0) * sy2;
+  coefficients[1] = solution(1) * sx * sy;
+  coefficients[2] = solution(2) * sx2;
+  coefficients[3] = -2 * solution(0) * sy2 * kx - solution(1) * sx * sy * ky + solution(3) * sx * sy2;
+  coefficients[4] = -solution(1) * sx * sy * kx - 2 * solution(2) * sx2 * ky + solution(4) * sx2 * sy;
+  coefficients[5] = solution(0) * sy2 * kx * kx
+      + solution(1) * sx * sy * kx * ky
+      + solution(2) * sx2 * ky * ky
+      - solution(3) * sx * sy2 * kx
+      - solution(4) * sx2 * sy * ky
+      + solution(5) * sx2 * sy2;
+  return true;
+}
+
+Ellipsoid EllipseFitter::fit(const std::string& name, const std::string& reference_frame) const {
+  return Ellipsoid::from_algebraic_equation(name, this->solve(), reference_frame);
+}
+}// namespace state_representation
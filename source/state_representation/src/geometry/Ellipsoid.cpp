@@ -1,16 +1,48 @@
 #include "state_representation/geometry/Ellipsoid.hpp"
+#include "state_representation/geometry/EllipseFitter.hpp"
 #include "state_representation/exceptions/NoSolutionToFitException.hpp"
 
 namespace state_representation {
+namespace {
+/**
+ * @brief Rotation of the frame of the ellipsoid axes with respect to its reference frame
+ */
+Eigen::Matrix3d axes_rotation(const Ellipsoid& ellipsoid) {
+  return (ellipsoid.get_center_orientation()
+      * Eigen::AngleAxisd(ellipsoid.get_rotation_angle(), Eigen::Vector3d::UnitZ())).toRotationMatrix();
+}
+
+/**
+ * @brief Fit an ellipse on the points of a fitter, or give a circle of radius the noise level at the mean of
+ * the points if they are degenerated
+ */
+Ellipsoid fit_points(const EllipseFitter& fitter, const std::string& name, const std::string& reference_frame,
+                     double noise_level) {
+  if (fitter.get_number_of_points() == 0) {
+    throw exceptions::NoSolutionToFitException("No points to fit");
+  }
+  std::vector<double> coefficients;
+  if (fitter.solve(coefficients)) {
+    return Ellipsoid::from_algebraic_equation(name, coefficients, reference_frame);
+  }
+  Ellipsoid result(name, reference_frame);
+  result.set_center_position(Eigen::Vector3d(fitter.get_mean()(0), fitter.get_mean()(1), 0));
+  result.set_axis_lengths({noise_level, noise_level});
+  return result;
+}
+}// namespace
+
 Ellipsoid::Ellipsoid(const std::string& name, const std::string& reference_frame) :
     Shape(StateType::GEOMETRY_ELLIPSOID, name, reference_frame),
-    axis_lengths_({1., 1.}) {
+    axis_lengths_({1., 1.}),
+    rotation_angle_(0) {
   this->set_filled();
 }
 
 Ellipsoid::Ellipsoid(const Ellipsoid& ellipsoid) :
     Shape(ellipsoid),
-    axis_lengths_(ellipsoid.axis_lengths_) {
+    axis_lengths_(ellipsoid.axis_lengths_),
+    rotation_angle_(ellipsoid.rotation_angle_) {
   this->set_filled();
 }
 
@@ -82,87 +114,73 @@ const Ellipsoid Ellipsoid::fit(const std::string& name,
                                const std::list<CartesianPose>& points,
                                const std::string& reference_frame,
                                double noise_level) {
-  // define the constraint matrix
-  Eigen::SparseMatrix<double> constraint_matrix(6, 6);
-  constraint_matrix.insert(1, 1) = -1;
-  constraint_matrix.insert(0, 2) = 2;
-  constraint_matrix.insert(2, 0) = 2;
-
-  // preprocessing normalize the data TODO using PCA to find the plan
-  size_t nb_points = points.size();
-  Eigen::VectorXd x_value(nb_points);
-  Eigen::VectorXd y_value(nb_points);
-
-  // retry with noise everytime delta > 0
-  double delta;
-  std::vector<double> coefficients(6);
-  Eigen::GeneralizedEigenSolver<Eigen::Matrix<double, 6, 6>> solver;
-
-  std::default_random_engine generator;
-  std::normal_distribution<double> dist(0., noise_level);
-  do {
-    unsigned int i = 0;
-    for (const auto& p : points) {
-      x_value[i] = p.get_position()(0) + dist(generator);
-      y_value[i] = p.get_position()(1) + dist(generator);
-      ++i;
-    }
-
-    double xm = x_value.mean();
-    double ym = y_value.mean();
-    double sx = 0.5 * (x_value.maxCoeff() - x_value.minCoeff());
-    double sy = 0.5 * (y_value.maxCoeff() - y_value.minCoeff());
-    Eigen::VectorXd x_value_centered = (x_value.array() - xm) / sx;
-    Eigen::VectorXd y_value_centered = (y_value.array() - ym) / sy;
-
-    // compute the design matrix
-    Eigen::MatrixXd design_matrix(nb_points, 6);
-    design_matrix.col(0) = x_value_centered.array() * x_value_centered.array();
-    design_matrix.col(1) = x_value_centered.array() * y_value_centered.array();
-    design_matrix.col(2) = y_value_centered.array() * y_value_centered.array();
-    design_matrix.col(3) = x_value_centered;
-    design_matrix.col(4) = y_value_centered;
-    design_matrix.col(5) = Eigen::VectorXd::Ones(nb_points);
-
-    // compute the scatter matrix
-    Eigen::Matrix<double, 6, 6> scatter_matrix = design_matrix.transpose() * design_matrix;
-
-    // solve the generalized eigenvalue problem
-    solver.compute(scatter_matrix, constraint_matrix);
-
-    // solution correspon to the single positive eigenvalue
-    unsigned int solution_index;
-    double eigenvalue = solver.betas().maxCoeff(&solution_index);
-
-    // no solution case
-    if (eigenvalue < 0) {
-      throw exceptions::NoSolutionToFitException("No solution found for the ellipse fitting");
-    }
-
-    // extract the solution
-    Eigen::VectorXd solution = solver.eigenvectors().col(solution_index).real();
-
-    // unnormalize the parameters TODO inverse PCA
-    double kx = xm;
-    double ky = ym;
-    double sx2 = sx * sx;
-    double sy2 = sy * sy;
-
-    coefficients[0] = solution(0) * sy2;
-    coefficients[1] = solution(1) * sx * sy;
-    coefficients[2] = solution(2) * sx2;
-    coefficients[3] = -2 * solution(0) * sy2 * kx - solution(1) * sx * sy * ky + solution(3) * sx * sy2;
-    coefficients[4] = -solution(1) * sx * sy * kx - 2 * solution(2) * sx2 * ky + solution(4) * sx2 * sy;
-    coefficients[5] = solution(0) * sy2 * kx * kx
-        + solution(1) * sx * sy * kx * ky
-        + solution(2) * sx2 * ky * ky
-        - solution(3) * sx * sy2 * kx
-        - solution(4) * sx2 * sy * ky
-        + solution(5) * sx2 * sy2;
-
-    delta = coefficients[1] * coefficients[1] - 4 * coefficients[0] * coefficients[2];
-  } while (delta > 0);
-  return from_algebraic_equation(name, coefficients, reference_frame);
+  EllipseFitter fitter;
+  for (const auto& p : points) {
+    fitter.add_point(p.get_position()(0), p.get_position()(1));
+  }
+  return fit_points(fitter, name, reference_frame, noise_level);
+}
+
+const Ellipsoid Ellipsoid::fit(const std::string& name,
+                               const Eigen::Matrix2Xd& points,
+                               const std::string& reference_frame,
+                               double noise_level) {
+  EllipseFitter fitter;
+  fitter.add_points(points);
+  return fit_points(fitter, name, reference_frame, noise_level);
+}
+
+const Ellipsoid Ellipsoid::fit(const std::string& name,
+                               const Eigen::Matrix3Xd& points,
+                               const std::string& reference_frame,
+                               double noise_level) {
+  if (points.cols() == 0) {
+    throw exceptions::NoSolutionToFitException("No points to fit");
+  }
+  // estimate the plane of the ellipse, its normal being the direction of least variance
+  Eigen::Vector3d mean = points.rowwise().mean();
+  Eigen::Matrix3Xd centered = points.colwise() - mean;
+  Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(centered * centered.transpose());
+  Eigen::Matrix3d plane;
+  plane.col(0) = solver.eigenvectors().col(2);
+  plane.col(1) = solver.eigenvectors().col(1);
+  plane.col(2) = plane.col(0).cross(plane.col(1));
+
+  // fit the ellipse on the points projected in the plane
+  EllipseFitter fitter;
+  fitter.add_points((plane.transpose() * centered).topRows<2>());
+  Ellipsoid result = fit_points(fitter, name, reference_frame, noise_level);
+  result.set_center_orientation(Eigen::Quaterniond(plane));
+  result.set_center_position(mean + plane * result.get_center_position());
+  return result;
+}
+
+Eigen::Vector3d Ellipsoid::get_closest_point(const Eigen::Vector3d& point) const {
+  Eigen::Matrix3d rotation = axes_rotation(*this);
+  Eigen::Vector3d local = rotation.transpose() * (point - this->get_center_position());
+  project_on_ellipse(this->get_axis_length(0), this->get_axis_length(1), local(0), local(1), local(0), local(1));
+  return this->get_center_position() + rotation * local;
+}
+
+double Ellipsoid::signed_distance(const Eigen::Vector3d& point) const {
+  double distance = (point - this->get_closest_point(point)).norm();
+  return this->is_inside(point) ? -distance : distance;
+}
+
+bool Ellipsoid::is_inside(const Eigen::Vector3d& point) const {
+  Eigen::Vector3d local = axes_rotation(*this).transpose() * (point - this->get_center_position());
+  return (local.head<2>().array() / Eigen::Array2d(this->get_axis_length(0), this->get_axis_length(1)))
+      .matrix().squaredNorm() < 1;
+}
+
+Eigen::Vector3d Ellipsoid::get_normal(const Eigen::Vector3d& point) const {
+  Eigen::Matrix3d rotation = axes_rotation(*this);
+  Eigen::Vector3d local = rotation.transpose() * (point - this->get_center_position());
+  double a = this->get_axis_length(0);
+  double b = this->get_axis_length(1);
+  double x, y;
+  project_on_ellipse(a, b, local(0), local(1), x, y);
+  return rotation * Eigen::Vector3d(x / (a * a), y / (b * b), 0).normalized();
 }
 
 std::ostream& operator<<(std::ostream& os, const Ellipsoid& ellipsoid) {
@@ -0,0 +1,62 @@
+#include "state_representation/geometry/EllipsoidEstimator.hpp"
+
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+
+namespace state_representation {
+EllipsoidEstimator::EllipsoidEstimator(const std::string& name, const CartesianPose& plane, double forgetting_factor) :
+    plane_(plane), fitter_(forgetting_factor), estimate_(name, plane.get_reference_frame()), has_estimate_(false),
+    coefficients_(6) {
+  this->estimate_.set_center_pose(CartesianPose(name, plane.get_position(), plane.get_orientation(),
+                                                plane.get_reference_frame()));
+}
+
+void EllipsoidEstimator::bind(const std::shared_ptr<Parameter<Ellipsoid>>& parameter) {
+  this->bound_parameter_ = parameter;
+  if (this->bound_parameter_ != nullptr && this->has_estimate_) {
+    this->copy_estimate(this->bound_parameter_->get_value());
+  }
+}
+
+bool EllipsoidEstimator::add_point(const Eigen::Vector3d& position) {
+  Eigen::Vector3d local = this->plane_.get_orientation().conjugate() * (position - this->plane_.get_position());
+  this->fitter_.add_point(local(0), local(1));
+  if (!this->fitter_.solve(this->coefficients_)) {
+    return false;
+  }
+  Ellipsoid fitted = Ellipsoid::from_algebraic_equation(this->estimate_.get_name(), this->coefficients_);
+  const auto& axis_lengths = fitted.get_axis_lengths();
+  if (!std::isfinite(axis_lengths[0]) || !std::isfinite(axis_lengths[1])) {
+    return false;
+  }
+  this->estimate_.set_center_position(
+      this->plane_.get_position() + this->plane_.get_orientation() * fitted.get_center_position());
+  this->estimate_.set_axis_lengths(axis_lengths);
+  this->estimate_.set_rotation_angle(fitted.get_rotation_angle());
+  this->has_estimate_ = true;
+  if (this->bound_parameter_ != nullptr) {
+    this->copy_estimate(this->bound_parameter_->get_value());
+  }
+  return true;
+}
+
+bool EllipsoidEstimator::add_point(const CartesianPose& point) {
+  if (point.get_reference_frame() != this->plane_.get_reference_frame()) {
+    throw exceptions::IncompatibleReferenceFramesException(
+        "The point " + point.get_name() + " is expressed in " + point.get_reference_frame() + " instead of "
+            + this->plane_.get_reference_frame());
+  }
+  return this->add_point(point.get_position());
+}
+
+void EllipsoidEstimator::copy_estimate(Ellipsoid& ellipsoid) const {
+  ellipsoid.set_center_position(this->estimate_.get_center_position());
+  ellipsoid.set_center_orientation(this->estimate_.get_center_orientation());
+  ellipsoid.set_axis_lengths(this->estimate_.get_axis_lengths());
+  ellipsoid.set_rotation_angle(this->estimate_.get_rotation_angle());
+}
+
+void EllipsoidEstimator::reset() {
+  this->fitter_.reset();
+  this->has_estimate_ = false;
+}
+}// namespace state_representation
@@ -0,0 +1,361 @@
+#include "state_representation/geometry/ShapeSet.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+namespace {
+/**
+ * @brief Maximum number of shapes in a leaf of the hierarchy
+ */
+constexpr std::size_t LEAF_SIZE = 4;
+
+/**
+ * @brief Lower bound of the signed distance of a point to the shapes within a box, unbounded below if the point
+ * is inside the box as it can be inside one of the shapes
+ */
+inline double lower_bound(const Eigen::AlignedBox3d& box, const Eigen::Vector3d& point) {
+  double distance = box.exteriorDistance(point);
+  return distance > 0 ? distance : -std::numeric_limits<double>::infinity();
+}
+
+/**
+ * @brief Stack of the nodes to visit in a depth first traversal of the hierarchy, without allocation. It holds
+ * at most one node per level plus one, and the median split keeps the depth below the logarithm of the number
+ * of shapes, such that its capacity is never reached.
+ */
+class NodeStack {
+private:
+  std::array<int, 64> nodes_;
+  std::size_t size_ = 0;
+
+public:
+  void push(int node) {
+    this->nodes_[this->size_++] = node;
+  }
+
+  int pop() {
+    return this->nodes_[--this->size_];
+  }
+
+  bool empty() const {
+    return this->size_ == 0;
+  }
+};
+}// namespace
+
+ShapeSet::ShapeSet(const std::string& reference_frame) :
+    reference_frame_(reference_frame), hierarchy_valid_(false) {}
+
+std::size_t ShapeSet::add(const Ellipsoid& ellipsoid) {
+  auto index = this->get_size();
+  this->hierarchy_valid_ = false;
+  this->data_.conservativeResize(this->data_.rows() + 1, Eigen::NoChange);
+  this->names_.emplace_back();
+  try {
+    this->set(index, ellipsoid);
+  } catch (...) {
+    this->data_.conservativeResize(this->data_.rows() - 1, Eigen::NoChange);
+    this->names_.pop_back();
+    throw;
+  }
+  return index;
+}
+
+void ShapeSet::set(std::size_t index, const Ellipsoid& ellipsoid) {
+  if (ellipsoid.get_center_pose().get_reference_frame() != this->reference_frame_) {
+    throw exceptions::IncompatibleReferenceFramesException(
+        "The ellipsoid " + ellipsoid.get_name() + " is not expressed in the reference frame "
+            + this->reference_frame_ + " of the set");
+  }
+  if (ellipsoid.get_axis_length(0) <= 0 || ellipsoid.get_axis_length(1) <= 0) {
+    throw exceptions::InvalidParameterException("The axis lengths of the ellipsoid " + ellipsoid.get_name() + " have to be positive");
+  }
+  Eigen::Matrix3d rotation = (ellipsoid.get_center_orientation()
+      * Eigen::AngleAxisd(ellipsoid.get_rotation_angle(), Eigen::Vector3d::UnitZ())).toRotationMatrix();
+  auto i = static_cast<Eigen::Index>(index);
+  this->names_.at(index) = ellipsoid.get_name();
+  this->data_.block<1, 3>(i, 0) = ellipsoid.get_center_position().transpose();
+  this->data_.block<1, 3>(i, 3) = rotation.col(0).transpose();
+  this->data_.block<1, 3>(i, 6) = rotation.col(1).transpose();
+  this->data_(i, 9) = ellipsoid.get_axis_length(0);
+  this->data_(i, 10) = ellipsoid.get_axis_length(1);
+  if (this->hierarchy_valid_) {
+    this->refit_hierarchy(index);
+  }
+}
+
+void ShapeSet::clear() {
+  this->data_.resize(0, Eigen::NoChange);
+  this->names_.clear();
+  this->nodes_.clear();
+  this->ordering_.clear();
+  this->leaves_.clear();
+  this->hierarchy_valid_ = false;
+}
+
+inline bool ShapeSet::is_inside(Eigen::Index index, const Eigen::Vector3d& point) const {
+  double dx = point(0) - this->data_(index, 0);
+  double dy = point(1) - this->data_(index, 1);
+  double dz = point(2) - this->data_(index, 2);
+  double u = (this->data_(index, 3) * dx + this->data_(index, 4) * dy + this->data_(index, 5) * dz)
+      / this->data_(index, 9);
+  double v = (this->data_(index, 6) * dx + this->data_(index, 7) * dy + this->data_(index, 8) * dz)
+      / this->data_(index, 10);
+  return u * u + v * v < 1;
+}
+
+inline double ShapeSet::evaluate(Eigen::Index index, const Eigen::Vector3d& point, Eigen::Vector3d& normal) const {
+  double dx = point(0) - this->data_(index, 0);
+  double dy = point(1) - this->data_(index, 1);
+  double dz = point(2) - this->data_(index, 2);
+  double u = this->data_(index, 3) * dx + this->data_(index, 4) * dy + this->data_(index, 5) * dz;
+  double v = this->data_(index, 6) * dx + this->data_(index, 7) * dy + this->data_(index, 8) * dz;
+  double a = this->data_(index, 9);
+  double b = this->data_(index, 10);
+  double x, y;
+  Ellipsoid::project_on_ellipse(a, b, u, v, x, y);
+  // the outward normal at the closest point is the gradient of the implicit equation
+  double nx = x / (a * a);
+  double ny = y / (b * b);
+  double norm = std::sqrt(nx * nx + ny * ny);
+  nx /= norm;
+  ny /= norm;
+  normal << nx * this->data_(index, 3) + ny * this->data_(index, 6),
+      nx * this->data_(index, 4) + ny * this->data_(index, 7),
+      nx * this->data_(index, 5) + ny * this->data_(index, 8);
+  double distance = std::sqrt((u - x) * (u - x) + (v - y) * (v - y));
+  return (u * u) / (a * a) + (v * v) / (b * b) < 1 ? -distance : distance;
+}
+
+void ShapeSet::signed_distances(const Eigen::Vector3d& point, Eigen::VectorXd& distances) const {
+  distances.resize(this->data_.rows());
+  Eigen::Vector3d normal;
+  for (Eigen::Index i = 0; i < this->data_.rows(); ++i) {
+    distances(i) = this->evaluate(i, point, normal);
+  }
+}
+
+void ShapeSet::signed_distances(const Eigen::Matrix3Xd& points, Eigen::MatrixXd& distances) const {
+  distances.resize(this->data_.rows(), points.cols());
+  Eigen::Vector3d normal;
+  for (Eigen::Index j = 0; j < points.cols(); ++j) {
+    for (Eigen::Index i = 0; i < this->data_.rows(); ++i) {
+      distances(i, j) = this->evaluate(i, points.col(j), normal);
+    }
+  }
+}
+
+void ShapeSet::evaluate(const Eigen::Vector3d& point, Eigen::VectorXd& distances, Eigen::Matrix3Xd& normals) const {
+  distances.resize(this->data_.rows());
+  normals.resize(Eigen::NoChange, this->data_.rows());
+  Eigen::Vector3d normal;
+  for (Eigen::Index i = 0; i < this->data_.rows(); ++i) {
+    distances(i) = this->evaluate(i, point, normal);
+    normals.col(i) = normal;
+  }
+}
+
+void ShapeSet::contains(const Eigen::Matrix3Xd& points,
+                        Eigen::Array<bool, Eigen::Dynamic, Eigen::Dynamic>& inside) const {
+  inside.resize(this->data_.rows(), points.cols());
+  for (Eigen::Index j = 0; j < points.cols(); ++j) {
+    for (Eigen::Index i = 0; i < this->data_.rows(); ++i) {
+      inside(i, j) = this->is_inside(i, points.col(j));
+    }
+  }
+}
+
+bool ShapeSet::contains_any(const Eigen::Vector3d& point) const {
+  for (Eigen::Index i = 0; i < this->data_.rows(); ++i) {
+    if (this->is_inside(i, point)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+Eigen::AlignedBox3d ShapeSet::bounding_box(Eigen::Index index) const {
+  Eigen::Vector3d first_axis = this->data_.block<1, 3>(index, 3).transpose() * this->data_(index, 9);
+  Eigen::Vector3d second_axis = this->data_.block<1, 3>(index, 6).transpose() * this->data_(index, 10);
+  Eigen::Vector3d extrusion = first_axis.cross(second_axis).normalized();
+  Eigen::Vector3d extent;
+  for (Eigen::Index k = 0; k < 3; ++k) {
+    extent(k) = std::abs(extrusion(k)) > 1e-9 ? std::numeric_limits<double>::infinity()
+                                                : std::sqrt(first_axis(k) * first_axis(k)
+                                                                + second_axis(k) * second_axis(k));
+  }
+  Eigen::Vector3d center = this->data_.block<1, 3>(index, 0).transpose();
+  return Eigen::AlignedBox3d(center - extent, center + extent);
+}
+
+int ShapeSet::build_node(std::size_t begin, std::size_t end, const std::vector<Eigen::AlignedBox3d>& boxes) {
+  Node node{Eigen::AlignedBox3d(), -1, -1, -1, begin, end};
+  Eigen::AlignedBox3d centers;
+  for (std::size_t i = begin; i < end; ++i) {
+    node.box.extend(boxes[this->ordering_[i]]);
+    centers.extend(this->data_.block<1, 3>(static_cast<Eigen::Index>(this->ordering_[i]), 0).transpose());
+  }
+  auto index = static_cast<int>(this->nodes_.size());
+  this->nodes_.push_back(node);
+  if (end - begin <= LEAF_SIZE) {
+    for (std::size_t i = begin; i < end; ++i) {
+      this->leaves_[this->ordering_[i]] = index;
+    }
+    return index;
+  }
+  // split at the median of the centers along the direction of largest spread
+  Eigen::Index axis;
+  centers.sizes().maxCoeff(&axis);
+  std::size_t middle = begin + (end - begin) / 2;
+  std::nth_element(this->ordering_.begin() + static_cast<std::ptrdiff_t>(begin),
+                   this->ordering_.begin() + static_cast<std::ptrdiff_t>(middle),
+                   this->ordering_.begin() + static_cast<std::ptrdiff_t>(end),
+                   [this, axis](std::size_t lhs, std::size_t rhs) {
+                     return this->data_(static_cast<Eigen::Index>(lhs), axis)
+                         < this->data_(static_cast<Eigen::Index>(rhs), axis);
+                   });
+  int left = this->build_node(begin, middle, boxes);
+  int right = this->build_node(middle, end, boxes);
+  this->nodes_[index].left = left;
+  this->nodes_[index].right = right;
+  this->nodes_[left].parent = index;
+  this->nodes_[right].parent = index;
+  return index;
+}
+
+void ShapeSet::refit_hierarchy(std::size_t index) {
+  Node& leaf = this->nodes_[this->leaves_[index]];
+  leaf.box.setEmpty();
+  for (std::size_t i = leaf.begin; i < leaf.end; ++i) {
+    leaf.box.extend(this->bounding_box(static_cast<Eigen::Index>(this->ordering_[i])));
+  }
+  for (int parent = leaf.parent; parent >= 0; parent = this->nodes_[parent].parent) {
+    Node& node = this->nodes_[parent];
+    node.box = this->nodes_[node.left].box.merged(this->nodes_[node.right].box);
+  }
+}
+
+void ShapeSet::build_hierarchy() {
+  this->nodes_.clear();
+  this->ordering_.resize(this->get_size());
+  this->leaves_.assign(this->get_size(), -1);
+  std::iota(this->ordering_.begin(), this->ordering_.end(), 0);
+  if (!this->ordering_.empty()) {
+    std::vector<Eigen::AlignedBox3d> boxes(this->ordering_.size());
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+      boxes[i] = this->bounding_box(static_cast<Eigen::Index>(i));
+    }
+    this->build_node(0, this->ordering_.size(), boxes);
+  }
+  this->hierarchy_valid_ = true;
+}
+
+int ShapeSet::nearest(const Eigen::Vector3d& point, double& distance) const {
+  distance = std::numeric_limits<double>::infinity();
+  int nearest = -1;
+  Eigen::Vector3d normal;
+  if (!this->hierarchy_valid_) {
+    for (Eigen::Index i = 0; i < this->data_.rows(); ++i) {
+      double candidate = this->evaluate(i, point, normal);
+      if (candidate < distance) {
+        distance = candidate;
+        nearest = static_cast<int>(i);
+      }
+    }
+    return nearest;
+  }
+  if (this->nodes_.empty()) {
+    return nearest;
+  }
+  // depth first traversal visiting the closest child first, skipping the nodes that cannot improve the distance
+  NodeStack stack;
+  stack.push(0);
+  while (!stack.empty()) {
+    const Node& node = this->nodes_[stack.pop()];
+    if (lower_bound(node.box, point) >= distance) {
+      continue;
+    }
+    if (node.left < 0) {
+      for (std::size_t i = node.begin; i < node.end; ++i) {
+        double candidate = this->evaluate(static_cast<Eigen::Index>(this->ordering_[i]), point, normal);
+        if (candidate < distance) {
+          distance = candidate;
+          nearest = static_cast<int>(this->ordering_[i]);
+        }
+      }
+    } else if (lower_bound(this->nodes_[node.left].box, point) < lower_bound(this->nodes_[node.right].box, point)) {
+      stack.push(node.right);
+      stack.push(node.left);
+    } else {
+      stack.push(node.left);
+      stack.push(node.right);
+    }
+  }
+  return nearest;
+}
+
+void ShapeSet::collect_candidates(const Eigen::Vector3d& point, double radius,
+                                  std::vector<std::size_t>& candidates) const {
+  candidates.clear();
+  if (!this->hierarchy_valid_) {
+    candidates.resize(this->get_size());
+    std::iota(candidates.begin(), candidates.end(), 0);
+    return;
+  }
+  if (this->nodes_.empty()) {
+    return;
+  }
+  NodeStack stack;
+  stack.push(0);
+  while (!stack.empty()) {
+    const Node& node = this->nodes_[stack.pop()];
+    if (lower_bound(node.box, point) >= radius) {
+      continue;
+    }
+    if (node.left < 0) {
+      candidates.insert(candidates.end(), this->ordering_.begin() + static_cast<std::ptrdiff_t>(node.begin),
+                        this->ordering_.begin() + static_cast<std::ptrdiff_t>(node.end));
+    } else {
+      stack.push(node.left);
+      stack.push(node.right);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+}
+
+void ShapeSet::query(const Eigen::Vector3d& point, double radius, std::vector<std::size_t>& indices) const {
+  this->collect_candidates(point, radius, indices);
+  Eigen::Vector3d normal;
+  auto last = std::remove_if(indices.begin(), indices.end(), [&](std::size_t index) {
+    return this->evaluate(static_cast<Eigen::Index>(index), point, normal) >= radius;
+  });
+  indices.erase(last, indices.end());
+}
+
+void ShapeSet::query(const Eigen::Vector3d& point, double radius, std::vector<std::size_t>& indices,
+                     Eigen::VectorXd& distances, Eigen::Matrix3Xd& normals) const {
+  this->collect_candidates(point, radius, indices);
+  distances.resize(static_cast<Eigen::Index>(indices.size()));
+  normals.resize(Eigen::NoChange, static_cast<Eigen::Index>(indices.size()));
+  Eigen::Index count = 0;
+  Eigen::Vector3d normal;
+  for (std::size_t index : indices) {
+    double distance = this->evaluate(static_cast<Eigen::Index>(index), point, normal);
+    if (distance < radius) {
+      indices[count] = index;
+      distances(count) = distance;
+      normals.col(count) = normal;
+      ++count;
+    }
+  }
+  indices.resize(static_cast<std::size_t>(count));
+  distances.conservativeResize(count);
+  normals.conservativeResize(Eigen::NoChange, count);
+}
+}// namespace state_representation
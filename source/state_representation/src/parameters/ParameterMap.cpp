@@ -0,0 +1,242 @@
+#include "state_representation/parameters/ParameterMap.hpp"
+
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/robot/JointPositions.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+
+namespace state_representation {
+namespace {
+template<typename T>
+Parameter<T>& as(const std::shared_ptr<ParameterInterface>& parameter) {
+  return static_cast<Parameter<T>&>(*parameter);
+}
+}// namespace
+
+ParameterMap::ParameterMap() : flat_size_(0) {}
+
+ParameterMap::ParameterMap(const std::list<std::shared_ptr<ParameterInterface>>& parameters) : ParameterMap() {
+  for (const auto& parameter : parameters) {
+    this->add_parameter(parameter);
+  }
+}
+
+void ParameterMap::add_parameter(const std::shared_ptr<ParameterInterface>& parameter) {
+  if (parameter == nullptr) {
+    throw exceptions::InvalidParameterException("Cannot add a null parameter");
+  }
+  if (this->has_parameter(parameter->get_name())) {
+    throw exceptions::InvalidParameterException("Parameter " + parameter->get_name() + " already exists in the map");
+  }
+  // the kind is given by the dynamic type, which can differ from the type attribute after a conversion
+  FlatKind kind = FlatKind::NONE;
+  if (std::dynamic_pointer_cast<Parameter<double>>(parameter)) {
+    kind = FlatKind::DOUBLE;
+  } else if (std::dynamic_pointer_cast<Parameter<bool>>(parameter)) {
+    kind = FlatKind::BOOL;
+  } else if (std::dynamic_pointer_cast<Parameter<std::vector<double>>>(parameter)) {
+    kind = FlatKind::DOUBLE_ARRAY;
+  } else if (std::dynamic_pointer_cast<Parameter<Eigen::VectorXd>>(parameter)) {
+    kind = FlatKind::VECTOR;
+  } else if (std::dynamic_pointer_cast<Parameter<Eigen::MatrixXd>>(parameter)) {
+    kind = FlatKind::MATRIX;
+  } else if (std::dynamic_pointer_cast<Parameter<CartesianState>>(parameter)) {
+    kind = FlatKind::CARTESIAN_STATE;
+  } else if (std::dynamic_pointer_cast<Parameter<CartesianPose>>(parameter)) {
+    kind = FlatKind::CARTESIAN_POSE;
+  } else if (std::dynamic_pointer_cast<Parameter<JointState>>(parameter)) {
+    kind = FlatKind::JOINT_STATE;
+  } else if (std::dynamic_pointer_cast<Parameter<JointPositions>>(parameter)) {
+    kind = FlatKind::JOINT_POSITIONS;
+  }
+  this->indices_.emplace(parameter->get_name(), this->parameters_.size());
+  this->parameters_.push_back(parameter);
+  this->flat_kinds_.push_back(kind);
+  this->flat_offsets_.push_back(this->flat_size_);
+  this->flat_sizes_.push_back(this->compute_flat_size(this->parameters_.size() - 1));
+  this->flat_size_ += this->flat_sizes_.back();
+}
+
+bool ParameterMap::has_parameter(const std::string& name) const {
+  return this->indices_.find(name) != this->indices_.end();
+}
+
+std::size_t ParameterMap::get_index(const std::string& name) const {
+  auto it = this->indices_.find(name);
+  if (it == this->indices_.end()) {
+    throw exceptions::InvalidParameterException("Parameter " + name + " does not exist in the map");
+  }
+  return it->second;
+}
+
+const std::shared_ptr<ParameterInterface>& ParameterMap::get_parameter(const std::string& name) const {
+  return this->parameters_[this->get_index(name)];
+}
+
+std::list<std::shared_ptr<ParameterInterface>> ParameterMap::to_list() const {
+  return std::list<std::shared_ptr<ParameterInterface>>(this->parameters_.begin(), this->parameters_.end());
+}
+
+std::size_t ParameterMap::compute_flat_size(std::size_t index) const {
+  const auto& parameter = this->parameters_[index];
+  switch (this->flat_kinds_[index]) {
+    case FlatKind::DOUBLE:
+    case FlatKind::BOOL:
+      return 1;
+    case FlatKind::DOUBLE_ARRAY:
+      return as<std::vector<double>>(parameter).get_value().size();
+    case FlatKind::VECTOR:
+      return as<Eigen::VectorXd>(parameter).get_value().size();
+    case FlatKind::MATRIX:
+      return as<Eigen::MatrixXd>(parameter).get_value().size();
+    case FlatKind::CARTESIAN_STATE:
+    case FlatKind::CARTESIAN_POSE:
+      return 7;
+    case FlatKind::JOINT_STATE:
+      return as<JointState>(parameter).get_value().get_size();
+    case FlatKind::JOINT_POSITIONS:
+      return as<JointPositions>(parameter).get_value().get_size();
+    default:
+      return 0;
+  }
+}
+
+void ParameterMap::update_flat_layout() const {
+  std::size_t offset = 0;
+  for (std::size_t i = 0; i < this->parameters_.size(); ++i) {
+    this->flat_offsets_[i] = offset;
+    this->flat_sizes_[i] = this->compute_flat_size(i);
+    offset += this->flat_sizes_[i];
+  }
+  this->flat_size_ = offset;
+}
+
+std::size_t ParameterMap::get_flat_size() const {
+  this->update_flat_layout();
+  return this->flat_size_;
+}
+
+std::size_t ParameterMap::get_flat_offset(std::size_t index) const {
+  this->update_flat_layout();
+  return this->flat_offsets_.at(index);
+}
+
+std::size_t ParameterMap::get_flat_size(std::size_t index) const {
+  this->update_flat_layout();
+  return this->flat_sizes_.at(index);
+}
+
+void ParameterMap::get_flat_values(double* buffer) const {
+  this->update_flat_layout();
+  for (std::size_t i = 0; i < this->parameters_.size(); ++i) {
+    const auto& parameter = this->parameters_[i];
+    double* values = buffer + this->flat_offsets_[i];
+    auto size = static_cast<Eigen::Index>(this->flat_sizes_[i]);
+    switch (this->flat_kinds_[i]) {
+      case FlatKind::NONE:
+        break;
+      case FlatKind::DOUBLE:
+        values[0] = as<double>(parameter).get_value();
+        break;
+      case FlatKind::BOOL:
+        values[0] = as<bool>(parameter).get_value() ? 1. : 0.;
+        break;
+      case FlatKind::DOUBLE_ARRAY: {
+        const auto& value = as<std::vector<double>>(parameter).get_value();
+        std::copy(value.begin(), value.end(), values);
+        break;
+      }
+      case FlatKind::VECTOR: {
+        const auto& value = as<Eigen::VectorXd>(parameter).get_value();
+        Eigen::VectorXd::Map(values, size) = value;
+        break;
+      }
+      case FlatKind::MATRIX: {
+        const auto& value = as<Eigen::MatrixXd>(parameter).get_value();
+        Eigen::MatrixXd::Map(values, value.rows(), value.cols()) = value;
+        break;
+      }
+      case FlatKind::CARTESIAN_STATE:
+        Eigen::Matrix<double, 7, 1>::Map(values) = as<CartesianState>(parameter).get_value().get_pose();
+        break;
+      case FlatKind::CARTESIAN_POSE:
+        Eigen::Matrix<double, 7, 1>::Map(values) = as<CartesianPose>(parameter).get_value().get_pose();
+        break;
+      case FlatKind::JOINT_STATE: {
+        const auto& value = as<JointState>(parameter).get_value();
+        Eigen::VectorXd::Map(values, size) = value.get_positions();
+        break;
+      }
+      case FlatKind::JOINT_POSITIONS: {
+        const auto& value = as<JointPositions>(parameter).get_value();
+        Eigen::VectorXd::Map(values, size) = value.get_positions();
+        break;
+      }
+    }
+  }
+}
+
+Eigen::VectorXd ParameterMap::get_flat_values() const {
+  Eigen::VectorXd values(this->get_flat_size());
+  this->get_flat_values(values.data());
+  return values;
+}
+
+void ParameterMap::set_flat_values(const double* buffer) {
+  this->update_flat_layout();
+  for (std::size_t i = 0; i < this->parameters_.size(); ++i) {
+    const auto& parameter = this->parameters_[i];
+    const double* values = buffer + this->flat_offsets_[i];
+    auto size = static_cast<Eigen::Index>(this->flat_sizes_[i]);
+    switch (this->flat_kinds_[i]) {
+      case FlatKind::NONE:
+        break;
+      case FlatKind::DOUBLE:
+        as<double>(parameter).set_value(values[0]);
+        break;
+      case FlatKind::BOOL:
+        as<bool>(parameter).set_value(values[0] != 0.);
+        break;
+      case FlatKind::DOUBLE_ARRAY: {
+        auto& value = as<std::vector<double>>(parameter).get_value();
+        std::copy(values, values + size, value.begin());
+        break;
+      }
+      case FlatKind::VECTOR: {
+        auto& value = as<Eigen::VectorXd>(parameter).get_value();
+        value = Eigen::VectorXd::Map(values, size);
+        break;
+      }
+      case FlatKind::MATRIX: {
+        auto& value = as<Eigen::MatrixXd>(parameter).get_value();
+        value = Eigen::MatrixXd::Map(values, value.rows(), value.cols());
+        break;
+      }
+      case FlatKind::CARTESIAN_STATE:
+        as<CartesianState>(parameter).get_value().set_pose(Eigen::Matrix<double, 7, 1>::Map(values));
+        break;
+      case FlatKind::CARTESIAN_POSE:
+        as<CartesianPose>(parameter).get_value().set_pose(Eigen::Matrix<double, 7, 1>::Map(values));
+        break;
+      case FlatKind::JOINT_STATE: {
+        auto& value = as<JointState>(parameter).get_value();
+        value.set_positions(Eigen::VectorXd::Map(values, size));
+        break;
+      }
+      case FlatKind::JOINT_POSITIONS: {
+        auto& value = as<JointPositions>(parameter).get_value();
+        value.set_positions(Eigen::VectorXd::Map(values, size));
+        break;
+      }
+    }
+  }
+}
+
+void ParameterMap::set_flat_values(const Eigen::VectorXd& values) {
+  if (static_cast<std::size_t>(values.size()) != this->get_flat_size()) {
+    throw exceptions::IncompatibleSizeException("Input vector is of incorrect size, expected "
+                                                    + std::to_string(this->flat_size_) + " values, got "
+                                                    + std::to_string(values.size()));
+  }
+  this->set_flat_values(values.data());
+}
+}// namespace state_representation
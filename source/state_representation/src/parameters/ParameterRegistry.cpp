@@ -0,0 +1,58 @@
+#include "state_representation/parameters/ParameterRegistry.hpp"
+
+namespace state_representation {
+ParameterSlotInterface& ParameterRegistry::get_slot(const std::string& name) const {
+  auto it = this->indices_.find(name);
+  if (it == this->indices_.end()) {
+    throw exceptions::InvalidParameterException("Parameter " + name + " does not exist in the registry");
+  }
+  return *this->slots_[it->second];
+}
+
+void ParameterRegistry::add_change_callback(const ChangeCallback& callback) {
+  this->callbacks_.push_back(callback);
+}
+
+std::size_t ParameterRegistry::get_size() const {
+  return this->slots_.size();
+}
+
+const std::string& ParameterRegistry::get_name(std::size_t index) const {
+  return this->slots_.at(index)->get_name();
+}
+
+bool ParameterRegistry::has_parameter(const std::string& name) const {
+  return this->indices_.find(name) != this->indices_.end();
+}
+
+void ParameterRegistry::set_parameter(const std::shared_ptr<ParameterInterface>& parameter) const {
+  this->get_slot(parameter->get_name()).publish(*parameter);
+}
+
+std::size_t ParameterRegistry::update() {
+  this->changed_.clear();
+  for (std::size_t i = 0; i < this->slots_.size(); ++i) {
+    if (this->slots_[i]->latch()) {
+      this->changed_.push_back(i);
+    }
+  }
+  if (!this->changed_.empty()) {
+    for (const auto& callback : this->callbacks_) {
+      callback(*this, this->changed_);
+    }
+  }
+  return this->changed_.size();
+}
+
+const std::vector<std::size_t>& ParameterRegistry::get_changed() const {
+  return this->changed_;
+}
+
+std::list<std::shared_ptr<ParameterInterface>> ParameterRegistry::get_parameters() const {
+  std::list<std::shared_ptr<ParameterInterface>> parameters;
+  for (const auto& slot : this->slots_) {
+    parameters.push_back(slot->to_parameter());
+  }
+  return parameters;
+}
+}// namespace state_representation
@@ -0,0 +1,220 @@
+#include "state_representation/parameters/PredicateEngine.hpp"
+
+#include <limits>
+
+namespace state_representation {
+static constexpr std::size_t NO_COMPARISON = std::numeric_limits<std::size_t>::max();
+
+PredicateEngine::PredicateEngine() : combination_offsets_{0} {}
+
+std::size_t PredicateEngine::add_variable(const std::string& name, double value) {
+  if (this->variable_indices_.find(name) != this->variable_indices_.end()) {
+    throw exceptions::InvalidParameterException("Variable " + name + " already exists in the engine");
+  }
+  this->variable_indices_.emplace(name, this->variables_.size());
+  this->variable_names_.push_back(name);
+  this->variables_.push_back(value);
+  return this->variables_.size() - 1;
+}
+
+std::size_t PredicateEngine::add_variable(const std::string& name, const std::function<double()>& sampler) {
+  if (!sampler) {
+    throw exceptions::InvalidParameterException("Variable " + name + " requires a valid sampler");
+  }
+  std::size_t index = this->add_variable(name, sampler());
+  this->samplers_.emplace_back(index, sampler);
+  return index;
+}
+
+std::size_t PredicateEngine::get_variable_index(const std::string& name) const {
+  auto it = this->variable_indices_.find(name);
+  if (it == this->variable_indices_.end()) {
+    throw exceptions::InvalidParameterException("Variable " + name + " does not exist in the engine");
+  }
+  return it->second;
+}
+
+double PredicateEngine::get_variable(std::size_t index) const {
+  return this->variables_.at(index);
+}
+
+void PredicateEngine::set_variable(std::size_t index, double value) {
+  this->variables_.at(index) = value;
+}
+
+void PredicateEngine::set_variable(const std::string& name, double value) {
+  this->variables_[this->get_variable_index(name)] = value;
+}
+
+std::size_t PredicateEngine::allocate_condition(const std::string& name) {
+  if (this->indices_.find(name) != this->indices_.end()) {
+    throw exceptions::InvalidParameterException("Condition " + name + " already exists in the engine");
+  }
+  this->indices_.emplace(name, this->names_.size());
+  this->names_.push_back(name);
+  this->comparison_indices_.push_back(NO_COMPARISON);
+  this->values_.push_back(0);
+  this->previous_values_.push_back(0);
+  this->callbacks_.emplace_back();
+  this->predicates_.emplace_back();
+  this->changed_.reserve(this->names_.size());
+  return this->names_.size() - 1;
+}
+
+std::size_t PredicateEngine::add_condition(
+    const std::string& name, const std::string& variable, ComparisonOperator comparison, double threshold
+) {
+  std::size_t variable_index = this->get_variable_index(variable);
+  std::size_t index = this->allocate_condition(name);
+  double sign = (comparison == ComparisonOperator::GREATER || comparison == ComparisonOperator::GREATER_EQUAL) ? 1 : -1;
+  this->comparison_indices_[index] = this->comparison_conditions_.size();
+  this->comparison_conditions_.push_back(index);
+  this->comparison_variables_.push_back(variable_index);
+  this->comparison_signs_.push_back(sign);
+  this->comparison_thresholds_.push_back(sign * threshold);
+  this->comparison_inclusive_.push_back(
+      comparison == ComparisonOperator::LESS_EQUAL || comparison == ComparisonOperator::GREATER_EQUAL
+  );
+  this->margins_.push_back(0);
+  return index;
+}
+
+std::size_t PredicateEngine::add_combination(
+    const std::string& name, const std::vector<std::string>& conditions, bool all
+) {
+  if (conditions.empty()) {
+    throw exceptions::InvalidParameterException("Condition " + name + " requires at least one condition");
+  }
+  std::vector<std::size_t> operands;
+  for (const auto& condition : conditions) {
+    operands.push_back(this->get_index(condition));
+  }
+  std::size_t index = this->allocate_condition(name);
+  this->combination_conditions_.push_back(index);
+  this->combination_all_.push_back(all);
+  this->combination_operands_.insert(this->combination_operands_.end(), operands.begin(), operands.end());
+  this->combination_offsets_.push_back(this->combination_operands_.size());
+  return index;
+}
+
+std::size_t PredicateEngine::add_all_of(const std::string& name, const std::vector<std::string>& conditions) {
+  return this->add_combination(name, conditions, true);
+}
+
+std::size_t PredicateEngine::add_any_of(const std::string& name, const std::vector<std::string>& conditions) {
+  return this->add_combination(name, conditions, false);
+}
+
+void PredicateEngine::assert_condition_index(std::size_t index) const {
+  if (index >= this->names_.size()) {
+    throw exceptions::InvalidParameterException("Condition index " + std::to_string(index) + " is out of range");
+  }
+}
+
+void PredicateEngine::set_threshold(std::size_t index, double threshold) {
+  this->assert_condition_index(index);
+  std::size_t comparison = this->comparison_indices_[index];
+  if (comparison == NO_COMPARISON) {
+    throw exceptions::InvalidParameterException("Condition " + this->names_[index] + " is not a comparison");
+  }
+  this->comparison_thresholds_[comparison] = this->comparison_signs_[comparison] * threshold;
+}
+
+void PredicateEngine::add_callback(const std::string& condition, const EdgeCallback& callback, PredicateEdge edge) {
+  this->callbacks_[this->get_index(condition)].push_back({edge, callback});
+}
+
+void PredicateEngine::bind_predicate(const std::string& condition, const std::shared_ptr<Predicate>& predicate) {
+  if (predicate == nullptr) {
+    throw exceptions::InvalidParameterException("Cannot bind a null predicate to condition " + condition);
+  }
+  std::size_t index = this->get_index(condition);
+  predicate->set_value(this->values_[index]);
+  this->predicates_[index].push_back(predicate);
+}
+
+std::size_t PredicateEngine::evaluate() {
+  for (const auto& sampler : this->samplers_) {
+    this->variables_[sampler.first] = sampler.second();
+  }
+  this->previous_values_.swap(this->values_);
+  // the comparisons x < t, x <= t, x > t and x >= t are all evaluated as s * x - s * t > 0 (or >= 0)
+  const std::size_t nb_comparisons = this->comparison_conditions_.size();
+  for (std::size_t i = 0; i < nb_comparisons; ++i) {
+    this->margins_[i] = this->comparison_signs_[i] * this->variables_[this->comparison_variables_[i]]
+        - this->comparison_thresholds_[i];
+  }
+  for (std::size_t i = 0; i < nb_comparisons; ++i) {
+    this->values_[this->comparison_conditions_[i]] =
+        (this->margins_[i] > 0) | (this->comparison_inclusive_[i] & (this->margins_[i] == 0));
+  }
+  // combinations only refer to conditions added before them and are thus evaluated in order
+  for (std::size_t i = 0; i < this->combination_conditions_.size(); ++i) {
+    uint8_t all = this->combination_all_[i];
+    uint8_t value = all;
+    for (std::size_t j = this->combination_offsets_[i]; j < this->combination_offsets_[i + 1]; ++j) {
+      value = all ? (value & this->values_[this->combination_operands_[j]])
+                  : (value | this->values_[this->combination_operands_[j]]);
+    }
+    this->values_[this->combination_conditions_[i]] = value;
+  }
+  this->changed_.clear();
+  for (std::size_t i = 0; i < this->values_.size(); ++i) {
+    if (this->values_[i] != this->previous_values_[i]) {
+      this->changed_.push_back(i);
+    }
+  }
+  for (auto index : this->changed_) {
+    bool value = this->values_[index];
+    for (const auto& predicate : this->predicates_[index]) {
+      predicate->set_value(value);
+    }
+    for (const auto& entry : this->callbacks_[index]) {
+      if (entry.edge == PredicateEdge::ANY || (entry.edge == PredicateEdge::RISING) == value) {
+        entry.callback(index, value);
+      }
+    }
+  }
+  return this->changed_.size();
+}
+
+std::size_t PredicateEngine::get_size() const {
+  return this->names_.size();
+}
+
+std::size_t PredicateEngine::get_index(const std::string& name) const {
+  auto it = this->indices_.find(name);
+  if (it == this->indices_.end()) {
+    throw exceptions::InvalidParameterException("Condition " + name + " does not exist in the engine");
+  }
+  return it->second;
+}
+
+const std::string& PredicateEngine::get_name(std::size_t index) const {
+  this->assert_condition_index(index);
+  return this->names_[index];
+}
+
+bool PredicateEngine::get_value(std::size_t index) const {
+  this->assert_condition_index(index);
+  return this->values_[index];
+}
+
+bool PredicateEngine::get_value(const std::string& name) const {
+  return this->values_[this->get_index(name)];
+}
+
+bool PredicateEngine::is_rising(std::size_t index) const {
+  this->assert_condition_index(index);
+  return this->values_[index] && !this->previous_values_[index];
+}
+
+bool PredicateEngine::is_falling(std::size_t index) const {
+  this->assert_condition_index(index);
+  return !this->values_[index] && this->previous_values_[index];
+}
+
+const std::vector<std::size_t>& PredicateEngine::get_changed() const {
+  return this->changed_;
+}
+}// namespace state_representation
@@ -0,0 +1,164 @@
+#include "state_representation/robot/ChainJacobian.hpp"
+
+#include <algorithm>
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+static std::vector<std::string> chain_joint_names(const std::vector<std::string>& joint_names,
+                                                  const std::vector<unsigned int>& columns) {
+  std::vector<std::string> names;
+  names.reserve(columns.size());
+  for (auto column : columns) {
+    names.push_back(joint_names.at(column));
+  }
+  return names;
+}
+
+ChainJacobian::ChainJacobian() : joint_names_(joint_names::intern(0)) {}
+
+ChainJacobian::ChainJacobian(const std::string& robot_name,
+                             const SharedJointNames& joint_names,
+                             const std::vector<unsigned int>& columns,
+                             const std::string& frame,
+                             const std::string& reference_frame) :
+    joint_names_(joint_names::intern(joint_names)), columns_(columns) {
+  std::sort(this->columns_.begin(), this->columns_.end());
+  if (std::adjacent_find(this->columns_.begin(), this->columns_.end()) != this->columns_.end()) {
+    throw exceptions::InvalidParameterException("The columns of the chain contain duplicates");
+  }
+  if (!this->columns_.empty() && this->columns_.back() >= this->joint_names_->size()) {
+    throw exceptions::InvalidParameterException("Given column is out of range: number of joints is "
+                                                    + std::to_string(this->joint_names_->size()));
+  }
+  this->block_ = Jacobian(robot_name, chain_joint_names(*this->joint_names_, this->columns_), frame, reference_frame);
+}
+
+ChainJacobian::ChainJacobian(const Jacobian& jacobian, double tolerance) : joint_names_(jacobian.get_shared_joint_names()) {
+  if (jacobian.is_empty()) {
+    throw exceptions::EmptyStateException(jacobian.get_name() + " state is empty");
+  }
+  for (unsigned int i = 0; i < jacobian.cols(); ++i) {
+    if (jacobian.data().col(i).norm() > tolerance) {
+      this->columns_.push_back(i);
+    }
+  }
+  this->block_ = Jacobian(jacobian.get_name(),
+                          chain_joint_names(*this->joint_names_, this->columns_),
+                          jacobian.get_frame(),
+                          jacobian.get_reference_frame());
+  this->set_data(jacobian.data());
+}
+
+void ChainJacobian::set_block_data(const Eigen::MatrixXd& data) {
+  this->block_.set_data(data);
+}
+
+void ChainJacobian::set_data(const Eigen::MatrixXd& data) {
+  if (data.rows() != this->rows() || data.cols() != this->cols()) {
+    throw exceptions::IncompatibleSizeException("Input matrix is of incorrect size, expected "
+                                                    + std::to_string(this->rows()) + "x" + std::to_string(this->cols())
+                                                    + " got " + std::to_string(data.rows()) + "x"
+                                                    + std::to_string(data.cols()));
+  }
+  // the columns are gathered in place in the block, which keeps its size
+  for (std::size_t i = 0; i < this->columns_.size(); ++i) {
+    this->block_.data_.col(i) = data.col(this->columns_[i]);
+  }
+  this->block_.set_filled();
+}
+
+Eigen::VectorXd ChainJacobian::scatter(const Eigen::VectorXd& vector) const {
+  Eigen::VectorXd result = Eigen::VectorXd::Zero(this->cols());
+  for (std::size_t i = 0; i < this->columns_.size(); ++i) {
+    result(this->columns_[i]) = vector(i);
+  }
+  return result;
+}
+
+Jacobian ChainJacobian::to_jacobian() const {
+  Eigen::MatrixXd data = Eigen::MatrixXd::Zero(this->rows(), this->cols());
+  for (std::size_t i = 0; i < this->columns_.size(); ++i) {
+    data.col(this->columns_[i]) = this->block_.data().col(i);
+  }
+  Jacobian result(this->get_name(), this->joint_names_, this->get_frame(), data, this->get_reference_frame());
+  if (this->is_empty()) {
+    result.initialize();
+  }
+  return result;
+}
+
+Eigen::MatrixXd ChainJacobian::operator*(const Eigen::MatrixXd& matrix) const {
+  if (this->is_empty()) {
+    throw exceptions::EmptyStateException(this->get_name() + " state is empty");
+  }
+  if (matrix.rows() != this->cols()) {
+    throw exceptions::IncompatibleSizeException("Input matrix is of incorrect size, expected "
+                                                    + std::to_string(this->cols()) + " rows, got "
+                                                    + std::to_string(matrix.rows()));
+  }
+  Eigen::MatrixXd result = Eigen::MatrixXd::Zero(this->rows(), matrix.cols());
+  for (std::size_t i = 0; i < this->columns_.size(); ++i) {
+    result.noalias() += this->block_.data().col(i) * matrix.row(this->columns_[i]);
+  }
+  return result;
+}
+
+CartesianTwist ChainJacobian::operator*(const JointVelocities& dq) const {
+  if (this->is_empty()) {
+    throw exceptions::EmptyStateException(this->get_name() + " state is empty");
+  }
+  if (dq.is_empty()) {
+    throw exceptions::EmptyStateException(dq.get_name() + " state is empty");
+  }
+  if (this->get_name() != dq.get_name() || this->joint_names_ != dq.get_shared_names()) {
+    throw exceptions::IncompatibleStatesException("The Jacobian and the input JointVelocities are incompatible");
+  }
+  // data() is virtual and returns a copy, the velocities are read once by reference
+  const Eigen::VectorXd& velocities = dq.get_velocities();
+  Eigen::Matrix<double, 6, 1> twist = Eigen::Matrix<double, 6, 1>::Zero();
+  for (std::size_t i = 0; i < this->columns_.size(); ++i) {
+    twist.noalias() += this->block_.data().col(i) * velocities(this->columns_[i]);
+  }
+  return CartesianTwist(this->get_frame(), twist, this->get_reference_frame());
+}
+
+JointTorques ChainJacobian::transpose_multiply(const CartesianWrench& wrench) const {
+  if (this->is_empty()) {
+    throw exceptions::EmptyStateException(this->get_name() + " state is empty");
+  }
+  if (wrench.is_empty()) {
+    throw exceptions::EmptyStateException(wrench.get_name() + " state is empty");
+  }
+  if (!this->block_.is_compatible(wrench)) {
+    throw exceptions::IncompatibleStatesException("The Jacobian and the input CartesianWrench are incompatible");
+  }
+  Eigen::VectorXd joint_torques = this->block_.data().transpose() * wrench.data();
+  return JointTorques(this->get_name(), this->joint_names_, this->scatter(joint_torques));
+}
+
+JointVelocities ChainJacobian::solve(const CartesianTwist& twist) const {
+  if (this->is_empty()) {
+    throw exceptions::EmptyStateException(this->get_name() + " state is empty");
+  }
+  if (twist.is_empty()) {
+    throw exceptions::EmptyStateException(twist.get_name() + " state is empty");
+  }
+  if (!this->block_.is_compatible(twist)) {
+    throw exceptions::IncompatibleStatesException("The Jacobian and the input CartesianTwist are incompatible");
+  }
+  Eigen::VectorXd joint_velocities = this->block_.solve(twist.data());
+  return JointVelocities(this->get_name(), this->joint_names_, this->scatter(joint_velocities));
+}
+
+std::ostream& operator<<(std::ostream& os, const ChainJacobian& jacobian) {
+  os << "chain of " << jacobian.columns_.size() << " out of " << jacobian.cols() << " joints, columns: [";
+  for (auto& c : jacobian.columns_) { os << c << ", "; }
+  os << "]" << std::endl;
+  os << jacobian.block_;
+  return os;
+}
+}// namespace state_representation
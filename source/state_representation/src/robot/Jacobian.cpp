@@ -4,7 +4,7 @@
 #include "state_representation/exceptions/IncompatibleStatesException.hpp"
 
 namespace state_representation {
-Jacobian::Jacobian() : State(StateType::JACOBIANMATRIX) {
+Jacobian::Jacobian() : State(StateType::JACOBIANMATRIX), joint_names_(joint_names::intern(0)), rows_(0), cols_(0) {
   this->State::initialize();
 }
 
@@ -13,12 +13,11 @@ Jacobian::Jacobian(const std::string& robot_name,
                    const std::string& frame,
                    const std::string& reference_frame) :
     State(StateType::JACOBIANMATRIX, robot_name),
-    joint_names_(nb_joints),
+    joint_names_(joint_names::intern(nb_joints)),
     frame_(frame),
     reference_frame_(reference_frame),
     rows_(6),
     cols_(nb_joints) {
-  this->set_joint_names(nb_joints);
   this->initialize();
 }
 
@@ -27,7 +26,7 @@ Jacobian::Jacobian(const std::string& robot_name,
                    const std::string& frame,
                    const std::string& reference_frame) :
     State(StateType::JACOBIANMATRIX, robot_name),
-    joint_names_(joint_names),
+    joint_names_(joint_names::intern(joint_names)),
     frame_(frame),
     reference_frame_(reference_frame),
     rows_(6),
@@ -52,6 +51,21 @@ Jacobian::Jacobian(const std::string& robot_name,
   this->set_data(data);
 }
 
+Jacobian::Jacobian(const std::string& robot_name,
+                   const SharedJointNames& joint_names,
+                   const std::string& frame,
+                   const Eigen::MatrixXd& data,
+                   const std::string& reference_frame) :
+    State(StateType::JACOBIANMATRIX, robot_name),
+    joint_names_(joint_names::intern(joint_names)),
+    frame_(frame),
+    reference_frame_(reference_frame),
+    rows_(6),
+    cols_(joint_names_->size()) {
+  this->initialize();
+  this->set_data(data);
+}
+
 Jacobian::Jacobian(const Jacobian& jacobian) :
     State(jacobian),
     joint_names_(jacobian.joint_names_),
@@ -89,27 +103,23 @@ bool Jacobian::is_compatible(const State& state) const {
   bool compatible = false;
   switch (state.get_type()) {
     case StateType::JACOBIANMATRIX:
-      // compatibility is assured through the vector of joint names
+      // compatibility is assured through the shared table of joint names
       compatible = (this->get_name() == state.get_name())
-          && (this->cols_ == dynamic_cast<const Jacobian&>(state).get_joint_names().size());
+          && (this->joint_names_ == dynamic_cast<const Jacobian&>(state).joint_names_);
       if (compatible) {
-        for (unsigned int i = 0; i < this->cols_; ++i) {
-          compatible = (compatible && this->joint_names_[i] == dynamic_cast<const Jacobian&>(state).get_joint_names()[i]);
-        }
         // compatibility is assured through the reference frame and the name of the frame
         compatible = (compatible && ((this->reference_frame_ == dynamic_cast<const Jacobian&>(state).get_reference_frame())
             && (this->frame_ == dynamic_cast<const Jacobian&>(state).get_frame())));
       }
       break;
     case StateType::JOINTSTATE:
-      // compatibility is assured through the vector of joint names
+      // compatibility is assured through the shared table of joint names
       compatible = (this->get_name() == state.get_name())
-          && (this->cols_ == dynamic_cast<const JointState&>(state).get_size());
-      if (compatible) {
-        for (unsigned int i = 0; i < this->cols_; ++i) {
-          compatible = (compatible && this->joint_names_[i] == dynamic_cast<const JointState&>(state).get_names()[i]);
-        }
-      }
+          && (this->joint_names_ == dynamic_cast<const JointState&>(state).get_shared_names());
+      break;
+    case StateType::FIXEDJOINTSTATE:
+      // the size of a FixedJointState is a template parameter, such that it checks the compatibility itself
+      compatible = state.is_compatible(*this);
       break;
     case StateType::CARTESIANSTATE:
       // compatibility is assured through the reference frame and the name of the frame
@@ -200,7 +210,7 @@ JointVelocities Jacobian::operator*(const CartesianTwist& twist) const {
     throw IncompatibleStatesException("The Jacobian and the input CartesianTwist are incompatible");
   }
   Eigen::VectorXd joint_velocities = (*this) * twist.data();
-  JointVelocities result(this->get_name(), this->get_joint_names(), joint_velocities);
+  JointVelocities result(this->get_name(), this->joint_names_, joint_velocities);
   return result;
 }
 
@@ -215,7 +225,7 @@ JointTorques Jacobian::operator*(const CartesianWrench& wrench) const {
     throw IncompatibleStatesException("The Jacobian and the input CartesianWrench are incompatible");
   }
   Eigen::VectorXd joint_torques = (*this) * wrench.data();
-  JointTorques result(this->get_name(), this->get_joint_names(), joint_torques);
+  JointTorques result(this->get_name(), this->joint_names_, joint_torques);
   return result;
 }
 
@@ -243,7 +253,7 @@ JointVelocities Jacobian::solve(const CartesianTwist& twist) const {
   // this uses the solve operation instead of using the inverse or pseudo-inverse of the Jacobian
   Eigen::VectorXd joint_velocities = this->solve(twist.data());
   // return a JointVelocities state
-  JointVelocities result(this->get_name(), this->get_joint_names(), joint_velocities);
+  JointVelocities result(this->get_name(), this->joint_names_, joint_velocities);
   return result;
 }
 
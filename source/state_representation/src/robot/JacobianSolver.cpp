@@ -0,0 +1,243 @@
+#include "state_representation/robot/JacobianSolver.hpp"
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+JacobianSolver::JacobianSolver(JacobianSolverMethod method, double damping) :
+    method_(method), damping_(damping), computed_(false), pseudoinverse_computed_(false) {
+  if (damping < 0) {
+    throw exceptions::InvalidParameterException("The damping factor has to be positive");
+  }
+}
+
+JacobianSolver::JacobianSolver(const Jacobian& jacobian, JacobianSolverMethod method, double damping) :
+    JacobianSolver(method, damping) {
+  this->compute(jacobian);
+}
+
+void JacobianSolver::set_damping(double damping) {
+  if (damping < 0) {
+    throw exceptions::InvalidParameterException("The damping factor has to be positive");
+  }
+  this->damping_ = damping;
+  if (this->computed_) {
+    this->compute(this->jacobian_);
+  }
+}
+
+void JacobianSolver::assert_computed() const {
+  if (!this->computed_) {
+    throw exceptions::EmptyStateException("No Jacobian has been factorized by the solver");
+  }
+}
+
+JacobianSolver& JacobianSolver::compute(const Jacobian& jacobian) {
+  if (jacobian.is_empty()) {
+    throw exceptions::EmptyStateException(jacobian.get_name() + " state is empty");
+  }
+  // the copy assignment would reallocate the matrix, only the data is copied when the layout is unchanged
+  if (&jacobian != &this->jacobian_) {
+    if (this->jacobian_.rows() == jacobian.rows() && this->jacobian_.cols() == jacobian.cols()) {
+      this->jacobian_.State::operator=(jacobian);
+      this->jacobian_.joint_names_ = jacobian.joint_names_;
+      this->jacobian_.frame_ = jacobian.frame_;
+      this->jacobian_.reference_frame_ = jacobian.reference_frame_;
+      this->jacobian_.data_ = jacobian.data_;
+    } else {
+      this->jacobian_ = jacobian;
+    }
+  }
+  const Eigen::MatrixXd& data = this->jacobian_.data();
+  switch (this->method_) {
+    case JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION:
+      this->cod_.compute(data);
+      break;
+    case JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION:
+      this->svd_.compute(data, Eigen::ComputeThinU | Eigen::ComputeThinV);
+      break;
+    case JacobianSolverMethod::DAMPED_LEAST_SQUARES: {
+      // factorize the smallest of the two normal matrices J*J^T + l^2*I or J^T*J + l^2*I
+      double damping2 = this->damping_ * this->damping_;
+      if (data.rows() <= data.cols()) {
+        this->normal_matrix_.noalias() = data * data.transpose();
+      } else {
+        this->normal_matrix_.noalias() = data.transpose() * data;
+      }
+      this->normal_matrix_.diagonal().array() += damping2;
+      this->ldlt_.compute(this->normal_matrix_);
+      break;
+    }
+  }
+  this->computed_ = true;
+  this->pseudoinverse_computed_ = false;
+  return *this;
+}
+
+unsigned int JacobianSolver::rank() const {
+  this->assert_computed();
+  switch (this->method_) {
+    case JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION:
+      return this->cod_.rank();
+    case JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION:
+      return this->svd_.rank();
+    default:
+      return this->normal_matrix_.rows();
+  }
+}
+
+void JacobianSolver::solve(const Eigen::VectorXd& vector, Eigen::VectorXd& result) const {
+  this->assert_computed();
+  const Eigen::MatrixXd& data = this->jacobian_.data();
+  if (vector.size() != data.rows()) {
+    throw exceptions::IncompatibleSizeException("Input vector is of incorrect size, expected "
+                                                    + std::to_string(data.rows()) + " rows, got "
+                                                    + std::to_string(vector.size()));
+  }
+  result.resize(data.cols());
+  switch (this->method_) {
+    case JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION:
+      result = this->cod_.solve(vector);
+      break;
+    case JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION:
+      if (this->damping_ > 0) {
+        result.noalias() = this->pseudoinverse_matrix() * vector;
+      } else {
+        result = this->svd_.solve(vector);
+      }
+      break;
+    case JacobianSolverMethod::DAMPED_LEAST_SQUARES:
+      if (data.rows() <= data.cols()) {
+        result.noalias() = data.transpose() * this->ldlt_.solve(vector);
+      } else {
+        result = this->ldlt_.solve(data.transpose() * vector);
+      }
+      break;
+  }
+}
+
+Eigen::MatrixXd JacobianSolver::solve(const Eigen::MatrixXd& matrix) const {
+  this->assert_computed();
+  const Eigen::MatrixXd& data = this->jacobian_.data();
+  if (matrix.rows() != data.rows()) {
+    throw exceptions::IncompatibleSizeException("Input matrix is of incorrect size, expected "
+                                                    + std::to_string(data.rows()) + " rows, got "
+                                                    + std::to_string(matrix.rows()));
+  }
+  switch (this->method_) {
+    case JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION:
+      return this->cod_.solve(matrix);
+    case JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION:
+      if (this->damping_ > 0) {
+        return this->pseudoinverse_matrix() * matrix;
+      }
+      return this->svd_.solve(matrix);
+    default:
+      if (data.rows() <= data.cols()) {
+        return data.transpose() * this->ldlt_.solve(matrix);
+      }
+      return this->ldlt_.solve(data.transpose() * matrix);
+  }
+}
+
+JointVelocities JacobianSolver::solve(const CartesianTwist& twist) const {
+  this->assert_computed();
+  if (twist.is_empty()) {
+    throw exceptions::EmptyStateException(twist.get_name() + " state is empty");
+  }
+  if (!this->jacobian_.is_compatible(twist)) {
+    throw exceptions::IncompatibleStatesException("The Jacobian and the input CartesianTwist are incompatible");
+  }
+  Eigen::VectorXd joint_velocities;
+  this->solve(twist.data(), joint_velocities);
+  return JointVelocities(this->jacobian_.get_name(), this->jacobian_.get_shared_joint_names(), joint_velocities);
+}
+
+void JacobianSolver::compute_pseudoinverse() const {
+  if (this->pseudoinverse_computed_) {
+    return;
+  }
+  const Eigen::MatrixXd& data = this->jacobian_.data();
+  switch (this->method_) {
+    case JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION:
+      this->pseudoinverse_ = this->cod_.pseudoInverse();
+      break;
+    case JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION: {
+      // filter the singular values with s / (s^2 + l^2), which reduces to 1 / s without damping
+      const Eigen::VectorXd& singular_values = this->svd_.singularValues();
+      double damping2 = this->damping_ * this->damping_;
+      double threshold = this->svd_.threshold() * (singular_values.size() ? singular_values(0) : 0.);
+      Eigen::VectorXd inverse_values(singular_values.size());
+      for (Eigen::Index i = 0; i < singular_values.size(); ++i) {
+        double s = singular_values(i);
+        inverse_values(i) = (damping2 > 0 || s > threshold) ? s / (s * s + damping2) : 0.;
+      }
+      this->pseudoinverse_.noalias() =
+          this->svd_.matrixV() * inverse_values.asDiagonal() * this->svd_.matrixU().transpose();
+      break;
+    }
+    case JacobianSolverMethod::DAMPED_LEAST_SQUARES:
+      if (data.rows() <= data.cols()) {
+        this->pseudoinverse_.noalias() =
+            data.transpose() * this->ldlt_.solve(Eigen::MatrixXd::Identity(data.rows(), data.rows()));
+      } else {
+        this->pseudoinverse_ = this->ldlt_.solve(data.transpose());
+      }
+      break;
+  }
+  this->pseudoinverse_computed_ = true;
+}
+
+const Eigen::MatrixXd& JacobianSolver::pseudoinverse_matrix() const {
+  this->assert_computed();
+  this->compute_pseudoinverse();
+  return this->pseudoinverse_;
+}
+
+Jacobian JacobianSolver::pseudoinverse() const {
+  const Eigen::MatrixXd& pinv = this->pseudoinverse_matrix();
+  Jacobian result(this->jacobian_);
+  result.rows_ = pinv.rows();
+  result.cols_ = pinv.cols();
+  result.set_data(pinv);
+  return result;
+}
+
+Eigen::MatrixXd JacobianSolver::null_space_projector() const {
+  const Eigen::MatrixXd& pinv = this->pseudoinverse_matrix();
+  const Eigen::MatrixXd& data = this->jacobian_.data();
+  Eigen::MatrixXd projector = -pinv * data;
+  projector.diagonal().array() += 1.;
+  return projector;
+}
+
+JointVelocities JacobianSolver::project_on_null_space(const JointVelocities& velocities) const {
+  this->assert_computed();
+  if (velocities.is_empty()) {
+    throw exceptions::EmptyStateException(velocities.get_name() + " state is empty");
+  }
+  if (!this->jacobian_.is_compatible(velocities)) {
+    throw exceptions::IncompatibleStatesException("The Jacobian and the input JointVelocities are incompatible");
+  }
+  // (I - J^+ J) dq computed as dq - J^+ (J dq) to avoid forming the projector
+  const Eigen::MatrixXd& pinv = this->pseudoinverse_matrix();
+  Eigen::VectorXd task_velocities = this->jacobian_.data() * velocities.data();
+  JointVelocities result(velocities);
+  result.set_velocities(velocities.data() - pinv * task_velocities);
+  return result;
+}
+
+JointTorques JacobianSolver::transpose_multiply(const CartesianWrench& wrench) const {
+  this->assert_computed();
+  if (wrench.is_empty()) {
+    throw exceptions::EmptyStateException(wrench.get_name() + " state is empty");
+  }
+  if (!this->jacobian_.is_compatible(wrench)) {
+    throw exceptions::IncompatibleStatesException("The Jacobian and the input CartesianWrench are incompatible");
+  }
+  Eigen::VectorXd joint_torques = this->jacobian_.data().transpose() * wrench.data();
+  return JointTorques(this->jacobian_.get_name(), this->jacobian_.get_shared_joint_names(), joint_torques);
+}
+}// namespace state_representation
@@ -0,0 +1,21 @@
+#include "state_representation/robot/JacobianView.hpp"
+
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+
+namespace state_representation {
+JacobianView::JacobianView(const double* data, unsigned int nb_joints) : JacobianView(data, 6, nb_joints) {}
+
+JacobianView::JacobianView(const double* data, unsigned int rows, unsigned int cols) : data_(data, rows, cols) {}
+
+void JacobianView::copy_to(Jacobian& jacobian) const {
+  if (jacobian.rows() != this->rows() || jacobian.cols() != this->cols()) {
+    throw exceptions::IncompatibleSizeException(
+        "The view is of incorrect size: expected " + std::to_string(jacobian.rows()) + "x"
+            + std::to_string(jacobian.cols()) + ", given " + std::to_string(this->rows()) + "x"
+            + std::to_string(this->cols()));
+  }
+  jacobian.set_filled();
+  // assign directly into the storage of the Jacobian as set_data would create a temporary matrix
+  jacobian.data_ = this->data_;
+}
+}// namespace state_representation
@@ -0,0 +1,59 @@
+#include "state_representation/robot/JointNames.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+#include <map>
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+
+namespace state_representation::joint_names {
+namespace {
+std::mutex registry_mutex;
+std::map<std::vector<std::string>, std::weak_ptr<const std::vector<std::string>>> registry;
+std::size_t registry_sweep_size = 64;
+
+const SharedJointNames& empty_table() {
+  static const SharedJointNames empty = std::make_shared<const std::vector<std::string>>();
+  return empty;
+}
+}// namespace
+
+SharedJointNames intern(const std::vector<std::string>& names) {
+  // the empty table is requested by every default constructed state, avoid the lock for it
+  if (names.empty()) {
+    return empty_table();
+  }
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto it = registry.find(names);
+  if (it != registry.end()) {
+    if (auto table = it->second.lock()) {
+      return table;
+    }
+  }
+  // drop the tables that are not used anymore before the registry grows too much
+  if (registry.size() >= registry_sweep_size) {
+    for (auto entry = registry.begin(); entry != registry.end();) {
+      entry = entry->second.expired() ? registry.erase(entry) : std::next(entry);
+    }
+    registry_sweep_size = std::max<std::size_t>(64, 2 * registry.size());
+  }
+  auto table = std::make_shared<const std::vector<std::string>>(names);
+  registry[names] = table;
+  return table;
+}
+
+SharedJointNames intern(const SharedJointNames& names) {
+  if (names == nullptr) {
+    throw exceptions::InvalidParameterException("The table of joint names is not set");
+  }
+  return intern(*names);
+}
+
+SharedJointNames intern(unsigned int nb_joints) {
+  std::vector<std::string> names(nb_joints);
+  for (unsigned int i = 0; i < nb_joints; ++i) {
+    names[i] = "joint" + std::to_string(i);
+  }
+  return intern(names);
+}
+}// namespace state_representation::joint_names
@@ -21,6 +21,11 @@ JointPositions::JointPositions(const std::string& robot_name, const std::vector<
   this->set_positions(positions);
 }
 
+JointPositions::JointPositions(const std::string& robot_name, const SharedJointNames& joint_names,
+                               const Eigen::VectorXd& positions) : JointState(robot_name, joint_names) {
+  this->set_positions(positions);
+}
+
 JointPositions::JointPositions(const JointState& state) : JointState(state) {
   // set all the state variables to 0 except positions
   this->set_zero();
@@ -28,6 +33,13 @@ JointPositions::JointPositions(const JointState& state) : JointState(state) {
   this->set_empty(state.is_empty());
 }
 
+JointPositions::JointPositions(JointState&& state) : JointState(std::move(state)) {
+  // set all the state variables to 0 except positions
+  this->set_zero(JointStateVariable::VELOCITIES);
+  this->set_zero(JointStateVariable::ACCELERATIONS);
+  this->set_zero(JointStateVariable::TORQUES);
+}
+
 JointPositions::JointPositions(const JointPositions& positions) : JointPositions(static_cast<const JointState&>(positions)) {}
 
 JointPositions::JointPositions(const JointVelocities& velocities) : JointPositions(std::chrono::seconds(1) * velocities) {}
@@ -53,28 +65,43 @@ JointPositions& JointPositions::operator+=(const JointPositions& positions) {
   return (*this);
 }
 
-JointPositions JointPositions::operator+(const JointPositions& positions) const {
+JointPositions JointPositions::operator+(const JointPositions& positions) const& {
   return this->JointState::operator+(positions);
 }
 
+JointPositions JointPositions::operator+(const JointPositions& positions)&& {
+  (*this) += positions;
+  return std::move(*this);
+}
+
 JointPositions& JointPositions::operator-=(const JointPositions& positions) {
   this->JointState::operator-=(positions);
   return (*this);
 }
 
-JointPositions JointPositions::operator-(const JointPositions& positions) const {
+JointPositions JointPositions::operator-(const JointPositions& positions) const& {
   return this->JointState::operator-(positions);
 }
 
+JointPositions JointPositions::operator-(const JointPositions& positions)&& {
+  (*this) -= positions;
+  return std::move(*this);
+}
+
 JointPositions& JointPositions::operator*=(double lambda) {
   this->JointState::operator*=(lambda);
   return (*this);
 }
 
-JointPositions JointPositions::operator*(double lambda) const {
+JointPositions JointPositions::operator*(double lambda) const& {
   return this->JointState::operator*(lambda);
 }
 
+JointPositions JointPositions::operator*(double lambda)&& {
+  (*this) *= lambda;
+  return std::move(*this);
+}
+
 JointPositions& JointPositions::operator*=(const Eigen::ArrayXd& lambda) {
   this->multiply_state_variable(lambda, JointStateVariable::POSITIONS);
   return (*this);
@@ -102,12 +129,17 @@ JointPositions& JointPositions::operator/=(double lambda) {
   return (*this);
 }
 
-JointPositions JointPositions::operator/(double lambda) const {
+JointPositions JointPositions::operator/(double lambda) const& {
   return this->JointState::operator/(lambda);
 }
 
+JointPositions JointPositions::operator/(double lambda)&& {
+  (*this) /= lambda;
+  return std::move(*this);
+}
+
 JointVelocities JointPositions::operator/(const std::chrono::nanoseconds& dt) const {
-  if (this->is_empty()) { throw EmptyStateException(this->get_name() + " state is empty"); }
+  if (CHECKED_OPERATIONS && this->is_empty()) { throw EmptyStateException(this->get_name() + " state is empty"); }
   // operations
   JointVelocities velocities(this->get_name(), this->get_names());
   // convert the period to a double with the second as reference
@@ -148,6 +180,11 @@ JointPositions operator*(double lambda, const JointPositions& positions) {
   return result;
 }
 
+JointPositions operator*(double lambda, JointPositions&& positions) {
+  positions *= lambda;
+  return std::move(positions);
+}
+
 JointPositions operator*(const Eigen::ArrayXd& lambda, const JointPositions& positions) {
   JointPositions result(positions);
   result *= lambda;
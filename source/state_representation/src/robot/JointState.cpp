@@ -5,25 +5,29 @@
 #include "state_representation/exceptions/NotImplementedException.hpp"
 
 namespace state_representation {
-JointState::JointState() : State(StateType::JOINTSTATE) {
+JointState::JointState() : State(StateType::JOINTSTATE), names_(joint_names::intern(0)) {
   this->initialize();
 }
 
 JointState::JointState(const std::string& robot_name, unsigned int nb_joints) :
-    State(StateType::JOINTSTATE, robot_name), names_(nb_joints) {
-  this->set_names(nb_joints);
+    State(StateType::JOINTSTATE, robot_name), names_(joint_names::intern(nb_joints)) {
   this->initialize();
 }
 
 JointState::JointState(const std::string& robot_name, const std::vector<std::string>& joint_names) :
-    State(StateType::JOINTSTATE, robot_name), names_(joint_names) {
+    State(StateType::JOINTSTATE, robot_name), names_(joint_names::intern(joint_names)) {
+  this->initialize();
+}
+
+JointState::JointState(const std::string& robot_name, const SharedJointNames& joint_names) :
+    State(StateType::JOINTSTATE, robot_name), names_(joint_names::intern(joint_names)) {
   this->initialize();
 }
 
 void JointState::initialize() {
   this->State::initialize();
   // resize
-  unsigned int size = this->names_.size();
+  unsigned int size = this->get_size();
   this->positions_.resize(size);
   this->velocities_.resize(size);
   this->accelerations_.resize(size);
@@ -39,6 +43,30 @@ void JointState::set_zero() {
   this->torques_.setZero();
 }
 
+void JointState::set_zero(const JointStateVariable& state_variable_type) {
+  switch (state_variable_type) {
+    case JointStateVariable::POSITIONS:
+      this->positions_.setZero();
+      break;
+
+    case JointStateVariable::VELOCITIES:
+      this->velocities_.setZero();
+      break;
+
+    case JointStateVariable::ACCELERATIONS:
+      this->accelerations_.setZero();
+      break;
+
+    case JointStateVariable::TORQUES:
+      this->torques_.setZero();
+      break;
+
+    case JointStateVariable::ALL:
+      this->set_zero();
+      break;
+  }
+}
+
 JointState JointState::Zero(const std::string& robot_name, unsigned int nb_joints) {
   JointState zero = JointState(robot_name, nb_joints);
   // as opposed to the constructor specify this state to be filled
@@ -70,38 +98,61 @@ JointState JointState::Random(const std::string& robot_name, const std::vector<s
 }
 
 JointState& JointState::operator+=(const JointState& state) {
-  if (!this->is_compatible(state)) {
+  if (CHECKED_OPERATIONS && !this->is_compatible(state)) {
     throw IncompatibleStatesException(
         "The two joint states are incompatible, check name, joint names and order or size");
   }
-  this->set_all_state_variables(this->get_all_state_variables() + state.get_all_state_variables());
+  // operate on each state variable in place to avoid building the concatenated vectors
+  this->set_filled();
+  this->positions_ += state.positions_;
+  this->velocities_ += state.velocities_;
+  this->accelerations_ += state.accelerations_;
+  this->torques_ += state.torques_;
   return (*this);
 }
 
-JointState JointState::operator+(const JointState& state) const {
+JointState JointState::operator+(const JointState& state) const& {
   JointState result(*this);
   result += state;
   return result;
 }
 
+JointState JointState::operator+(const JointState& state)&& {
+  (*this) += state;
+  return std::move(*this);
+}
+
 JointState& JointState::operator-=(const JointState& state) {
-  if (!this->is_compatible(state)) {
+  if (CHECKED_OPERATIONS && !this->is_compatible(state)) {
     throw IncompatibleStatesException(
         "The two joint states are incompatible, check name, joint names and order or size");
   }
-  this->set_all_state_variables(this->get_all_state_variables() - state.get_all_state_variables());
+  this->set_filled();
+  this->positions_ -= state.positions_;
+  this->velocities_ -= state.velocities_;
+  this->accelerations_ -= state.accelerations_;
+  this->torques_ -= state.torques_;
   return (*this);
 }
 
-JointState JointState::operator-(const JointState& state) const {
+JointState JointState::operator-(const JointState& state) const& {
   JointState result(*this);
   result -= state;
   return result;
 }
 
+JointState JointState::operator-(const JointState& state)&& {
+  (*this) -= state;
+  return std::move(*this);
+}
+
 JointState& JointState::operator*=(double lambda) {
-  if (this->is_empty()) { throw EmptyStateException(this->get_name() + " state is empty"); }
-  this->set_all_state_variables(lambda * this->get_all_state_variables());
+  if (CHECKED_OPERATIONS && this->is_empty()) { throw EmptyStateException(this->get_name() + " state is empty"); }
+  this->set_filled();
+  this->positions_ *= lambda;
+  this->velocities_ *= lambda;
+  this->accelerations_ *= lambda;
+  this->torques_ *= lambda;
   return (*this);
 }
 
@@ -137,12 +188,17 @@ JointState& JointState::operator*=(const Eigen::MatrixXd& lambda) {
   return (*this);
 }
 
-JointState JointState::operator*(double lambda) const {
+JointState JointState::operator*(double lambda) const& {
   JointState result(*this);
   result *= lambda;
   return result;
 }
 
+JointState JointState::operator*(double lambda)&& {
+  (*this) *= lambda;
+  return std::move(*this);
+}
+
 JointState JointState::operator*(const Eigen::MatrixXd& lambda) const {
   JointState result(*this);
   result *= lambda;
@@ -159,12 +215,17 @@ JointState& JointState::operator/=(double lambda) {
   return JointState::operator*=(1 / lambda);
 }
 
-JointState JointState::operator/(double lambda) const {
+JointState JointState::operator/(double lambda) const& {
   JointState result(*this);
   result /= lambda;
   return result;
 }
 
+JointState JointState::operator/(double lambda)&& {
+  (*this) /= lambda;
+  return std::move(*this);
+}
+
 JointState JointState::copy() const {
   JointState result(*this);
   return result;
@@ -220,9 +281,9 @@ void JointState::clamp_state_variable(double max_absolute_value, const JointStat
 
 double JointState::dist(const JointState& state, const JointStateVariable& state_variable_type) const {
   // sanity check
-  if (this->is_empty()) { throw EmptyStateException(this->get_name() + " state is empty"); }
-  if (state.is_empty()) { throw EmptyStateException(state.get_name() + " state is empty"); }
-  if (!this->is_compatible(state)) {
+  if (CHECKED_OPERATIONS && this->is_empty()) { throw EmptyStateException(this->get_name() + " state is empty"); }
+  if (CHECKED_OPERATIONS && state.is_empty()) { throw EmptyStateException(state.get_name() + " state is empty"); }
+  if (CHECKED_OPERATIONS && !this->is_compatible(state)) {
     throw IncompatibleStatesException(
         "The two joint states are incompatible, check name, joint names and order or size");
   }
@@ -249,7 +310,7 @@ std::ostream& operator<<(std::ostream& os, const JointState& state) {
   } else {
     os << state.get_name() << " JointState" << std::endl;
     os << "names: [";
-    for (auto& n : state.names_) { os << n << ", "; }
+    for (auto& n : state.get_names()) { os << n << ", "; }
     os << "]" << std::endl;
     os << "positions: [";
     for (unsigned int i = 0; i < state.positions_.size(); ++i) { os << state.positions_(i) << ", "; }
@@ -272,12 +333,17 @@ double dist(const JointState& s1, const JointState& s2, const JointStateVariable
 }
 
 JointState operator*(double lambda, const JointState& state) {
-  if (state.is_empty()) { throw EmptyStateException(state.get_name() + " state is empty"); }
+  if (CHECKED_OPERATIONS && state.is_empty()) { throw EmptyStateException(state.get_name() + " state is empty"); }
   JointState result(state);
   result *= lambda;
   return result;
 }
 
+JointState operator*(double lambda, JointState&& state) {
+  state *= lambda;
+  return std::move(state);
+}
+
 JointState operator*(const Eigen::MatrixXd& lambda, const JointState& state) {
   JointState result(state);
   result *= lambda;
@@ -0,0 +1,37 @@
+#include "state_representation/robot/JointStateView.hpp"
+
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+
+namespace state_representation {
+JointStateView::JointStateView(const double* data, unsigned int nb_joints) :
+    size_(nb_joints),
+    positions_(data, nb_joints),
+    velocities_(data + nb_joints, nb_joints),
+    accelerations_(data + 2 * nb_joints, nb_joints),
+    torques_(data + 3 * nb_joints, nb_joints) {}
+
+JointStateView::JointStateView(unsigned int nb_joints,
+                               const double* positions,
+                               const double* velocities,
+                               const double* accelerations,
+                               const double* torques) :
+    size_(nb_joints),
+    positions_(positions, positions ? nb_joints : 0),
+    velocities_(velocities, velocities ? nb_joints : 0),
+    accelerations_(accelerations, accelerations ? nb_joints : 0),
+    torques_(torques, torques ? nb_joints : 0) {}
+
+void JointStateView::copy_to(JointState& state) const {
+  if (state.get_size() != this->size_) {
+    throw exceptions::IncompatibleSizeException(
+        "The view is of incorrect size: expected " + std::to_string(state.get_size()) + ", given "
+            + std::to_string(this->size_));
+  }
+  state.set_filled();
+  // assign directly into the storage of the state as the setters would create a temporary vector
+  if (this->positions_.size() != 0) { state.positions_ = this->positions_; }
+  if (this->velocities_.size() != 0) { state.velocities_ = this->velocities_; }
+  if (this->accelerations_.size() != 0) { state.accelerations_ = this->accelerations_; }
+  if (this->torques_.size() != 0) { state.torques_ = this->torques_; }
+}
+}// namespace state_representation
@@ -20,6 +20,11 @@ JointTorques::JointTorques(const std::string& robot_name, const std::vector<std:
   this->set_torques(torques);
 }
 
+JointTorques::JointTorques(const std::string& robot_name, const SharedJointNames& joint_names,
+                           const Eigen::VectorXd& torques) : JointState(robot_name, joint_names) {
+  this->set_torques(torques);
+}
+
 JointTorques::JointTorques(const JointState& state) : JointState(state) {
   // set all the state variables to 0 except torques
   this->set_zero();
@@ -27,6 +32,13 @@ JointTorques::JointTorques(const JointState& state) : JointState(state) {
   this->set_empty(state.is_empty());
 }
 
+JointTorques::JointTorques(JointState&& state) : JointState(std::move(state)) {
+  // set all the state variables to 0 except torques
+  this->set_zero(JointStateVariable::POSITIONS);
+  this->set_zero(JointStateVariable::VELOCITIES);
+  this->set_zero(JointStateVariable::ACCELERATIONS);
+}
+
 JointTorques::JointTorques(const JointTorques& torques) : JointTorques(static_cast<const JointState&>(torques)) {}
 
 JointTorques JointTorques::Zero(const std::string& robot_name, unsigned int nb_joints) {
@@ -50,28 +62,43 @@ JointTorques& JointTorques::operator+=(const JointTorques& torques) {
   return (*this);
 }
 
-JointTorques JointTorques::operator+(const JointTorques& torques) const {
+JointTorques JointTorques::operator+(const JointTorques& torques) const& {
   return this->JointState::operator+(torques);
 }
 
+JointTorques JointTorques::operator+(const JointTorques& torques)&& {
+  (*this) += torques;
+  return std::move(*this);
+}
+
 JointTorques& JointTorques::operator-=(const JointTorques& torques) {
   this->JointState::operator-=(torques);
   return (*this);
 }
 
-JointTorques JointTorques::operator-(const JointTorques& torques) const {
+JointTorques JointTorques::operator-(const JointTorques& torques) const& {
   return this->JointState::operator-(torques);
 }
 
+JointTorques JointTorques::operator-(const JointTorques& torques)&& {
+  (*this) -= torques;
+  return std::move(*this);
+}
+
 JointTorques& JointTorques::operator*=(double lambda) {
   this->JointState::operator*=(lambda);
   return (*this);
 }
 
-JointTorques JointTorques::operator*(double lambda) const {
+JointTorques JointTorques::operator*(double lambda) const& {
   return this->JointState::operator*(lambda);
 }
 
+JointTorques JointTorques::operator*(double lambda)&& {
+  (*this) *= lambda;
+  return std::move(*this);
+}
+
 JointTorques& JointTorques::operator*=(const Eigen::ArrayXd& lambda) {
   this->multiply_state_variable(lambda, JointStateVariable::TORQUES);
   return (*this);
@@ -99,10 +126,15 @@ JointTorques& JointTorques::operator/=(double lambda) {
   return (*this);
 }
 
-JointTorques JointTorques::operator/(double lambda) const {
+JointTorques JointTorques::operator/(double lambda) const& {
   return this->JointState::operator/(lambda);
 }
 
+JointTorques JointTorques::operator/(double lambda)&& {
+  (*this) /= lambda;
+  return std::move(*this);
+}
+
 JointTorques JointTorques::copy() const {
   JointTorques result(*this);
   return result;
@@ -154,6 +186,11 @@ JointTorques operator*(double lambda, const JointTorques& torques) {
   return result;
 }
 
+JointTorques operator*(double lambda, JointTorques&& torques) {
+  torques *= lambda;
+  return std::move(torques);
+}
+
 JointTorques operator*(const Eigen::ArrayXd& lambda, const JointTorques& torques) {
   JointTorques result(torques);
   result *= lambda;
@@ -21,6 +21,11 @@ JointVelocities::JointVelocities(const std::string& robot_name, const std::vecto
   this->set_velocities(velocities);
 }
 
+JointVelocities::JointVelocities(const std::string& robot_name, const SharedJointNames& joint_names,
+                                 const Eigen::VectorXd& velocities) : JointState(robot_name, joint_names) {
+  this->set_velocities(velocities);
+}
+
 JointVelocities::JointVelocities(const JointState& state) : JointState(state) {
   // set all the state variables to 0 except velocities
   this->set_zero();
@@ -28,6 +33,13 @@ JointVelocities::JointVelocities(const JointState& state) : JointState(state) {
   this->set_empty(state.is_empty());
 }
 
+JointVelocities::JointVelocities(JointState&& state) : JointState(std::move(state)) {
+  // set all the state variables to 0 except velocities
+  this->set_zero(JointStateVariable::POSITIONS);
+  this->set_zero(JointStateVariable::ACCELERATIONS);
+  this->set_zero(JointStateVariable::TORQUES);
+}
+
 JointVelocities::JointVelocities(const JointVelocities& velocities) : JointVelocities(static_cast<const JointState&>(velocities)) {}
 
 JointVelocities::JointVelocities(const JointPositions& positions) : JointVelocities(positions / std::chrono::seconds(1)) {}
@@ -53,28 +65,43 @@ JointVelocities& JointVelocities::operator+=(const JointVelocities& velocities)
   return (*this);
 }
 
-JointVelocities JointVelocities::operator+(const JointVelocities& velocities) const {
+JointVelocities JointVelocities::operator+(const JointVelocities& velocities) const& {
   return this->JointState::operator+(velocities);
 }
 
+JointVelocities JointVelocities::operator+(const JointVelocities& velocities)&& {
+  (*this) += velocities;
+  return std::move(*this);
+}
+
 JointVelocities& JointVelocities::operator-=(const JointVelocities& velocities) {
   this->JointState::operator-=(velocities);
   return (*this);
 }
 
-JointVelocities JointVelocities::operator-(const JointVelocities& velocities) const {
+JointVelocities JointVelocities::operator-(const JointVelocities& velocities) const& {
   return this->JointState::operator-(velocities);
 }
 
+JointVelocities JointVelocities::operator-(const JointVelocities& velocities)&& {
+  (*this) -= velocities;
+  return std::move(*this);
+}
+
 JointVelocities& JointVelocities::operator*=(double lambda) {
   this->JointState::operator*=(lambda);
   return (*this);
 }
 
-JointVelocities JointVelocities::operator*(double lambda) const {
+JointVelocities JointVelocities::operator*(double lambda) const& {
   return this->JointState::operator*(lambda);
 }
 
+JointVelocities JointVelocities::operator*(double lambda)&& {
+  (*this) *= lambda;
+  return std::move(*this);
+}
+
 JointVelocities& JointVelocities::operator*=(const Eigen::ArrayXd& lambda) {
   this->multiply_state_variable(lambda, JointStateVariable::VELOCITIES);
   return (*this);
@@ -102,12 +129,17 @@ JointVelocities& JointVelocities::operator/=(double lambda) {
   return (*this);
 }
 
-JointVelocities JointVelocities::operator/(double lambda) const {
+JointVelocities JointVelocities::operator/(double lambda) const& {
   return this->JointState::operator/(lambda);
 }
 
+JointVelocities JointVelocities::operator/(double lambda)&& {
+  (*this) /= lambda;
+  return std::move(*this);
+}
+
 JointPositions JointVelocities::operator*(const std::chrono::nanoseconds& dt) const {
-  if (this->is_empty()) { throw EmptyStateException(this->get_name() + " state is empty"); }
+  if (CHECKED_OPERATIONS && this->is_empty()) { throw EmptyStateException(this->get_name() + " state is empty"); }
   // operations
   JointPositions displacement(this->get_name(), this->get_names());
   // convert the period to a double with the second as reference
@@ -169,6 +201,11 @@ JointVelocities operator*(double lambda, const JointVelocities& velocities) {
   return result;
 }
 
+JointVelocities operator*(double lambda, JointVelocities&& velocities) {
+  velocities *= lambda;
+  return std::move(velocities);
+}
+
 JointVelocities operator*(const Eigen::ArrayXd& lambda, const JointVelocities& velocities) {
   JointVelocities result(velocities);
   result *= lambda;
@@ -0,0 +1,913 @@
+#include "state_representation/serialization/BinarySerialization.hpp"
+
+#include <cstring>
+
+#include "state_representation/exceptions/SerializationException.hpp"
+#include "state_representation/parameters/Parameter.hpp"
+#include "state_representation/serialization/LittleEndian.hpp"
+
+namespace state_representation::serialization {
+namespace {
+constexpr uint8_t MAGIC[2] = {'S', 'R'};
+constexpr std::size_t HEADER_SIZE = 16;
+constexpr std::size_t MAX_FRAME_NAMES = 4;
+constexpr uint8_t FLAG_EMPTY = 0x01;
+
+std::size_t align(std::size_t offset) {
+  return (offset + 7) & ~static_cast<std::size_t>(7);
+}
+
+/**
+ * @brief Sequential little-endian writer. Without buffer it only counts the bytes, which is used
+ * to compute the size of a message with the exact same code path as the encoding
+ */
+class Writer {
+private:
+  uint8_t* buffer_;
+  std::size_t capacity_;
+  std::size_t offset_;
+
+  void reserve(std::size_t nb_bytes) {
+    if (this->buffer_ != nullptr && this->offset_ + nb_bytes > this->capacity_) {
+      throw exceptions::SerializationException(
+          "Buffer is too small: capacity of " + std::to_string(this->capacity_) + " bytes, required at least "
+              + std::to_string(this->offset_ + nb_bytes));
+    }
+  }
+
+public:
+  explicit Writer(uint8_t* buffer = nullptr, std::size_t capacity = 0) :
+      buffer_(buffer), capacity_(capacity), offset_(0) {}
+
+  std::size_t offset() const {
+    return this->offset_;
+  }
+
+  template<typename T>
+  void write_integer_at(std::size_t offset, T value) {
+    if (this->buffer_ == nullptr) { return; }
+    store_little_endian(this->buffer_ + offset, value);
+  }
+
+  template<typename T>
+  void write_integer(T value) {
+    this->reserve(sizeof(T));
+    this->write_integer_at(this->offset_, value);
+    this->offset_ += sizeof(T);
+  }
+
+  void write_bytes(const void* data, std::size_t nb_bytes) {
+    this->reserve(nb_bytes);
+    if (this->buffer_ != nullptr && nb_bytes > 0) { std::memcpy(this->buffer_ + this->offset_, data, nb_bytes); }
+    this->offset_ += nb_bytes;
+  }
+
+  void write_string(const std::string& value) {
+    if (value.size() > UINT16_MAX) {
+      throw exceptions::SerializationException("String " + value.substr(0, 32) + "... is too long to be encoded");
+    }
+    this->write_integer(static_cast<uint16_t>(value.size()));
+    this->write_bytes(value.data(), value.size());
+  }
+
+  void write_doubles(const double* data, std::size_t nb_values) {
+    if (is_little_endian_host()) {
+      this->write_bytes(data, nb_values * sizeof(double));
+    } else {
+      for (std::size_t i = 0; i < nb_values; ++i) {
+        uint64_t bits;
+        std::memcpy(&bits, data + i, sizeof(double));
+        this->write_integer(bits);
+      }
+    }
+  }
+
+  void pad() {
+    std::size_t padding = align(this->offset_) - this->offset_;
+    this->reserve(padding);
+    if (this->buffer_ != nullptr) { std::memset(this->buffer_ + this->offset_, 0, padding); }
+    this->offset_ += padding;
+  }
+};
+
+/**
+ * @brief Sequential little-endian reader checking the bounds of the buffer
+ */
+class Reader {
+private:
+  const uint8_t* buffer_;
+  std::size_t size_;
+  std::size_t offset_;
+
+  void require(std::size_t nb_bytes) const {
+    if (this->offset_ + nb_bytes > this->size_) {
+      throw exceptions::SerializationException("Message is truncated");
+    }
+  }
+
+public:
+  explicit Reader(const uint8_t* buffer, std::size_t size) : buffer_(buffer), size_(size), offset_(0) {}
+
+  std::size_t offset() const {
+    return this->offset_;
+  }
+
+  const uint8_t* current() const {
+    return this->buffer_ + this->offset_;
+  }
+
+  template<typename T>
+  T read_integer() {
+    this->require(sizeof(T));
+    auto value = load_little_endian<T>(this->buffer_ + this->offset_);
+    this->offset_ += sizeof(T);
+    return value;
+  }
+
+  std::pair<const char*, uint16_t> read_string() {
+    auto length = this->read_integer<uint16_t>();
+    this->require(length);
+    auto data = reinterpret_cast<const char*>(this->buffer_ + this->offset_);
+    this->offset_ += length;
+    return {data, length};
+  }
+
+  void read_doubles(double* data, std::size_t nb_values) {
+    this->require(nb_values * sizeof(double));
+    if (is_little_endian_host()) {
+      if (nb_values > 0) { std::memcpy(data, this->buffer_ + this->offset_, nb_values * sizeof(double)); }
+      this->offset_ += nb_values * sizeof(double);
+    } else {
+      for (std::size_t i = 0; i < nb_values; ++i) {
+        auto bits = this->read_integer<uint64_t>();
+        std::memcpy(data + i, &bits, sizeof(double));
+      }
+    }
+  }
+
+  const double* view_doubles(std::size_t nb_values) {
+    if (!is_little_endian_host()) {
+      throw exceptions::SerializationException("Views on encoded doubles require a little-endian host");
+    }
+    if (reinterpret_cast<std::uintptr_t>(this->current()) % alignof(double) != 0) {
+      throw exceptions::SerializationException("Views on encoded doubles require an 8-byte aligned buffer");
+    }
+    this->require(nb_values * sizeof(double));
+    auto data = reinterpret_cast<const double*>(this->current());
+    this->offset_ += nb_values * sizeof(double);
+    return data;
+  }
+
+  void skip_padding() {
+    std::size_t padding = align(this->offset_) - this->offset_;
+    this->require(padding);
+    this->offset_ += padding;
+  }
+
+  void skip(std::size_t nb_bytes) {
+    this->require(nb_bytes);
+    this->offset_ += nb_bytes;
+  }
+};
+
+bool equals(const std::string& value, const std::pair<const char*, uint16_t>& encoded) {
+  return value.size() == encoded.second && value.compare(0, value.size(), encoded.first, encoded.second) == 0;
+}
+
+std::string to_string(const std::pair<const char*, uint16_t>& encoded) {
+  return std::string(encoded.first, encoded.second);
+}
+
+/**
+ * @brief Header and frame name table of a message being written
+ */
+class MessageWriter {
+private:
+  Writer& writer_;
+  std::size_t start_;
+
+public:
+  MessageWriter(Writer& writer,
+                MessageType type,
+                const State& state,
+                StateType state_type,
+                std::initializer_list<const std::string*> frame_names) : writer_(writer) {
+    this->writer_.pad();
+    this->start_ = this->writer_.offset();
+    this->writer_.write_bytes(MAGIC, 2);
+    this->writer_.write_integer(BINARY_FORMAT_VERSION);
+    this->writer_.write_integer(static_cast<uint8_t>(type));
+    this->writer_.write_integer(static_cast<uint8_t>(state.is_empty() ? FLAG_EMPTY : 0));
+    this->writer_.write_integer(static_cast<uint8_t>(state_type));
+    // the number of names, doubles and the size are filled once known
+    this->writer_.write_integer(static_cast<uint16_t>(0));
+    this->writer_.write_integer(static_cast<uint32_t>(0));
+    this->writer_.write_integer(static_cast<uint32_t>(0));
+    // frame name table, each name is written once and referred to by its index
+    const std::string* names[MAX_FRAME_NAMES];
+    uint16_t indices[MAX_FRAME_NAMES];
+    uint16_t nb_names = 0;
+    std::size_t nb_frames = 0;
+    for (auto frame_name : frame_names) {
+      uint16_t index = 0;
+      while (index < nb_names && *names[index] != *frame_name) { ++index; }
+      if (index == nb_names) {
+        names[nb_names++] = frame_name;
+        this->writer_.write_string(*frame_name);
+      }
+      indices[nb_frames++] = index;
+    }
+    for (std::size_t i = 0; i < nb_frames; ++i) {
+      this->writer_.write_integer(indices[i]);
+    }
+    this->writer_.write_integer_at(this->start_ + 6, nb_names);
+  }
+
+  void begin_doubles() {
+    this->writer_.pad();
+  }
+
+  void set_nb_doubles(std::size_t nb_doubles) {
+    this->writer_.write_integer_at(this->start_ + 8, static_cast<uint32_t>(nb_doubles));
+  }
+
+  std::size_t finish() {
+    this->writer_.pad();
+    this->writer_.write_integer_at(this->start_ + 12, static_cast<uint32_t>(this->writer_.offset() - this->start_));
+    return this->writer_.offset() - this->start_;
+  }
+};
+
+/**
+ * @brief Header and frame name table of a message being read
+ */
+class MessageReader {
+private:
+  Reader reader_;
+  MessageType type_;
+  bool empty_;
+  uint8_t state_type_;
+  uint32_t nb_doubles_;
+  uint32_t size_;
+  std::pair<const char*, uint16_t> names_[MAX_FRAME_NAMES];
+  uint16_t nb_names_;
+
+public:
+  MessageReader(const uint8_t* buffer, std::size_t size, MessageType expected_type, std::size_t nb_frames) :
+      reader_(buffer, size) {
+    if (size < HEADER_SIZE || buffer[0] != MAGIC[0] || buffer[1] != MAGIC[1]) {
+      throw exceptions::SerializationException("Buffer does not hold a state message");
+    }
+    this->reader_.skip(2);
+    auto version = this->reader_.read_integer<uint8_t>();
+    if (version == 0 || version > BINARY_FORMAT_VERSION) {
+      throw exceptions::SerializationException("Unsupported binary format version " + std::to_string(version));
+    }
+    this->type_ = static_cast<MessageType>(this->reader_.read_integer<uint8_t>());
+    if (this->type_ != expected_type) {
+      throw exceptions::SerializationException(
+          "Unexpected message type " + std::to_string(static_cast<int>(this->type_)) + ", expected "
+              + std::to_string(static_cast<int>(expected_type)));
+    }
+    this->empty_ = (this->reader_.read_integer<uint8_t>() & FLAG_EMPTY) != 0;
+    this->state_type_ = this->reader_.read_integer<uint8_t>();
+    this->nb_names_ = this->reader_.read_integer<uint16_t>();
+    this->nb_doubles_ = this->reader_.read_integer<uint32_t>();
+    this->size_ = this->reader_.read_integer<uint32_t>();
+    if (this->size_ > size) {
+      throw exceptions::SerializationException("Message is truncated");
+    }
+    if (this->nb_names_ > MAX_FRAME_NAMES || this->nb_names_ > nb_frames) {
+      throw exceptions::SerializationException("Invalid frame name table");
+    }
+    // restrict the reads to this message
+    this->reader_ = Reader(buffer, this->size_);
+    this->reader_.skip(HEADER_SIZE);
+    for (uint16_t i = 0; i < this->nb_names_; ++i) {
+      this->names_[i] = this->reader_.read_string();
+    }
+  }
+
+  Reader& reader() {
+    return this->reader_;
+  }
+
+  bool is_empty() const {
+    return this->empty_;
+  }
+
+  StateType get_state_type() const {
+    return static_cast<StateType>(this->state_type_);
+  }
+
+  uint32_t get_nb_doubles() const {
+    return this->nb_doubles_;
+  }
+
+  std::size_t get_size() const {
+    return this->size_;
+  }
+
+  std::pair<const char*, uint16_t> read_frame_name() {
+    auto index = this->reader_.read_integer<uint16_t>();
+    if (index >= this->nb_names_) {
+      throw exceptions::SerializationException("Invalid frame name index");
+    }
+    return this->names_[index];
+  }
+
+  void expect_nb_doubles(std::size_t nb_doubles) const {
+    if (this->nb_doubles_ != nb_doubles) {
+      throw exceptions::SerializationException(
+          "Unexpected number of values " + std::to_string(this->nb_doubles_) + ", expected "
+              + std::to_string(nb_doubles));
+    }
+  }
+};
+
+void set_name(State& state, const std::pair<const char*, uint16_t>& name) {
+  if (!equals(state.get_name(), name)) { state.set_name(to_string(name)); }
+}
+
+void set_empty(State& state, bool empty) {
+  if (empty) {
+    state.set_empty();
+  } else {
+    state.set_filled();
+  }
+}
+
+std::size_t write_message(Writer& writer, const State& state) {
+  MessageWriter message(writer, MessageType::STATE, state, state.get_type(), {&state.get_name()});
+  return message.finish();
+}
+
+std::size_t write_message(Writer& writer, const CartesianState& state) {
+  MessageWriter message(writer, MessageType::CARTESIAN_STATE, state, state.get_type(),
+                        {&state.get_name(), &state.get_reference_frame()});
+  message.begin_doubles();
+  Eigen::Matrix<double, 25, 1> data;
+  data << state.get_pose(), state.get_twist(), state.get_accelerations(), state.get_wrench();
+  writer.write_doubles(data.data(), data.size());
+  message.set_nb_doubles(data.size());
+  return message.finish();
+}
+
+std::size_t write_joint_state(Writer& writer, const State& state, const std::vector<std::string>& joint_names,
+                              const double* positions, const double* velocities, const double* accelerations,
+                              const double* torques) {
+  MessageWriter message(writer, MessageType::JOINT_STATE, state, state.get_type(), {&state.get_name()});
+  writer.write_integer(static_cast<uint32_t>(joint_names.size()));
+  for (const auto& joint_name : joint_names) { writer.write_string(joint_name); }
+  message.begin_doubles();
+  writer.write_doubles(positions, joint_names.size());
+  writer.write_doubles(velocities, joint_names.size());
+  writer.write_doubles(accelerations, joint_names.size());
+  writer.write_doubles(torques, joint_names.size());
+  message.set_nb_doubles(4 * joint_names.size());
+  return message.finish();
+}
+
+std::size_t write_message(Writer& writer, const JointState& state) {
+  return write_joint_state(writer, state, state.get_names(), state.get_positions().data(),
+                           state.get_velocities().data(), state.get_accelerations().data(),
+                           state.get_torques().data());
+}
+
+std::size_t write_message(Writer& writer, const Jacobian& jacobian) {
+  MessageWriter message(writer, MessageType::JACOBIAN, jacobian, jacobian.get_type(),
+                        {&jacobian.get_name(), &jacobian.get_frame(), &jacobian.get_reference_frame()});
+  writer.write_integer(static_cast<uint32_t>(jacobian.rows()));
+  writer.write_integer(static_cast<uint32_t>(jacobian.cols()));
+  writer.write_integer(static_cast<uint32_t>(jacobian.get_joint_names().size()));
+  for (const auto& joint_name : jacobian.get_joint_names()) { writer.write_string(joint_name); }
+  message.begin_doubles();
+  writer.write_doubles(jacobian.data().data(), jacobian.data().size());
+  message.set_nb_doubles(jacobian.data().size());
+  return message.finish();
+}
+
+std::size_t write_message(Writer& writer, const Ellipsoid& ellipsoid) {
+  MessageWriter message(writer, MessageType::ELLIPSOID, ellipsoid, ellipsoid.get_type(), {&ellipsoid.get_name()});
+  message.begin_doubles();
+  double rotation_angle = ellipsoid.get_rotation_angle();
+  writer.write_doubles(&rotation_angle, 1);
+  // axis lengths come after the rotation angle
+  writer.write_doubles(ellipsoid.get_axis_lengths().data(), ellipsoid.get_axis_lengths().size());
+  message.set_nb_doubles(1 + ellipsoid.get_axis_lengths().size());
+  std::size_t size = message.finish();
+  return size + write_message(writer, ellipsoid.get_center_state());
+}
+
+std::size_t write_message(Writer& writer, const ParameterInterface& parameter) {
+  MessageWriter message(writer, MessageType::PARAMETER, parameter, parameter.get_type(), {&parameter.get_name()});
+  std::size_t nb_doubles = 0;
+  const State* nested = nullptr;
+  switch (parameter.get_type()) {
+    case StateType::PARAMETER_DOUBLE:
+      message.begin_doubles();
+      writer.write_doubles(&static_cast<const Parameter<double>&>(parameter).get_value(), 1);
+      nb_doubles = 1;
+      break;
+    case StateType::PARAMETER_DOUBLE_ARRAY: {
+      const auto& value = static_cast<const Parameter<std::vector<double>>&>(parameter).get_value();
+      writer.write_integer(static_cast<uint32_t>(value.size()));
+      message.begin_doubles();
+      writer.write_doubles(value.data(), value.size());
+      nb_doubles = value.size();
+      break;
+    }
+    case StateType::PARAMETER_BOOL:
+      writer.write_integer(static_cast<uint8_t>(static_cast<const Parameter<bool>&>(parameter).get_value()));
+      break;
+    case StateType::PARAMETER_BOOL_ARRAY: {
+      const auto& value = static_cast<const Parameter<std::vector<bool>>&>(parameter).get_value();
+      writer.write_integer(static_cast<uint32_t>(value.size()));
+      for (bool element : value) { writer.write_integer(static_cast<uint8_t>(element)); }
+      break;
+    }
+    case StateType::PARAMETER_STRING:
+      writer.write_string(static_cast<const Parameter<std::string>&>(parameter).get_value());
+      break;
+    case StateType::PARAMETER_STRING_ARRAY: {
+      const auto& value = static_cast<const Parameter<std::vector<std::string>>&>(parameter).get_value();
+      writer.write_integer(static_cast<uint32_t>(value.size()));
+      for (const auto& element : value) { writer.write_string(element); }
+      break;
+    }
+    case StateType::PARAMETER_VECTOR: {
+      const auto& value = static_cast<const Parameter<Eigen::VectorXd>&>(parameter).get_value();
+      writer.write_integer(static_cast<uint32_t>(value.size()));
+      message.begin_doubles();
+      writer.write_doubles(value.data(), value.size());
+      nb_doubles = value.size();
+      break;
+    }
+    case StateType::PARAMETER_MATRIX: {
+      const auto& value = static_cast<const Parameter<Eigen::MatrixXd>&>(parameter).get_value();
+      writer.write_integer(static_cast<uint32_t>(value.rows()));
+      writer.write_integer(static_cast<uint32_t>(value.cols()));
+      message.begin_doubles();
+      writer.write_doubles(value.data(), value.size());
+      nb_doubles = value.size();
+      break;
+    }
+    case StateType::PARAMETER_CARTESIANSTATE:
+      nested = &static_cast<const Parameter<CartesianState>&>(parameter).get_value();
+      break;
+    case StateType::PARAMETER_CARTESIANPOSE:
+      nested = &static_cast<const Parameter<CartesianPose>&>(parameter).get_value();
+      break;
+    case StateType::PARAMETER_JOINTSTATE:
+      nested = &static_cast<const Parameter<JointState>&>(parameter).get_value();
+      break;
+    case StateType::PARAMETER_JOINTPOSITIONS:
+      nested = &static_cast<const Parameter<JointPositions>&>(parameter).get_value();
+      break;
+    case StateType::PARAMETER_ELLIPSOID:
+      nested = &static_cast<const Parameter<Ellipsoid>&>(parameter).get_value();
+      break;
+    default:
+      throw exceptions::SerializationException("Parameter " + parameter.get_name() + " is of unsupported type");
+  }
+  message.set_nb_doubles(nb_doubles);
+  std::size_t size = message.finish();
+  if (nested != nullptr) {
+    switch (nested->get_type()) {
+      case StateType::CARTESIANSTATE:
+        size += write_message(writer, static_cast<const CartesianState&>(*nested));
+        break;
+      case StateType::JOINTSTATE:
+        size += write_message(writer, static_cast<const JointState&>(*nested));
+        break;
+      default:
+        size += write_message(writer, static_cast<const Ellipsoid&>(*nested));
+        break;
+    }
+  }
+  return size;
+}
+
+template<class StateT>
+std::size_t write_trajectory(Writer& writer, const Trajectory<StateT>& trajectory, StateType point_type) {
+  std::string reference_frame = trajectory.get_reference_frame();
+  MessageWriter message(writer, MessageType::TRAJECTORY, trajectory, point_type,
+                        {&trajectory.get_name(), &reference_frame});
+  writer.write_integer(static_cast<uint32_t>(trajectory.get_joint_names().size()));
+  for (const auto& joint_name : trajectory.get_joint_names()) { writer.write_string(joint_name); }
+  writer.write_integer(static_cast<uint32_t>(trajectory.get_size()));
+  for (const auto& time : trajectory.get_times()) { writer.write_integer(static_cast<int64_t>(time.count())); }
+  std::size_t size = message.finish();
+  for (const auto& point : trajectory.get_points()) { size += write_message(writer, point); }
+  return size;
+}
+
+std::size_t read_message(const uint8_t* buffer, std::size_t size, CartesianState& state) {
+  MessageReader message(buffer, size, MessageType::CARTESIAN_STATE, 2);
+  set_name(state, message.read_frame_name());
+  auto reference_frame = message.read_frame_name();
+  if (!equals(state.get_reference_frame(), reference_frame)) { state.set_reference_frame(to_string(reference_frame)); }
+  message.reader().skip_padding();
+  message.expect_nb_doubles(25);
+  Eigen::Matrix<double, 25, 1> data;
+  message.reader().read_doubles(data.data(), data.size());
+  state.set_pose(data.segment<7>(0));
+  state.set_twist(data.segment<6>(7));
+  state.set_accelerations(data.segment<6>(13));
+  state.set_wrench(data.segment<6>(19));
+  set_empty(state, message.is_empty());
+  return message.get_size();
+}
+
+std::size_t read_message(const uint8_t* buffer, std::size_t size, JointState& state) {
+  MessageReader message(buffer, size, MessageType::JOINT_STATE, 1);
+  set_name(state, message.read_frame_name());
+  auto nb_joints = message.reader().read_integer<uint32_t>();
+  // keep the current table of joint names when the names are unchanged
+  bool same_names = (nb_joints == state.get_size());
+  std::vector<std::string> joint_names;
+  for (uint32_t i = 0; i < nb_joints; ++i) {
+    auto joint_name = message.reader().read_string();
+    if (same_names && !equals(state.get_names()[i], joint_name)) {
+      same_names = false;
+      joint_names.reserve(nb_joints);
+      joint_names.assign(state.get_names().begin(), state.get_names().begin() + i);
+    }
+    if (!same_names) { joint_names.push_back(to_string(joint_name)); }
+  }
+  if (nb_joints != state.get_size()) {
+    static_cast<JointState&>(state) = JointState(state.get_name(), joint_names);
+  } else if (!same_names) {
+    state.set_names(joint_names);
+  }
+  message.reader().skip_padding();
+  message.expect_nb_doubles(4 * nb_joints);
+  if (is_little_endian_host() && reinterpret_cast<std::uintptr_t>(message.reader().current()) % alignof(double) == 0) {
+    JointStateView(message.reader().view_doubles(4 * nb_joints), nb_joints).copy_to(state);
+  } else {
+    Eigen::VectorXd data(4 * nb_joints);
+    message.reader().read_doubles(data.data(), data.size());
+    state.set_positions(data.segment(0, nb_joints));
+    state.set_velocities(data.segment(nb_joints, nb_joints));
+    state.set_accelerations(data.segment(2 * nb_joints, nb_joints));
+    state.set_torques(data.segment(3 * nb_joints, nb_joints));
+  }
+  set_empty(state, message.is_empty());
+  return message.get_size();
+}
+
+std::size_t read_message(const uint8_t* buffer, std::size_t size, Jacobian& jacobian) {
+  MessageReader message(buffer, size, MessageType::JACOBIAN, 3);
+  auto name = message.read_frame_name();
+  auto frame = message.read_frame_name();
+  auto reference_frame = message.read_frame_name();
+  auto rows = message.reader().read_integer<uint32_t>();
+  auto cols = message.reader().read_integer<uint32_t>();
+  auto nb_joints = message.reader().read_integer<uint32_t>();
+  bool same_layout = equals(jacobian.get_name(), name) && equals(jacobian.get_frame(), frame)
+      && equals(jacobian.get_reference_frame(), reference_frame) && jacobian.rows() == rows && jacobian.cols() == cols
+      && jacobian.get_joint_names().size() == nb_joints;
+  std::vector<std::string> joint_names;
+  for (uint32_t i = 0; i < nb_joints; ++i) {
+    auto joint_name = message.reader().read_string();
+    if (same_layout && !equals(jacobian.get_joint_names()[i], joint_name)) {
+      same_layout = false;
+      joint_names.reserve(nb_joints);
+      joint_names.assign(jacobian.get_joint_names().begin(), jacobian.get_joint_names().begin() + i);
+    }
+    if (!same_layout) { joint_names.push_back(to_string(joint_name)); }
+  }
+  if (!same_layout) {
+    Jacobian result(to_string(name), joint_names, to_string(frame), to_string(reference_frame));
+    if (rows == nb_joints && cols == 6 && rows != 6) {
+      // transposed Jacobian
+      result = result.transpose();
+    } else if (rows != 6 || cols != nb_joints) {
+      throw exceptions::SerializationException(
+          "Jacobian of size " + std::to_string(rows) + "x" + std::to_string(cols) + " with "
+              + std::to_string(nb_joints) + " joints cannot be decoded");
+    }
+    jacobian = result;
+  }
+  message.reader().skip_padding();
+  message.expect_nb_doubles(static_cast<std::size_t>(rows) * cols);
+  if (is_little_endian_host() && reinterpret_cast<std::uintptr_t>(message.reader().current()) % alignof(double) == 0) {
+    JacobianView(message.reader().view_doubles(rows * cols), rows, cols).copy_to(jacobian);
+  } else {
+    Eigen::MatrixXd data(rows, cols);
+    message.reader().read_doubles(data.data(), data.size());
+    jacobian.set_data(data);
+  }
+  set_empty(jacobian, message.is_empty());
+  return message.get_size();
+}
+
+std::size_t read_message(const uint8_t* buffer, std::size_t size, Ellipsoid& ellipsoid) {
+  MessageReader message(buffer, size, MessageType::ELLIPSOID, 1);
+  set_name(ellipsoid, message.read_frame_name());
+  message.reader().skip_padding();
+  if (message.get_nb_doubles() < 1) {
+    throw exceptions::SerializationException("Ellipsoid message is missing its rotation angle");
+  }
+  double rotation_angle;
+  message.reader().read_doubles(&rotation_angle, 1);
+  std::vector<double> axis_lengths(message.get_nb_doubles() - 1);
+  message.reader().read_doubles(axis_lengths.data(), axis_lengths.size());
+  CartesianState center_state = ellipsoid.get_center_state();
+  std::size_t nested_size = read_message(buffer + message.get_size(), size - message.get_size(), center_state);
+  ellipsoid.set_center_state(center_state);
+  ellipsoid.set_rotation_angle(rotation_angle);
+  ellipsoid.set_axis_lengths(axis_lengths);
+  set_empty(ellipsoid, message.is_empty());
+  return message.get_size() + nested_size;
+}
+
+template<class StateT>
+std::size_t read_trajectory(const uint8_t* buffer, std::size_t size, Trajectory<StateT>& trajectory,
+                            StateType point_type) {
+  MessageReader message(buffer, size, MessageType::TRAJECTORY, 2);
+  if (message.get_state_type() != point_type) {
+    throw exceptions::SerializationException("Trajectory message holds points of another type");
+  }
+  auto name = message.read_frame_name();
+  auto reference_frame = message.read_frame_name();
+  auto nb_joints = message.reader().read_integer<uint32_t>();
+  std::vector<std::string> joint_names(nb_joints);
+  for (auto& joint_name : joint_names) { joint_name = to_string(message.reader().read_string()); }
+  auto nb_points = message.reader().read_integer<uint32_t>();
+  std::vector<std::chrono::nanoseconds> times(nb_points);
+  for (auto& time : times) { time = std::chrono::nanoseconds(message.reader().read_integer<int64_t>()); }
+  set_name(trajectory, name);
+  trajectory.set_reference_frame(to_string(reference_frame));
+  trajectory.set_joint_names(joint_names);
+  trajectory.clear();
+  std::size_t offset = message.get_size();
+  std::chrono::nanoseconds previous_time(0);
+  for (uint32_t i = 0; i < nb_points; ++i) {
+    StateT point;
+    offset += read_message(buffer + offset, size - offset, point);
+    // times are stored cumulated while points are added relative to the previous one
+    trajectory.add_point(point, times[i] - previous_time);
+    previous_time = times[i];
+  }
+  set_empty(trajectory, message.is_empty());
+  return offset;
+}
+}// namespace
+
+MessageType get_message_type(const uint8_t* buffer, std::size_t size) {
+  if (size < HEADER_SIZE || buffer[0] != MAGIC[0] || buffer[1] != MAGIC[1]) {
+    throw exceptions::SerializationException("Buffer does not hold a state message");
+  }
+  return static_cast<MessageType>(buffer[3]);
+}
+
+std::size_t get_encoded_size(const State& state) {
+  Writer counter;
+  return write_message(counter, state);
+}
+
+std::size_t get_encoded_size(const CartesianState& state) {
+  Writer counter;
+  return write_message(counter, state);
+}
+
+std::size_t get_encoded_size(const JointState& state) {
+  Writer counter;
+  return write_message(counter, state);
+}
+
+std::size_t get_encoded_size(const Jacobian& state) {
+  Writer counter;
+  return write_message(counter, state);
+}
+
+std::size_t get_encoded_size(const Ellipsoid& state) {
+  Writer counter;
+  return write_message(counter, state);
+}
+
+std::size_t get_encoded_size(const ParameterInterface& state) {
+  Writer counter;
+  return write_message(counter, state);
+}
+
+std::size_t get_encoded_size(const Trajectory<CartesianState>& state) {
+  Writer counter;
+  return write_trajectory(counter, state, StateType::CARTESIANSTATE);
+}
+
+std::size_t get_encoded_size(const Trajectory<JointState>& state) {
+  Writer counter;
+  return write_trajectory(counter, state, StateType::JOINTSTATE);
+}
+
+std::size_t encode(const State& state, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_message(writer, state);
+}
+
+std::size_t encode(const CartesianState& state, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_message(writer, state);
+}
+
+std::size_t encode(const JointState& state, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_message(writer, state);
+}
+
+std::size_t encode(const Jacobian& state, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_message(writer, state);
+}
+
+std::size_t encode(const Ellipsoid& state, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_message(writer, state);
+}
+
+std::size_t encode(const ParameterInterface& state, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_message(writer, state);
+}
+
+std::size_t encode(const Trajectory<CartesianState>& state, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_trajectory(writer, state, StateType::CARTESIANSTATE);
+}
+
+std::size_t encode(const Trajectory<JointState>& state, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_trajectory(writer, state, StateType::JOINTSTATE);
+}
+
+namespace detail {
+std::size_t encode_joint_state(const State& state, const std::vector<std::string>& joint_names,
+                               const double* positions, const double* velocities, const double* accelerations,
+                               const double* torques, uint8_t* buffer, std::size_t capacity) {
+  Writer writer(buffer, capacity);
+  return write_joint_state(writer, state, joint_names, positions, velocities, accelerations, torques);
+}
+}// namespace detail
+
+std::size_t decode(const uint8_t* buffer, std::size_t size, State& state) {
+  MessageReader message(buffer, size, MessageType::STATE, 1);
+  if (message.get_state_type() != state.get_type()) {
+    throw exceptions::SerializationException("State message holds a state of another type");
+  }
+  set_name(state, message.read_frame_name());
+  set_empty(state, message.is_empty());
+  return message.get_size();
+}
+
+std::size_t decode(const uint8_t* buffer, std::size_t size, CartesianState& state) {
+  return read_message(buffer, size, state);
+}
+
+std::size_t decode(const uint8_t* buffer, std::size_t size, JointState& state) {
+  return read_message(buffer, size, state);
+}
+
+std::size_t decode(const uint8_t* buffer, std::size_t size, Jacobian& state) {
+  return read_message(buffer, size, state);
+}
+
+std::size_t decode(const uint8_t* buffer, std::size_t size, Ellipsoid& state) {
+  return read_message(buffer, size, state);
+}
+
+std::size_t decode(const uint8_t* buffer, std::size_t size, Trajectory<CartesianState>& state) {
+  return read_trajectory(buffer, size, state, StateType::CARTESIANSTATE);
+}
+
+std::size_t decode(const uint8_t* buffer, std::size_t size, Trajectory<JointState>& state) {
+  return read_trajectory(buffer, size, state, StateType::JOINTSTATE);
+}
+
+std::shared_ptr<ParameterInterface> decode_parameter(const uint8_t* buffer, std::size_t size) {
+  MessageReader message(buffer, size, MessageType::PARAMETER, 1);
+  std::string name = to_string(message.read_frame_name());
+  Reader& reader = message.reader();
+  const uint8_t* nested = buffer + message.get_size();
+  std::size_t nested_size = size - message.get_size();
+  std::shared_ptr<ParameterInterface> parameter;
+  switch (message.get_state_type()) {
+    case StateType::PARAMETER_DOUBLE: {
+      double value;
+      reader.skip_padding();
+      reader.read_doubles(&value, 1);
+      parameter = std::make_shared<Parameter<double>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_DOUBLE_ARRAY: {
+      std::vector<double> value(reader.read_integer<uint32_t>());
+      reader.skip_padding();
+      reader.read_doubles(value.data(), value.size());
+      parameter = std::make_shared<Parameter<std::vector<double>>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_BOOL:
+      parameter = std::make_shared<Parameter<bool>>(name, reader.read_integer<uint8_t>() != 0);
+      break;
+    case StateType::PARAMETER_BOOL_ARRAY: {
+      std::vector<bool> value(reader.read_integer<uint32_t>());
+      for (std::size_t i = 0; i < value.size(); ++i) { value[i] = reader.read_integer<uint8_t>() != 0; }
+      parameter = std::make_shared<Parameter<std::vector<bool>>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_STRING:
+      parameter = std::make_shared<Parameter<std::string>>(name, to_string(reader.read_string()));
+      break;
+    case StateType::PARAMETER_STRING_ARRAY: {
+      std::vector<std::string> value(reader.read_integer<uint32_t>());
+      for (auto& element : value) { element = to_string(reader.read_string()); }
+      parameter = std::make_shared<Parameter<std::vector<std::string>>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_VECTOR: {
+      Eigen::VectorXd value(reader.read_integer<uint32_t>());
+      reader.skip_padding();
+      reader.read_doubles(value.data(), value.size());
+      parameter = std::make_shared<Parameter<Eigen::VectorXd>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_MATRIX: {
+      auto rows = reader.read_integer<uint32_t>();
+      auto cols = reader.read_integer<uint32_t>();
+      Eigen::MatrixXd value(rows, cols);
+      reader.skip_padding();
+      reader.read_doubles(value.data(), value.size());
+      parameter = std::make_shared<Parameter<Eigen::MatrixXd>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_CARTESIANSTATE: {
+      CartesianState value;
+      read_message(nested, nested_size, value);
+      parameter = std::make_shared<Parameter<CartesianState>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_CARTESIANPOSE: {
+      CartesianPose value;
+      read_message(nested, nested_size, value);
+      parameter = std::make_shared<Parameter<CartesianPose>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_JOINTSTATE: {
+      JointState value;
+      read_message(nested, nested_size, value);
+      parameter = std::make_shared<Parameter<JointState>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_JOINTPOSITIONS: {
+      JointPositions value;
+      read_message(nested, nested_size, value);
+      parameter = std::make_shared<Parameter<JointPositions>>(name, value);
+      break;
+    }
+    case StateType::PARAMETER_ELLIPSOID: {
+      Ellipsoid value(name);
+      read_message(nested, nested_size, value);
+      parameter = std::make_shared<Parameter<Ellipsoid>>(name, value);
+      break;
+    }
+    default:
+      throw exceptions::SerializationException("Parameter " + name + " is of unsupported type");
+  }
+  if (message.is_empty()) { parameter->set_empty(); }
+  return parameter;
+}
+
+CartesianStateView decode_cartesian_state_view(const uint8_t* buffer, std::size_t size) {
+  MessageReader message(buffer, size, MessageType::CARTESIAN_STATE, 2);
+  message.read_frame_name();
+  message.read_frame_name();
+  message.reader().skip_padding();
+  message.expect_nb_doubles(25);
+  return CartesianStateView(message.reader().view_doubles(25));
+}
+
+JointStateView decode_joint_state_view(const uint8_t* buffer, std::size_t size) {
+  MessageReader message(buffer, size, MessageType::JOINT_STATE, 1);
+  message.read_frame_name();
+  auto nb_joints = message.reader().read_integer<uint32_t>();
+  for (uint32_t i = 0; i < nb_joints; ++i) { message.reader().read_string(); }
+  message.reader().skip_padding();
+  message.expect_nb_doubles(4 * nb_joints);
+  return JointStateView(message.reader().view_doubles(4 * nb_joints), nb_joints);
+}
+
+JacobianView decode_jacobian_view(const uint8_t* buffer, std::size_t size) {
+  MessageReader message(buffer, size, MessageType::JACOBIAN, 3);
+  message.read_frame_name();
+  message.read_frame_name();
+  message.read_frame_name();
+  auto rows = message.reader().read_integer<uint32_t>();
+  auto cols = message.reader().read_integer<uint32_t>();
+  auto nb_joints = message.reader().read_integer<uint32_t>();
+  for (uint32_t i = 0; i < nb_joints; ++i) { message.reader().read_string(); }
+  message.reader().skip_padding();
+  message.expect_nb_doubles(static_cast<std::size_t>(rows) * cols);
+  return JacobianView(message.reader().view_doubles(rows * cols), rows, cols);
+}
+}// namespace state_representation::serialization
@@ -0,0 +1,456 @@
+#include "state_representation/serialization/StateLog.hpp"
+
+#include <cstring>
+#include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include "state_representation/exceptions/SerializationException.hpp"
+#include "state_representation/serialization/LittleEndian.hpp"
+
+namespace state_representation::serialization {
+namespace {
+constexpr char FILE_MAGIC[8] = {'S', 'R', 'L', 'O', 'G', 0, 0, 0};
+constexpr char INDEX_MAGIC[8] = {'S', 'R', 'L', 'O', 'G', 'I', 'D', 'X'};
+constexpr std::size_t FILE_HEADER_SIZE = 32;
+constexpr std::size_t RECORD_HEADER_SIZE = 16;
+constexpr std::size_t TRAILER_SIZE = 24;
+constexpr auto CHANNEL_RECORD = static_cast<uint16_t>(StateLogRecordKind::CHANNEL);
+constexpr auto STATE_RECORD = static_cast<uint16_t>(StateLogRecordKind::STATE);
+constexpr auto PADDING_RECORD = static_cast<uint16_t>(StateLogRecordKind::PADDING);
+
+struct RecordHeader {
+  uint16_t kind;
+  uint16_t channel;
+  uint32_t payload_size;
+  int64_t time;
+};
+
+void store_record_header(uint8_t* data, const RecordHeader& header) {
+  store_little_endian(data, header.kind);
+  store_little_endian(data + 2, header.channel);
+  store_little_endian(data + 4, header.payload_size);
+  store_little_endian(data + 8, header.time);
+}
+
+RecordHeader load_record_header(const uint8_t* data) {
+  return {load_little_endian<uint16_t>(data), load_little_endian<uint16_t>(data + 2),
+          load_little_endian<uint32_t>(data + 4), load_little_endian<int64_t>(data + 8)};
+}
+
+std::size_t align(std::size_t offset) {
+  return (offset + 7) & ~static_cast<std::size_t>(7);
+}
+
+void write_to_file(FILE* file, const void* data, std::size_t size) {
+  if (size > 0 && std::fwrite(data, 1, size, file) != size) {
+    throw exceptions::SerializationException("Failed to write the state log");
+  }
+}
+
+template<typename T>
+void write_integers_to_file(FILE* file, const T* data, std::size_t count) {
+  if (is_little_endian_host()) {
+    write_to_file(file, data, count * sizeof(T));
+    return;
+  }
+  uint8_t bytes[sizeof(T)];
+  for (std::size_t i = 0; i < count; ++i) {
+    store_little_endian(bytes, data[i]);
+    write_to_file(file, bytes, sizeof(T));
+  }
+}
+}// namespace
+
+StateLogWriter::StateLogWriter(const std::string& path, std::size_t queue_capacity,
+                               const std::chrono::microseconds& flush_period) :
+    capacity_(align(std::max<std::size_t>(queue_capacity, 64))), head_(0), tail_(0), pending_head_(0),
+    flush_period_(flush_period), stop_(false), failed_(false), closed_(false), dropped_(0), file_offset_(0) {
+  this->file_ = std::fopen(path.c_str(), "wb");
+  if (this->file_ == nullptr) {
+    throw exceptions::SerializationException("Failed to create the state log " + path);
+  }
+  this->queue_ = std::make_unique<uint64_t[]>(this->capacity_ / sizeof(uint64_t));
+  uint8_t header[FILE_HEADER_SIZE] = {};
+  std::memcpy(header, FILE_MAGIC, sizeof(FILE_MAGIC));
+  store_little_endian(header + 8, STATE_LOG_FORMAT_VERSION);
+  store_little_endian(header + 12, static_cast<uint32_t>(FILE_HEADER_SIZE));
+  write_to_file(this->file_, header, FILE_HEADER_SIZE);
+  this->file_offset_ = FILE_HEADER_SIZE;
+  this->flush_thread_ = std::thread(&StateLogWriter::run, this);
+}
+
+StateLogWriter::~StateLogWriter() {
+  try {
+    this->close();
+  } catch (const std::exception&) {}
+}
+
+uint8_t* StateLogWriter::reserve(std::size_t payload_size) {
+  std::size_t size = RECORD_HEADER_SIZE + payload_size;
+  if (size > this->capacity_) {
+    return nullptr;
+  }
+  auto* bytes = reinterpret_cast<uint8_t*>(this->queue_.get());
+  std::size_t head = this->head_.load(std::memory_order_relaxed);
+  std::size_t tail = this->tail_.load(std::memory_order_acquire);
+  std::size_t position = head % this->capacity_;
+  // a record is contiguous in the queue, the end of the queue is skipped with a padding record if it is too short
+  std::size_t skipped = this->capacity_ - position < size ? this->capacity_ - position : 0;
+  if (head + skipped + size - tail > this->capacity_) {
+    return nullptr;
+  }
+  if (skipped > 0) {
+    store_little_endian(bytes + position, PADDING_RECORD);
+    head += skipped;
+    position = 0;
+  }
+  this->pending_head_ = head;
+  return bytes + position + RECORD_HEADER_SIZE;
+}
+
+void StateLogWriter::commit(StateLogRecordKind kind, uint16_t channel, int64_t time, std::size_t payload_size) {
+  auto* bytes = reinterpret_cast<uint8_t*>(this->queue_.get());
+  store_record_header(bytes + this->pending_head_ % this->capacity_,
+                      {static_cast<uint16_t>(kind), channel, static_cast<uint32_t>(payload_size), time});
+  this->head_.store(this->pending_head_ + RECORD_HEADER_SIZE + payload_size, std::memory_order_release);
+}
+
+void StateLogWriter::check_record(uint16_t channel, const std::chrono::nanoseconds& time) const {
+  if (this->closed_) {
+    throw exceptions::SerializationException("The state log is closed");
+  }
+  this->check_error();
+  if (channel >= this->channel_names_.size()) {
+    throw exceptions::InvalidParameterException(
+        "Channel " + std::to_string(channel) + " of the state log does not exist");
+  }
+  if (time.count() < this->last_times_[channel]) {
+    throw exceptions::InvalidParameterException("The time of a state cannot precede the last state of channel "
+                                                    + this->channel_names_[channel]);
+  }
+}
+
+void StateLogWriter::check_error() const {
+  if (this->failed_.load(std::memory_order_acquire)) {
+    std::rethrow_exception(this->error_);
+  }
+}
+
+uint16_t StateLogWriter::add_channel(const std::string& name) {
+  if (this->closed_) {
+    throw exceptions::SerializationException("The state log is closed");
+  }
+  this->check_error();
+  if (std::find(this->channel_names_.begin(), this->channel_names_.end(), name) != this->channel_names_.end()) {
+    throw exceptions::InvalidParameterException("Channel " + name + " already exists in the state log");
+  }
+  if (this->channel_names_.size() > UINT16_MAX) {
+    throw exceptions::InvalidParameterException(
+        "The state log cannot have more than " + std::to_string(UINT16_MAX + 1) + " channels");
+  }
+  auto channel = static_cast<uint16_t>(this->channel_names_.size());
+  std::size_t size = align(8 + name.size());
+  uint8_t* payload;
+  while ((payload = this->reserve(size)) == nullptr) {
+    if (RECORD_HEADER_SIZE + size > this->capacity_) {
+      throw exceptions::InvalidParameterException(
+          "The name of channel " + name + " does not fit in the queue of the state log");
+    }
+    this->check_error();
+    std::this_thread::sleep_for(this->flush_period_);
+  }
+  std::memset(payload, 0, size);
+  store_little_endian(payload, static_cast<uint32_t>(name.size()));
+  std::memcpy(payload + 8, name.data(), name.size());
+  this->commit(StateLogRecordKind::CHANNEL, channel, 0, size);
+  this->channel_names_.push_back(name);
+  this->last_times_.push_back(std::numeric_limits<int64_t>::min());
+  return channel;
+}
+
+bool StateLogWriter::drain() {
+  auto* bytes = reinterpret_cast<uint8_t*>(this->queue_.get());
+  std::size_t tail = this->tail_.load(std::memory_order_relaxed);
+  std::size_t head = this->head_.load(std::memory_order_acquire);
+  if (tail == head) {
+    return false;
+  }
+  while (tail != head) {
+    std::size_t position = tail % this->capacity_;
+    auto kind = load_little_endian<uint16_t>(bytes + position);
+    if (kind == PADDING_RECORD) {
+      tail += this->capacity_ - position;
+      continue;
+    }
+    auto header = load_record_header(bytes + position);
+    std::size_t size = RECORD_HEADER_SIZE + header.payload_size;
+    write_to_file(this->file_, bytes + position, size);
+    if (header.kind == CHANNEL_RECORD) {
+      auto length = load_little_endian<uint32_t>(bytes + position + RECORD_HEADER_SIZE);
+      this->index_names_.emplace_back(reinterpret_cast<const char*>(bytes + position + RECORD_HEADER_SIZE + 8), length);
+      this->index_times_.emplace_back();
+      this->index_offsets_.emplace_back();
+    } else {
+      this->index_times_[header.channel].push_back(header.time);
+      this->index_offsets_[header.channel].push_back(this->file_offset_);
+    }
+    this->file_offset_ += size;
+    tail += size;
+    // release the space of the record only once it is written
+    this->tail_.store(tail, std::memory_order_release);
+  }
+  return true;
+}
+
+void StateLogWriter::run() {
+  // an exception escaping the thread would terminate the process, it is rethrown on the producer side instead
+  try {
+    while (!this->stop_.load(std::memory_order_acquire)) {
+      if (!this->drain()) {
+        std::this_thread::sleep_for(this->flush_period_);
+      }
+    }
+    this->drain();
+  } catch (...) {
+    this->error_ = std::current_exception();
+    this->failed_.store(true, std::memory_order_release);
+  }
+}
+
+void StateLogWriter::flush() {
+  if (this->closed_) {
+    return;
+  }
+  std::size_t head = this->head_.load(std::memory_order_relaxed);
+  while (this->tail_.load(std::memory_order_acquire) < head) {
+    this->check_error();
+    std::this_thread::sleep_for(this->flush_period_);
+  }
+  this->check_error();
+  if (std::fflush(this->file_) != 0) {
+    throw exceptions::SerializationException("Failed to write the state log");
+  }
+}
+
+void StateLogWriter::write_index() {
+  std::size_t index_offset = this->file_offset_;
+  const uint8_t padding[8] = {};
+  for (std::size_t c = 0; c < this->index_names_.size(); ++c) {
+    const std::string& name = this->index_names_[c];
+    uint64_t name_header = name.size();
+    write_integers_to_file(this->file_, &name_header, 1);
+    write_to_file(this->file_, name.data(), name.size());
+    write_to_file(this->file_, padding, align(name.size()) - name.size());
+    uint64_t count = this->index_times_[c].size();
+    write_integers_to_file(this->file_, &count, 1);
+    write_integers_to_file(this->file_, this->index_times_[c].data(), count);
+    write_integers_to_file(this->file_, this->index_offsets_[c].data(), count);
+  }
+  uint64_t trailer[2] = {index_offset, this->index_names_.size()};
+  write_integers_to_file(this->file_, trailer, 2);
+  write_to_file(this->file_, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+}
+
+void StateLogWriter::close() {
+  if (this->closed_) {
+    return;
+  }
+  this->closed_ = true;
+  this->stop_.store(true, std::memory_order_release);
+  if (this->flush_thread_.joinable()) {
+    this->flush_thread_.join();
+  }
+  try {
+    this->check_error();
+    this->write_index();
+  } catch (...) {
+    std::fclose(this->file_);
+    throw;
+  }
+  if (std::fclose(this->file_) != 0) {
+    throw exceptions::SerializationException("Failed to close the state log");
+  }
+}
+
+std::size_t StateLogWriter::get_dropped_count() const {
+  return this->dropped_;
+}
+
+StateLogReader::StateLogReader(const std::string& path) : data_(nullptr), size_(0), indexed_(false) {
+  int descriptor = ::open(path.c_str(), O_RDONLY);
+  if (descriptor < 0) {
+    throw exceptions::SerializationException("Failed to open the state log " + path);
+  }
+  struct stat status{};
+  if (::fstat(descriptor, &status) != 0 || status.st_size < static_cast<off_t>(FILE_HEADER_SIZE)) {
+    ::close(descriptor);
+    throw exceptions::SerializationException("File " + path + " is not a state log");
+  }
+  this->size_ = static_cast<std::size_t>(status.st_size);
+  void* data = ::mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  ::close(descriptor);
+  if (data == MAP_FAILED) {
+    throw exceptions::SerializationException("Failed to map the state log " + path);
+  }
+  this->data_ = static_cast<const uint8_t*>(data);
+  if (std::memcmp(this->data_, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0
+      || load_little_endian<uint32_t>(this->data_ + 8) != STATE_LOG_FORMAT_VERSION) {
+    ::munmap(const_cast<uint8_t*>(this->data_), this->size_);
+    throw exceptions::SerializationException("File " + path + " is not a state log of version "
+                                                 + std::to_string(STATE_LOG_FORMAT_VERSION));
+  }
+  this->indexed_ = this->read_index();
+  if (!this->indexed_) {
+    this->scan_records();
+  }
+}
+
+StateLogReader::~StateLogReader() {
+  ::munmap(const_cast<uint8_t*>(this->data_), this->size_);
+}
+
+bool StateLogReader::read_index() {
+  if (this->size_ < FILE_HEADER_SIZE + TRAILER_SIZE
+      || std::memcmp(this->data_ + this->size_ - sizeof(INDEX_MAGIC), INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+    return false;
+  }
+  auto offset = load_little_endian<uint64_t>(this->data_ + this->size_ - TRAILER_SIZE);
+  auto nb_channels = load_little_endian<uint64_t>(this->data_ + this->size_ - TRAILER_SIZE + 8);
+  std::size_t end = this->size_ - TRAILER_SIZE;
+  std::vector<Channel> channels(nb_channels);
+  for (auto& channel : channels) {
+    if (offset + 8 > end) {
+      return false;
+    }
+    auto length = load_little_endian<uint64_t>(this->data_ + offset);
+    offset += 8;
+    if (offset + align(length) + 8 > end) {
+      return false;
+    }
+    channel.name.assign(reinterpret_cast<const char*>(this->data_ + offset), length);
+    offset += align(length);
+    channel.size = load_little_endian<uint64_t>(this->data_ + offset);
+    offset += 8;
+    if (offset + 16 * channel.size > end) {
+      return false;
+    }
+    if (is_little_endian_host()) {
+      // the columns of the index are 8-byte aligned in the mapped file and are used in place
+      channel.times = reinterpret_cast<const int64_t*>(this->data_ + offset);
+      channel.offsets = reinterpret_cast<const uint64_t*>(this->data_ + offset + 8 * channel.size);
+    } else {
+      channel.owned_times.resize(channel.size);
+      channel.owned_offsets.resize(channel.size);
+      for (std::size_t i = 0; i < channel.size; ++i) {
+        channel.owned_times[i] = load_little_endian<int64_t>(this->data_ + offset + 8 * i);
+        channel.owned_offsets[i] = load_little_endian<uint64_t>(this->data_ + offset + 8 * (channel.size + i));
+      }
+      channel.times = channel.owned_times.data();
+      channel.offsets = channel.owned_offsets.data();
+    }
+    offset += 16 * channel.size;
+  }
+  this->channels_ = std::move(channels);
+  return true;
+}
+
+void StateLogReader::scan_records() {
+  std::size_t offset = FILE_HEADER_SIZE;
+  while (offset + RECORD_HEADER_SIZE <= this->size_) {
+    auto header = load_record_header(this->data_ + offset);
+    std::size_t size = RECORD_HEADER_SIZE + header.payload_size;
+    if (offset + size > this->size_) {
+      break;
+    }
+    if (header.kind == CHANNEL_RECORD && header.channel == this->channels_.size() && header.payload_size >= 8
+        && load_little_endian<uint32_t>(this->data_ + offset + RECORD_HEADER_SIZE) <= header.payload_size - 8) {
+      auto length = load_little_endian<uint32_t>(this->data_ + offset + RECORD_HEADER_SIZE);
+      Channel channel;
+      channel.name.assign(reinterpret_cast<const char*>(this->data_ + offset + RECORD_HEADER_SIZE + 8), length);
+      this->channels_.push_back(std::move(channel));
+    } else if (header.kind == STATE_RECORD && header.channel < this->channels_.size() && header.payload_size >= 16) {
+      Channel& channel = this->channels_[header.channel];
+      channel.owned_times.push_back(header.time);
+      channel.owned_offsets.push_back(offset);
+    } else {
+      // anything else is the start of an index or a corrupted record, the log ends here
+      break;
+    }
+    offset += size;
+  }
+  for (auto& channel : this->channels_) {
+    channel.size = channel.owned_times.size();
+    channel.times = channel.owned_times.data();
+    channel.offsets = channel.owned_offsets.data();
+  }
+}
+
+const StateLogReader::Channel& StateLogReader::get_channel(uint16_t channel) const {
+  if (channel >= this->channels_.size()) {
+    throw exceptions::InvalidParameterException(
+        "Channel " + std::to_string(channel) + " of the state log does not exist");
+  }
+  return this->channels_[channel];
+}
+
+bool StateLogReader::is_indexed() const {
+  return this->indexed_;
+}
+
+uint16_t StateLogReader::get_number_of_channels() const {
+  return static_cast<uint16_t>(this->channels_.size());
+}
+
+const std::string& StateLogReader::get_channel_name(uint16_t channel) const {
+  return this->get_channel(channel).name;
+}
+
+uint16_t StateLogReader::find_channel(const std::string& name) const {
+  for (std::size_t c = 0; c < this->channels_.size(); ++c) {
+    if (this->channels_[c].name == name) {
+      return static_cast<uint16_t>(c);
+    }
+  }
+  throw exceptions::InvalidParameterException("Channel " + name + " does not exist in the state log");
+}
+
+std::size_t StateLogReader::get_size(uint16_t channel) const {
+  return this->get_channel(channel).size;
+}
+
+std::chrono::nanoseconds StateLogReader::get_time(uint16_t channel, std::size_t index) const {
+  const Channel& log_channel = this->get_channel(channel);
+  if (index >= log_channel.size) {
+    throw exceptions::InvalidParameterException(
+        "Index " + std::to_string(index) + " is out of range of channel " + log_channel.name);
+  }
+  return std::chrono::nanoseconds(log_channel.times[index]);
+}
+
+std::ptrdiff_t StateLogReader::find_index(uint16_t channel, const std::chrono::nanoseconds& time) const {
+  const Channel& log_channel = this->get_channel(channel);
+  auto it = std::upper_bound(log_channel.times, log_channel.times + log_channel.size, time.count());
+  return std::distance(log_channel.times, it) - 1;
+}
+
+const uint8_t* StateLogReader::get_message(uint16_t channel, std::size_t index, std::size_t& size) const {
+  const Channel& log_channel = this->get_channel(channel);
+  if (index >= log_channel.size) {
+    throw exceptions::InvalidParameterException(
+        "Index " + std::to_string(index) + " is out of range of channel " + log_channel.name);
+  }
+  std::size_t offset = log_channel.offsets[index];
+  if (offset + RECORD_HEADER_SIZE > this->size_) {
+    throw exceptions::SerializationException("The index of the state log is corrupted");
+  }
+  size = load_record_header(this->data_ + offset).payload_size;
+  if (offset + RECORD_HEADER_SIZE + size > this->size_) {
+    throw exceptions::SerializationException("The index of the state log is corrupted");
+  }
+  return this->data_ + offset + RECORD_HEADER_SIZE;
+}
+}// namespace state_representation::serialization
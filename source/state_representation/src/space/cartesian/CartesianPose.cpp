@@ -107,7 +107,7 @@ CartesianPose CartesianPose::operator-(const CartesianPose& pose) const {
 
 CartesianTwist CartesianPose::operator/(const std::chrono::nanoseconds& dt) const {
   // sanity check
-  if (this->is_empty()) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
     throw EmptyStateException(this->get_name() + " state is empty");
   }
   // operations
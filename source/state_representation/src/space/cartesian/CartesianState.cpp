@@ -48,7 +48,7 @@ CartesianState CartesianState::Random(const std::string& name, const std::string
 
 CartesianState& CartesianState::operator*=(double lambda) {
   // sanity check
-  if (this->is_empty()) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
     throw EmptyStateException(this->get_name() + " state is empty");
   }
   // operation
@@ -85,13 +85,13 @@ Eigen::ArrayXd CartesianState::array() const {
 
 CartesianState& CartesianState::operator*=(const CartesianState& state) {
   // sanity check
-  if (this->is_empty()) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
     throw EmptyStateException(this->get_name() + " state is empty");
   }
-  if (state.is_empty()) {
+  if (CHECKED_OPERATIONS && state.is_empty()) {
     throw EmptyStateException(state.get_name() + " state is empty");
   }
-  if (this->get_name() != state.get_reference_frame()) {
+  if (CHECKED_OPERATIONS && this->get_name() != state.get_reference_frame()) {
     throw IncompatibleReferenceFramesException("Expected " + this->get_name() + ", got " + state.get_reference_frame());
   }
   this->set_name(state.get_name());
@@ -135,13 +135,13 @@ CartesianState CartesianState::operator*(const CartesianState& state) const {
 
 CartesianState& CartesianState::operator+=(const CartesianState& state) {
   // sanity check
-  if (this->is_empty()) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
     throw EmptyStateException(this->get_name() + " state is empty");
   }
-  if (state.is_empty()) {
+  if (CHECKED_OPERATIONS && state.is_empty()) {
     throw EmptyStateException(state.get_name() + " state is empty");
   }
-  if (!(this->get_reference_frame() == state.get_reference_frame())) {
+  if (CHECKED_OPERATIONS && !(this->get_reference_frame() == state.get_reference_frame())) {
     throw IncompatibleReferenceFramesException("The two states do not have the same reference frame");
   }
   // operation on pose
@@ -167,13 +167,13 @@ CartesianState CartesianState::operator+(const CartesianState& state) const {
 
 CartesianState& CartesianState::operator-=(const CartesianState& state) {
   // sanity check
-  if (this->is_empty()) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
     throw EmptyStateException(this->get_name() + " state is empty");
   }
-  if (state.is_empty()) {
+  if (CHECKED_OPERATIONS && state.is_empty()) {
     throw EmptyStateException(state.get_name() + " state is empty");
   }
-  if (!(this->get_reference_frame() == state.get_reference_frame())) {
+  if (CHECKED_OPERATIONS && !(this->get_reference_frame() == state.get_reference_frame())) {
     throw IncompatibleReferenceFramesException("The two states do not have the same reference frame");
   }
   // operation on pose
@@ -245,13 +245,13 @@ void CartesianState::clamp_state_variable(double max_value,
 
 double CartesianState::dist(const CartesianState& state, const CartesianStateVariable& state_variable_type) const {
   // sanity check
-  if (this->is_empty()) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
     throw EmptyStateException(this->get_name() + " state is empty");
   }
-  if (state.is_empty()) {
+  if (CHECKED_OPERATIONS && state.is_empty()) {
     throw EmptyStateException(state.get_name() + " state is empty");
   }
-  if (!(this->get_reference_frame() == state.get_reference_frame())) {
+  if (CHECKED_OPERATIONS && !(this->get_reference_frame() == state.get_reference_frame())) {
     throw IncompatibleReferenceFramesException("The two states do not have the same reference frame");
   }
   // calculation
@@ -262,10 +262,7 @@ double CartesianState::dist(const CartesianState& state, const CartesianStateVar
   }
   if (state_variable_type == CartesianStateVariable::ORIENTATION || state_variable_type == CartesianStateVariable::POSE
       || state_variable_type == CartesianStateVariable::ALL) {
-    // https://math.stackexchange.com/questions/90081/quaternion-distance for orientation
-    double inner_product = this->get_orientation().dot(state.get_orientation());
-    double argument = 2 * inner_product * inner_product - 1;
-    result += acos(std::min(1.0, std::max(-1.0, argument)));
+    result += math_tools::distance(this->get_orientation(), state.get_orientation());
   }
   if (state_variable_type == CartesianStateVariable::LINEAR_VELOCITY
       || state_variable_type == CartesianStateVariable::TWIST || state_variable_type == CartesianStateVariable::ALL) {
@@ -0,0 +1,37 @@
+#include "state_representation/space/cartesian/CartesianStateView.hpp"
+
+namespace state_representation {
+CartesianStateView::CartesianStateView(const double* data) :
+    pose_(data), twist_(data + 7), accelerations_(data + 13), wrench_(data + 19) {}
+
+CartesianStateView::CartesianStateView(const double* pose,
+                                       const double* twist,
+                                       const double* accelerations,
+                                       const double* wrench) :
+    pose_(pose), twist_(twist), accelerations_(accelerations), wrench_(wrench) {}
+
+bool CartesianStateView::has_state_variable(const CartesianStateVariable& state_variable_type) const {
+  switch (state_variable_type) {
+    case CartesianStateVariable::POSE:
+      return this->pose_.data() != nullptr;
+    case CartesianStateVariable::TWIST:
+      return this->twist_.data() != nullptr;
+    case CartesianStateVariable::ACCELERATIONS:
+      return this->accelerations_.data() != nullptr;
+    case CartesianStateVariable::WRENCH:
+      return this->wrench_.data() != nullptr;
+    default:
+      return false;
+  }
+}
+
+void CartesianStateView::copy_to(CartesianState& state) const {
+  // the setters take fixed-size vectors such that the conversions from the views stay on the stack
+  if (this->has_state_variable(CartesianStateVariable::POSE)) { state.set_pose(this->pose_); }
+  if (this->has_state_variable(CartesianStateVariable::TWIST)) { state.set_twist(this->twist_); }
+  if (this->has_state_variable(CartesianStateVariable::ACCELERATIONS)) {
+    state.set_accelerations(this->accelerations_);
+  }
+  if (this->has_state_variable(CartesianStateVariable::WRENCH)) { state.set_wrench(this->wrench_); }
+}
+}// namespace state_representation
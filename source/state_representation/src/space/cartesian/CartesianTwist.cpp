@@ -103,7 +103,7 @@ CartesianTwist CartesianTwist::operator*(double lambda) const {
 
 CartesianTwist& CartesianTwist::operator*=(const Eigen::Matrix<double, 6, 6>& lambda) {
   // sanity check
-  if (this->is_empty()) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
     throw EmptyStateException(this->get_name() + " state is empty");
   }
   // operation
@@ -114,7 +114,7 @@ CartesianTwist& CartesianTwist::operator*=(const Eigen::Matrix<double, 6, 6>& la
 
 CartesianPose CartesianTwist::operator*(const std::chrono::nanoseconds& dt) const {
   // sanity check
-  if (this->is_empty()) {
+  if (CHECKED_OPERATIONS && this->is_empty()) {
     throw EmptyStateException(this->get_name() + " state is empty");
   }
   // operations
@@ -145,6 +145,16 @@ void CartesianTwist::clamp(double max_linear,
   this->clamp_state_variable(max_angular, CartesianStateVariable::ANGULAR_VELOCITY, angular_noise_ratio);
 }
 
+void CartesianTwist::clamp(const units::LinearVelocity& max_linear,
+                           const units::AngularVelocity& max_angular,
+                           double linear_noise_ratio,
+                           double angular_noise_ratio) {
+  this->clamp(max_linear.get_value(),
+              max_angular.get_value(),
+              linear_noise_ratio,
+              angular_noise_ratio);
+}
+
 CartesianTwist CartesianTwist::clamped(double max_linear,
                                        double max_angular,
                                        double linear_noise_ratio,
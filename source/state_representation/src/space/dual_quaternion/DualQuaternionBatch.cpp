@@ -0,0 +1,218 @@
+#include "state_representation/space/dual_quaternion/DualQuaternionBatch.hpp"
+
+#include <cmath>
+
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+namespace {
+/**
+ * @brief Components of a single dual quaternion, primary part r and dual part d
+ */
+struct DualQuaternion {
+  double rw, rx, ry, rz, dw, dx, dy, dz;
+};
+
+inline DualQuaternion load(const Eigen::Matrix<double, Eigen::Dynamic, 8>& data, Eigen::Index i) {
+  return {data(i, 0), data(i, 1), data(i, 2), data(i, 3), data(i, 4), data(i, 5), data(i, 6), data(i, 7)};
+}
+
+inline void store(const DualQuaternion& q, Eigen::Matrix<double, Eigen::Dynamic, 8>& data, Eigen::Index i) {
+  data(i, 0) = q.rw;
+  data(i, 1) = q.rx;
+  data(i, 2) = q.ry;
+  data(i, 3) = q.rz;
+  data(i, 4) = q.dw;
+  data(i, 5) = q.dx;
+  data(i, 6) = q.dy;
+  data(i, 7) = q.dz;
+}
+
+inline DualQuaternion product(const DualQuaternion& p, const DualQuaternion& q) {
+  // (rp, dp) * (rq, dq) = (rp * rq, rp * dq + dp * rq)
+  return {
+      p.rw * q.rw - p.rx * q.rx - p.ry * q.ry - p.rz * q.rz,
+      p.rw * q.rx + p.rx * q.rw + p.ry * q.rz - p.rz * q.ry,
+      p.rw * q.ry - p.rx * q.rz + p.ry * q.rw + p.rz * q.rx,
+      p.rw * q.rz + p.rx * q.ry - p.ry * q.rx + p.rz * q.rw,
+      p.rw * q.dw - p.rx * q.dx - p.ry * q.dy - p.rz * q.dz + p.dw * q.rw - p.dx * q.rx - p.dy * q.ry - p.dz * q.rz,
+      p.rw * q.dx + p.rx * q.dw + p.ry * q.dz - p.rz * q.dy + p.dw * q.rx + p.dx * q.rw + p.dy * q.rz - p.dz * q.ry,
+      p.rw * q.dy - p.rx * q.dz + p.ry * q.dw + p.rz * q.dx + p.dw * q.ry - p.dx * q.rz + p.dy * q.rw + p.dz * q.rx,
+      p.rw * q.dz + p.rx * q.dy - p.ry * q.dx + p.rz * q.dw + p.dw * q.rz + p.dx * q.ry - p.dy * q.rx + p.dz * q.rw
+  };
+}
+
+inline DualQuaternion conjugate_of(const DualQuaternion& q) {
+  return {q.rw, -q.rx, -q.ry, -q.rz, q.dw, -q.dx, -q.dy, -q.dz};
+}
+
+/**
+ * @brief Raise a unit dual quaternion to a real power through its screw parameters: the rotation angle theta
+ * around the axis l, the translation distance along the axis and the moment m of the axis
+ */
+inline DualQuaternion power(const DualQuaternion& q, double t) {
+  double s = std::sqrt(q.rx * q.rx + q.ry * q.ry + q.rz * q.rz);
+  if (s < 1e-12) {
+    // pure translation, the dual part is half the translation
+    return {1, 0, 0, 0, t * q.dw, t * q.dx, t * q.dy, t * q.dz};
+  }
+  double half_angle = std::atan2(s, q.rw);
+  double lx = q.rx / s, ly = q.ry / s, lz = q.rz / s;
+  double half_distance = -q.dw / s;
+  double mx = (q.dx - half_distance * q.rw * lx) / s;
+  double my = (q.dy - half_distance * q.rw * ly) / s;
+  double mz = (q.dz - half_distance * q.rw * lz) / s;
+  double st = std::sin(t * half_angle), ct = std::cos(t * half_angle);
+  half_distance *= t;
+  return {
+      ct, st * lx, st * ly, st * lz,
+      -half_distance * st, st * mx + half_distance * ct * lx, st * my + half_distance * ct * ly,
+      st * mz + half_distance * ct * lz
+  };
+}
+
+void assert_same_size(const DualQuaternionBatch& lhs, const DualQuaternionBatch& rhs) {
+  if (lhs.get_size() != rhs.get_size()) {
+    throw exceptions::IncompatibleSizeException("The batches of dual quaternions are of different sizes "
+                                                    + std::to_string(lhs.get_size()) + " and "
+                                                    + std::to_string(rhs.get_size()));
+  }
+}
+}// namespace
+
+DualQuaternionBatch::DualQuaternionBatch(std::size_t size) {
+  this->resize(size);
+}
+
+DualQuaternionBatch::DualQuaternionBatch(const std::vector<CartesianPose>& poses) :
+    DualQuaternionBatch(poses.size()) {
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    this->set(i, poses[i]);
+  }
+}
+
+void DualQuaternionBatch::resize(std::size_t size) {
+  auto previous_size = this->data_.rows();
+  this->data_.conservativeResize(static_cast<Eigen::Index>(size), Eigen::NoChange);
+  if (this->data_.rows() > previous_size) {
+    auto added = this->data_.bottomRows(this->data_.rows() - previous_size);
+    added.setZero();
+    added.col(0).setOnes();
+  }
+}
+
+void DualQuaternionBatch::set(std::size_t index, const Eigen::Vector3d& position,
+                              const Eigen::Quaterniond& orientation) {
+  Eigen::Quaterniond primary = orientation.normalized();
+  Eigen::Quaterniond dual(0.5 * (Eigen::Quaterniond(0, position(0), position(1), position(2)) * primary).coeffs());
+  auto i = static_cast<Eigen::Index>(index);
+  this->data_.row(i) << primary.w(), primary.x(), primary.y(), primary.z(), dual.w(), dual.x(), dual.y(), dual.z();
+}
+
+void DualQuaternionBatch::set(std::size_t index, const CartesianPose& pose) {
+  this->set(index, pose.get_position(), pose.get_orientation());
+}
+
+void DualQuaternionBatch::set_joint_motion(std::size_t index, const Eigen::Vector3d& axis, double position,
+                                           bool prismatic) {
+  auto i = static_cast<Eigen::Index>(index);
+  double half_position = 0.5 * position;
+  if (prismatic) {
+    this->data_.row(i) << 1, 0, 0, 0, 0, half_position * axis(0), half_position * axis(1), half_position * axis(2);
+  } else {
+    double sine = std::sin(half_position);
+    this->data_.row(i) << std::cos(half_position), sine * axis(0), sine * axis(1), sine * axis(2), 0, 0, 0, 0;
+  }
+}
+
+Eigen::Quaterniond DualQuaternionBatch::get_primary(std::size_t index) const {
+  auto i = static_cast<Eigen::Index>(index);
+  return Eigen::Quaterniond(this->data_(i, 0), this->data_(i, 1), this->data_(i, 2), this->data_(i, 3));
+}
+
+Eigen::Quaterniond DualQuaternionBatch::get_dual(std::size_t index) const {
+  auto i = static_cast<Eigen::Index>(index);
+  return Eigen::Quaterniond(this->data_(i, 4), this->data_(i, 5), this->data_(i, 6), this->data_(i, 7));
+}
+
+Eigen::Vector3d DualQuaternionBatch::get_position(std::size_t index) const {
+  return 2 * (this->get_dual(index) * this->get_primary(index).conjugate()).vec();
+}
+
+void DualQuaternionBatch::get_pose(std::size_t index, CartesianPose& pose) const {
+  pose.set_position(this->get_position(index));
+  pose.set_orientation(this->get_primary(index));
+}
+
+void DualQuaternionBatch::to_poses(std::vector<CartesianPose>& poses) const {
+  if (poses.size() != this->get_size()) {
+    throw exceptions::IncompatibleSizeException("Expected " + std::to_string(this->get_size()) + " poses, got "
+                                                    + std::to_string(poses.size()));
+  }
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    this->get_pose(i, poses[i]);
+  }
+}
+
+void DualQuaternionBatch::multiply(const DualQuaternionBatch& lhs, const DualQuaternionBatch& rhs,
+                                   DualQuaternionBatch& result) {
+  assert_same_size(lhs, rhs);
+  result.data_.resize(lhs.data_.rows(), Eigen::NoChange);
+  for (Eigen::Index i = 0; i < lhs.data_.rows(); ++i) {
+    store(product(load(lhs.data_, i), load(rhs.data_, i)), result.data_, i);
+  }
+}
+
+void DualQuaternionBatch::conjugate(const DualQuaternionBatch& batch, DualQuaternionBatch& result) {
+  result.data_.resize(batch.data_.rows(), Eigen::NoChange);
+  for (Eigen::Index i = 0; i < batch.data_.rows(); ++i) {
+    store(conjugate_of(load(batch.data_, i)), result.data_, i);
+  }
+}
+
+void DualQuaternionBatch::sclerp(const DualQuaternionBatch& start, const DualQuaternionBatch& end, double t,
+                                 DualQuaternionBatch& result) {
+  assert_same_size(start, end);
+  result.data_.resize(start.data_.rows(), Eigen::NoChange);
+  for (Eigen::Index i = 0; i < start.data_.rows(); ++i) {
+    DualQuaternion a = load(start.data_, i);
+    // start * (start^-1 * end)^t, taking the shortest path of the double cover
+    DualQuaternion d = product(conjugate_of(a), load(end.data_, i));
+    if (d.rw < 0) {
+      d = {-d.rw, -d.rx, -d.ry, -d.rz, -d.dw, -d.dx, -d.dy, -d.dz};
+    }
+    store(product(a, power(d, t)), result.data_, i);
+  }
+}
+
+void DualQuaternionBatch::chain(const DualQuaternionBatch& batch, DualQuaternionBatch& result) {
+  result.data_.resize(batch.data_.rows(), Eigen::NoChange);
+  if (batch.data_.rows() == 0) {
+    return;
+  }
+  DualQuaternion accumulated = load(batch.data_, 0);
+  store(accumulated, result.data_, 0);
+  for (Eigen::Index i = 1; i < batch.data_.rows(); ++i) {
+    accumulated = product(accumulated, load(batch.data_, i));
+    store(accumulated, result.data_, i);
+  }
+}
+
+void DualQuaternionBatch::chain(const DualQuaternionBatch& batch, const std::vector<int>& parents,
+                                DualQuaternionBatch& result) {
+  if (parents.size() != batch.get_size()) {
+    throw exceptions::IncompatibleSizeException("Expected " + std::to_string(batch.get_size()) + " parents, got "
+                                                    + std::to_string(parents.size()));
+  }
+  result.data_.resize(batch.data_.rows(), Eigen::NoChange);
+  for (Eigen::Index i = 0; i < batch.data_.rows(); ++i) {
+    int parent = parents[i];
+    if (parent >= i) {
+      throw exceptions::InvalidParameterException("The parent of link " + std::to_string(i) + " has to precede it");
+    }
+    store(parent < 0 ? load(batch.data_, i) : product(load(result.data_, parent), load(batch.data_, i)),
+          result.data_, i);
+  }
+}
+}// namespace state_representation
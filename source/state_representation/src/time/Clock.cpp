@@ -0,0 +1,61 @@
+#include "state_representation/time/Clock.hpp"
+
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace state_representation {
+SimulatedClock::SimulatedClock(const time_point& start) :
+    time_(std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count()) {}
+
+Clock::time_point SimulatedClock::step(const std::chrono::nanoseconds& period) {
+  int64_t time = this->time_.fetch_add(period.count(), std::memory_order_acq_rel) + period.count();
+  return time_point(std::chrono::nanoseconds(time));
+}
+
+void SimulatedClock::set_time(const time_point& time) {
+  this->time_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count(),
+                    std::memory_order_release);
+}
+
+SharedMemoryClock::SharedMemoryClock(const std::atomic<uint64_t>* ticks, const std::chrono::nanoseconds& period) :
+    ticks_(ticks), period_(period), mapping_(nullptr), mapping_size_(0) {
+  if (ticks == nullptr) {
+    throw exceptions::InvalidParameterException("The counter of ticks is not set");
+  }
+}
+
+SharedMemoryClock::SharedMemoryClock(const std::string& name,
+                                     const std::chrono::nanoseconds& period,
+                                     std::size_t offset) :
+    ticks_(nullptr), period_(period), mapping_(nullptr), mapping_size_(offset + sizeof(std::atomic<uint64_t>)) {
+  if (offset % alignof(std::atomic<uint64_t>) != 0) {
+    throw exceptions::InvalidParameterException("The offset of the counter of ticks is not aligned");
+  }
+  int descriptor = ::shm_open(name.c_str(), O_RDONLY, 0);
+  if (descriptor < 0) {
+    throw exceptions::InvalidParameterException("Failed to open the shared memory " + name);
+  }
+  struct stat status{};
+  if (::fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) < this->mapping_size_) {
+    ::close(descriptor);
+    throw exceptions::InvalidParameterException("The shared memory " + name + " is too small for the counter of ticks");
+  }
+  void* data = ::mmap(nullptr, this->mapping_size_, PROT_READ, MAP_SHARED, descriptor, 0);
+  ::close(descriptor);
+  if (data == MAP_FAILED) {
+    throw exceptions::InvalidParameterException("Failed to map the shared memory " + name);
+  }
+  this->mapping_ = data;
+  this->ticks_ = reinterpret_cast<const std::atomic<uint64_t>*>(static_cast<const char*>(data) + offset);
+}
+
+SharedMemoryClock::~SharedMemoryClock() {
+  if (this->mapping_ != nullptr) {
+    ::munmap(this->mapping_, this->mapping_size_);
+  }
+}
+}// namespace state_representation
@@ -0,0 +1,224 @@
+#include "state_representation/trajectories/CartesianSpline.hpp"
+
+#include <algorithm>
+
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+static double to_seconds(const std::chrono::nanoseconds& time) {
+  return std::chrono::duration<double>(time).count();
+}
+
+static std::chrono::nanoseconds to_nanoseconds(double time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(time));
+}
+
+/**
+ * @brief Angular velocity rotating the first orientation into the second one in the given time
+ */
+static Eigen::Vector3d angular_velocity(const Eigen::Quaterniond& q1, const Eigen::Quaterniond& q2, double dt) {
+  Eigen::Quaterniond difference = q2 * q1.conjugate();
+  if (difference.w() < 0) {
+    difference.coeffs() = -difference.coeffs();
+  }
+  // the rotation vector is computed from the vector part to keep its accuracy for small rotations
+  double sin_half_angle = difference.vec().norm();
+  if (sin_half_angle < 1e-12) {
+    return difference.vec() * 2 / dt;
+  }
+  return difference.vec() / sin_half_angle * 2 * std::atan2(sin_half_angle, difference.w()) / dt;
+}
+
+CartesianSpline::CartesianSpline(const Trajectory<CartesianPose>& trajectory) {
+  if (trajectory.get_size() < 2) {
+    throw exceptions::InvalidParameterException("A spline requires at least two points");
+  }
+  const auto& points = trajectory.get_points();
+  this->name_ = points.front().get_name();
+  this->reference_frame_ = points.front().get_reference_frame();
+  Eigen::VectorXd times(points.size());
+  Eigen::MatrixXd positions(3, points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (points[i].get_reference_frame() != this->reference_frame_) {
+      throw exceptions::IncompatibleReferenceFramesException("The points of the spline are not expressed in the same reference frame");
+    }
+    times(i) = to_seconds(trajectory.get_times()[i]);
+    positions.col(i) = points[i].get_position();
+    this->orientations_.push_back(points[i].get_orientation());
+  }
+  this->position_spline_ = CubicSpline(times, positions);
+  this->compute_controls();
+}
+
+CartesianSpline::CartesianSpline(const std::vector<CartesianPose>& waypoints,
+                                 double max_linear_velocity,
+                                 double max_linear_acceleration,
+                                 double max_angular_velocity,
+                                 double max_angular_acceleration) {
+  if (waypoints.size() < 2) {
+    throw exceptions::InvalidParameterException("A spline requires at least two points");
+  }
+  if (max_linear_velocity <= 0 || max_linear_acceleration <= 0 || max_angular_velocity <= 0
+      || max_angular_acceleration <= 0) {
+    throw exceptions::InvalidParameterException("The limits have to be strictly positive");
+  }
+  this->name_ = waypoints.front().get_name();
+  this->reference_frame_ = waypoints.front().get_reference_frame();
+  Eigen::VectorXd times(waypoints.size());
+  Eigen::MatrixXd positions(3, waypoints.size());
+  for (std::size_t i = 0; i < waypoints.size(); ++i) {
+    if (waypoints[i].get_reference_frame() != this->reference_frame_) {
+      throw exceptions::IncompatibleReferenceFramesException("The points of the spline are not expressed in the same reference frame");
+    }
+    positions.col(i) = waypoints[i].get_position();
+    this->orientations_.push_back(waypoints[i].get_orientation());
+    if (i == 0) {
+      times(i) = 0;
+      continue;
+    }
+    // duration of a rest to rest bang-bang profile of the slowest of the translation and rotation
+    double distance = (positions.col(i) - positions.col(i - 1)).cwiseAbs().maxCoeff();
+    double angle = this->orientations_[i].angularDistance(this->orientations_[i - 1]);
+    double duration = std::max({distance / max_linear_velocity, 2 * std::sqrt(distance / max_linear_acceleration),
+                                angle / max_angular_velocity, 2 * std::sqrt(angle / max_angular_acceleration)});
+    times(i) = times(i - 1) + std::max(duration, 1e-6);
+  }
+  this->position_spline_ = CubicSpline(times, positions);
+  this->compute_controls();
+  this->retime(max_linear_velocity, max_linear_acceleration, max_angular_velocity, max_angular_acceleration);
+}
+
+void CartesianSpline::compute_controls() {
+  // keep consecutive orientations in the same hemisphere to interpolate along the shortest path
+  for (std::size_t i = 1; i < this->orientations_.size(); ++i) {
+    if (this->orientations_[i].dot(this->orientations_[i - 1]) < 0) {
+      this->orientations_[i].coeffs() = -this->orientations_[i].coeffs();
+    }
+  }
+  // s_i = q_i * exp(-(log(q_i^-1 * q_i+1) + log(q_i^-1 * q_i-1)) / 4), the ends being their own control points
+  std::size_t nb_knots = this->orientations_.size();
+  this->controls_ = this->orientations_;
+  for (std::size_t i = 1; i + 1 < nb_knots; ++i) {
+    Eigen::Quaterniond inverse = this->orientations_[i].conjugate();
+    Eigen::Quaterniond tangent(0, 0, 0, 0);
+    tangent.vec() = math_tools::log(inverse * this->orientations_[i + 1]).vec()
+        + math_tools::log(inverse * this->orientations_[i - 1]).vec();
+    this->controls_[i] = this->orientations_[i] * math_tools::exp(tangent, -0.25);
+  }
+}
+
+Eigen::Quaterniond CartesianSpline::interpolate_orientation(double time) const {
+  const Eigen::VectorXd& times = this->position_spline_.get_times();
+  Eigen::Index last = times.size() - 1;
+  if (time <= times(0)) {
+    return this->orientations_.front();
+  }
+  if (time >= times(last)) {
+    return this->orientations_.back();
+  }
+  auto it = std::upper_bound(times.data(), times.data() + last, time);
+  Eigen::Index i = std::distance(times.data(), it) - 1;
+  double u = (time - times(i)) / (times(i + 1) - times(i));
+  Eigen::Quaterniond path = this->orientations_[i].slerp(u, this->orientations_[i + 1]);
+  Eigen::Quaterniond control = this->controls_[i].slerp(u, this->controls_[i + 1]);
+  return path.slerp(2 * u * (1 - u), control);
+}
+
+std::pair<double, double> CartesianSpline::max_angular_velocity_and_acceleration() const {
+  const unsigned int nb_samples = 16;
+  const Eigen::VectorXd& times = this->position_spline_.get_times();
+  double max_velocity = 0;
+  double max_acceleration = 0;
+  for (Eigen::Index i = 0; i + 1 < times.size(); ++i) {
+    double dt = (times(i + 1) - times(i)) / nb_samples;
+    Eigen::Quaterniond previous = this->interpolate_orientation(times(i));
+    // the velocity before the segment is sampled on the previous segment, or on the segment itself for the first knot
+    // as the orientation does not start at rest
+    Eigen::Vector3d previous_velocity =
+        i == 0 ? angular_velocity(previous, this->interpolate_orientation(times(i) + dt), dt)
+               : angular_velocity(this->interpolate_orientation(times(i) - dt), previous, dt);
+    for (unsigned int k = 1; k <= nb_samples; ++k) {
+      Eigen::Quaterniond current = this->interpolate_orientation(times(i) + k * dt);
+      Eigen::Vector3d velocity = angular_velocity(previous, current, dt);
+      max_velocity = std::max(max_velocity, velocity.norm());
+      max_acceleration = std::max(max_acceleration, (velocity - previous_velocity).norm() / dt);
+      previous = current;
+      previous_velocity = velocity;
+    }
+  }
+  return {max_velocity, max_acceleration};
+}
+
+std::chrono::nanoseconds CartesianSpline::get_start_time() const {
+  const Eigen::VectorXd& times = this->position_spline_.get_times();
+  return to_nanoseconds(times.size() ? times(0) : 0.);
+}
+
+std::chrono::nanoseconds CartesianSpline::get_duration() const {
+  return to_nanoseconds(this->position_spline_.get_duration());
+}
+
+double CartesianSpline::retime(double max_linear_velocity,
+                               double max_linear_acceleration,
+                               double max_angular_velocity,
+                               double max_angular_acceleration) {
+  auto [angular_velocity, angular_acceleration] = this->max_angular_velocity_and_acceleration();
+  double factor = std::max({this->position_spline_.max_velocities().maxCoeff() / max_linear_velocity,
+                            std::sqrt(this->position_spline_.max_accelerations().maxCoeff() / max_linear_acceleration),
+                            angular_velocity / max_angular_velocity,
+                            std::sqrt(angular_acceleration / max_angular_acceleration)});
+  if (factor > 0) {
+    this->position_spline_.scale_time(factor);
+  }
+  return factor;
+}
+
+CartesianState CartesianSpline::sample(const std::chrono::nanoseconds& time) const {
+  double t = to_seconds(time);
+  CartesianState result(this->name_, this->reference_frame_);
+  result.set_position(Eigen::Vector3d(this->position_spline_.evaluate(t, 0)));
+  Eigen::Quaterniond orientation = this->interpolate_orientation(t);
+  result.set_orientation(orientation);
+  result.set_linear_velocity(Eigen::Vector3d(this->position_spline_.evaluate(t, 1)));
+  result.set_linear_acceleration(Eigen::Vector3d(this->position_spline_.evaluate(t, 2)));
+  // the angular velocity is differentiated numerically on the interpolated orientations, one sided at the ends
+  const Eigen::VectorXd& times = this->position_spline_.get_times();
+  double start = times(0);
+  double end = times(times.size() - 1);
+  if (t >= start && t <= end) {
+    double before = std::max(t - 1e-6, start);
+    double after = std::min(t + 1e-6, end);
+    result.set_angular_velocity(angular_velocity(this->interpolate_orientation(before),
+                                                 this->interpolate_orientation(after), after - before));
+  }
+  return result;
+}
+
+Eigen::MatrixXd CartesianSpline::sample_uniformly(const std::chrono::nanoseconds& period) const {
+  Eigen::VectorXd times = this->position_spline_.get_uniform_times(to_seconds(period));
+  Eigen::MatrixXd poses(7, times.size());
+  poses.topRows(3) = this->position_spline_.evaluate(times);
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    Eigen::Quaterniond orientation = this->interpolate_orientation(times(i));
+    poses.col(i).tail<4>() << orientation.w(), orientation.x(), orientation.y(), orientation.z();
+  }
+  return poses;
+}
+
+Trajectory<CartesianPose> CartesianSpline::to_trajectory(const std::chrono::nanoseconds& period) const {
+  Eigen::VectorXd times = this->position_spline_.get_uniform_times(to_seconds(period));
+  Eigen::MatrixXd positions = this->position_spline_.evaluate(times);
+  Trajectory<CartesianPose> trajectory(this->name_);
+  trajectory.set_reference_frame(this->reference_frame_);
+  std::chrono::nanoseconds previous_time(0);
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    std::chrono::nanoseconds time = to_nanoseconds(times(i));
+    CartesianPose pose(this->name_, Eigen::Vector3d(positions.col(i)), this->interpolate_orientation(times(i)),
+                       this->reference_frame_);
+    trajectory.add_point(pose, time - previous_time);
+    previous_time = time;
+  }
+  return trajectory;
+}
+}// namespace state_representation
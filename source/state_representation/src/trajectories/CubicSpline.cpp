@@ -0,0 +1,201 @@
+#include "state_representation/trajectories/CubicSpline.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+CubicSpline::CubicSpline(const Eigen::VectorXd& times, const Eigen::MatrixXd& points,
+                         const Eigen::VectorXd& start_velocity, const Eigen::VectorXd& end_velocity) :
+    times_(times), points_(points) {
+  Eigen::Index nb_knots = times.size();
+  Eigen::Index dimension = points.rows();
+  if (nb_knots < 2) {
+    throw exceptions::InvalidParameterException("A spline requires at least two knots");
+  }
+  if (points.cols() != nb_knots) {
+    throw exceptions::IncompatibleSizeException("The number of points and times differ, got "
+                                                    + std::to_string(points.cols()) + " points and "
+                                                    + std::to_string(nb_knots) + " times");
+  }
+  for (Eigen::Index i = 1; i < nb_knots; ++i) {
+    if (times(i) <= times(i - 1)) {
+      throw exceptions::InvalidParameterException("The knot times of a spline have to be strictly increasing");
+    }
+  }
+  Eigen::VectorXd v0 = start_velocity.size() ? start_velocity : Eigen::VectorXd::Zero(dimension);
+  Eigen::VectorXd vn = end_velocity.size() ? end_velocity : Eigen::VectorXd::Zero(dimension);
+  if (v0.size() != dimension || vn.size() != dimension) {
+    throw exceptions::IncompatibleSizeException("The boundary velocities have to be of the dimension of the points");
+  }
+  // tridiagonal system of the clamped spline on the second derivatives, shared by all dimensions
+  Eigen::VectorXd h = times.tail(nb_knots - 1) - times.head(nb_knots - 1);
+  Eigen::VectorXd lower = Eigen::VectorXd::Zero(nb_knots);
+  Eigen::VectorXd diagonal(nb_knots);
+  Eigen::VectorXd upper = Eigen::VectorXd::Zero(nb_knots);
+  Eigen::MatrixXd rhs(dimension, nb_knots);
+  Eigen::MatrixXd slopes(dimension, nb_knots - 1);
+  for (Eigen::Index i = 0; i < nb_knots - 1; ++i) {
+    slopes.col(i) = (points.col(i + 1) - points.col(i)) / h(i);
+  }
+  diagonal(0) = 2 * h(0);
+  upper(0) = h(0);
+  rhs.col(0) = 6 * (slopes.col(0) - v0);
+  for (Eigen::Index i = 1; i < nb_knots - 1; ++i) {
+    lower(i) = h(i - 1);
+    diagonal(i) = 2 * (h(i - 1) + h(i));
+    upper(i) = h(i);
+    rhs.col(i) = 6 * (slopes.col(i) - slopes.col(i - 1));
+  }
+  lower(nb_knots - 1) = h(nb_knots - 2);
+  diagonal(nb_knots - 1) = 2 * h(nb_knots - 2);
+  rhs.col(nb_knots - 1) = 6 * (vn - slopes.col(nb_knots - 2));
+  // Thomas algorithm, the system is diagonally dominant
+  for (Eigen::Index i = 1; i < nb_knots; ++i) {
+    double w = lower(i) / diagonal(i - 1);
+    diagonal(i) -= w * upper(i - 1);
+    rhs.col(i) -= w * rhs.col(i - 1);
+  }
+  this->second_derivatives_.resize(dimension, nb_knots);
+  this->second_derivatives_.col(nb_knots - 1) = rhs.col(nb_knots - 1) / diagonal(nb_knots - 1);
+  for (Eigen::Index i = nb_knots - 2; i >= 0; --i) {
+    this->second_derivatives_.col(i) = (rhs.col(i) - upper(i) * this->second_derivatives_.col(i + 1)) / diagonal(i);
+  }
+}
+
+CubicSpline CubicSpline::from_waypoints(const Eigen::MatrixXd& points,
+                                        const Eigen::VectorXd& max_velocities,
+                                        const Eigen::VectorXd& max_accelerations) {
+  if (max_velocities.size() != points.rows() || max_accelerations.size() != points.rows()) {
+    throw exceptions::IncompatibleSizeException("The limits have to be of the dimension of the points");
+  }
+  if ((max_velocities.array() <= 0).any() || (max_accelerations.array() <= 0).any()) {
+    throw exceptions::InvalidParameterException("The limits have to be strictly positive");
+  }
+  Eigen::VectorXd times(points.cols());
+  if (points.cols()) {
+    times(0) = 0;
+  }
+  for (Eigen::Index i = 1; i < points.cols(); ++i) {
+    Eigen::ArrayXd distance = (points.col(i) - points.col(i - 1)).array().abs();
+    // duration of a rest to rest bang-bang profile of the slowest axis, and at least of a cruise at maximum velocity
+    double duration = std::max((distance / max_velocities.array()).maxCoeff(),
+                               (2 * (distance / max_accelerations.array()).sqrt()).maxCoeff());
+    times(i) = times(i - 1) + std::max(duration, 1e-6);
+  }
+  CubicSpline spline(times, points);
+  spline.retime(max_velocities, max_accelerations);
+  return spline;
+}
+
+Eigen::Index CubicSpline::find_segment(double time) const {
+  auto end = this->times_.data() + this->times_.size() - 1;
+  auto it = std::upper_bound(this->times_.data(), end, time);
+  return std::max<Eigen::Index>(std::distance(this->times_.data(), it) - 1, 0);
+}
+
+Eigen::VectorXd CubicSpline::evaluate(double time, unsigned int derivative) const {
+  if (derivative > 2) {
+    throw exceptions::InvalidParameterException("Only the first and second derivatives of a cubic spline are available");
+  }
+  if (this->times_.size() == 0) {
+    throw exceptions::EmptyStateException("The spline is empty");
+  }
+  Eigen::Index last = this->times_.size() - 1;
+  // the knots at both ends are evaluated on their segment to keep the boundary velocities and accelerations
+  if (time < this->times_(0) || time > this->times_(last)) {
+    if (derivative > 0) {
+      return Eigen::VectorXd::Zero(this->dimension());
+    }
+    return time < this->times_(0) ? this->points_.col(0) : this->points_.col(last);
+  }
+  Eigen::Index i = this->find_segment(time);
+  double h = this->times_(i + 1) - this->times_(i);
+  double a = this->times_(i + 1) - time;
+  double b = time - this->times_(i);
+  const auto& m0 = this->second_derivatives_.col(i);
+  const auto& m1 = this->second_derivatives_.col(i + 1);
+  const auto& p0 = this->points_.col(i);
+  const auto& p1 = this->points_.col(i + 1);
+  switch (derivative) {
+    case 0:
+      return (m0 * a * a * a + m1 * b * b * b) / (6 * h) + (p0 / h - m0 * h / 6) * a + (p1 / h - m1 * h / 6) * b;
+    case 1:
+      return (m1 * b * b - m0 * a * a) / (2 * h) + (p1 - p0) / h - (m1 - m0) * h / 6;
+    default:
+      return (m0 * a + m1 * b) / h;
+  }
+}
+
+Eigen::MatrixXd CubicSpline::evaluate(const Eigen::VectorXd& times, unsigned int derivative) const {
+  Eigen::MatrixXd values(this->dimension(), times.size());
+  for (Eigen::Index k = 0; k < times.size(); ++k) {
+    values.col(k) = this->evaluate(times(k), derivative);
+  }
+  return values;
+}
+
+Eigen::VectorXd CubicSpline::get_uniform_times(double period) const {
+  if (period <= 0) {
+    throw exceptions::InvalidParameterException("The period has to be strictly positive");
+  }
+  if (this->times_.size() == 0) {
+    return Eigen::VectorXd();
+  }
+  double duration = this->get_duration();
+  auto nb_periods = static_cast<Eigen::Index>(std::ceil(duration / period - 1e-9));
+  Eigen::VectorXd times = this->times_(0) + Eigen::ArrayXd::LinSpaced(nb_periods + 1, 0, nb_periods) * period;
+  times(nb_periods) = this->times_(this->times_.size() - 1);
+  return times;
+}
+
+Eigen::VectorXd CubicSpline::max_velocities() const {
+  Eigen::VectorXd maximum = Eigen::VectorXd::Zero(this->dimension());
+  for (Eigen::Index i = 0; i + 1 < this->times_.size(); ++i) {
+    double h = this->times_(i + 1) - this->times_(i);
+    for (Eigen::Index d = 0; d < this->dimension(); ++d) {
+      double m0 = this->second_derivatives_(d, i);
+      double m1 = this->second_derivatives_(d, i + 1);
+      double slope = (this->points_(d, i + 1) - this->points_(d, i)) / h;
+      // the velocity is quadratic on the segment, its extrema are at the ends or where the acceleration vanishes
+      double start = slope - (2 * m0 + m1) * h / 6;
+      double end = slope + (m0 + 2 * m1) * h / 6;
+      double extremum = std::max(std::abs(start), std::abs(end));
+      if (m0 * m1 < 0) {
+        double b = h * m0 / (m0 - m1);
+        double a = h - b;
+        extremum = std::max(extremum, std::abs((m1 * b * b - m0 * a * a) / (2 * h) + slope - (m1 - m0) * h / 6));
+      }
+      maximum(d) = std::max(maximum(d), extremum);
+    }
+  }
+  return maximum;
+}
+
+Eigen::VectorXd CubicSpline::max_accelerations() const {
+  return this->second_derivatives_.cwiseAbs().rowwise().maxCoeff();
+}
+
+void CubicSpline::scale_time(double factor) {
+  if (factor <= 0) {
+    throw exceptions::InvalidParameterException("The time scaling factor has to be strictly positive");
+  }
+  this->times_ = this->times_(0) + (this->times_.array() - this->times_(0)) * factor;
+  this->second_derivatives_ /= factor * factor;
+}
+
+double CubicSpline::retime(const Eigen::VectorXd& max_velocities, const Eigen::VectorXd& max_accelerations) {
+  if (max_velocities.size() != this->dimension() || max_accelerations.size() != this->dimension()) {
+    throw exceptions::IncompatibleSizeException("The limits have to be of the dimension of the points");
+  }
+  double factor = std::max((this->max_velocities().array() / max_velocities.array()).maxCoeff(),
+                           (this->max_accelerations().array() / max_accelerations.array()).sqrt().maxCoeff());
+  if (factor > 0) {
+    this->scale_time(factor);
+  }
+  return factor;
+}
+}// namespace state_representation
@@ -0,0 +1,89 @@
+#include "state_representation/trajectories/JointSpline.hpp"
+
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+static double to_seconds(const std::chrono::nanoseconds& time) {
+  return std::chrono::duration<double>(time).count();
+}
+
+static std::chrono::nanoseconds to_nanoseconds(double time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(time));
+}
+
+static Eigen::MatrixXd stack_positions(const std::deque<JointPositions>& points) {
+  if (points.size() < 2) {
+    throw exceptions::InvalidParameterException("A spline requires at least two points");
+  }
+  Eigen::MatrixXd positions(points.front().get_size(), points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (points[i].get_shared_names() != points.front().get_shared_names()) {
+      throw exceptions::IncompatibleStatesException("The points of the spline do not have the same joints");
+    }
+    positions.col(i) = points[i].get_positions();
+  }
+  return positions;
+}
+
+JointSpline::JointSpline() : joint_names_(joint_names::intern(0)) {}
+
+JointSpline::JointSpline(const Trajectory<JointPositions>& trajectory) {
+  Eigen::MatrixXd positions = stack_positions(trajectory.get_points());
+  Eigen::VectorXd times(trajectory.get_size());
+  for (int i = 0; i < trajectory.get_size(); ++i) {
+    times(i) = to_seconds(trajectory.get_times()[i]);
+  }
+  this->name_ = trajectory.get_points().front().get_name();
+  this->joint_names_ = trajectory.get_points().front().get_shared_names();
+  this->spline_ = CubicSpline(times, positions);
+}
+
+JointSpline::JointSpline(const std::vector<JointPositions>& waypoints,
+                         const Eigen::VectorXd& max_velocities,
+                         const Eigen::VectorXd& max_accelerations) {
+  Eigen::MatrixXd positions = stack_positions(std::deque<JointPositions>(waypoints.begin(), waypoints.end()));
+  this->name_ = waypoints.front().get_name();
+  this->joint_names_ = waypoints.front().get_shared_names();
+  this->spline_ = CubicSpline::from_waypoints(positions, max_velocities, max_accelerations);
+}
+
+std::chrono::nanoseconds JointSpline::get_start_time() const {
+  return to_nanoseconds(this->spline_.get_times().size() ? this->spline_.get_times()(0) : 0.);
+}
+
+std::chrono::nanoseconds JointSpline::get_duration() const {
+  return to_nanoseconds(this->spline_.get_duration());
+}
+
+double JointSpline::retime(const Eigen::VectorXd& max_velocities, const Eigen::VectorXd& max_accelerations) {
+  return this->spline_.retime(max_velocities, max_accelerations);
+}
+
+JointState JointSpline::sample(const std::chrono::nanoseconds& time) const {
+  double t = to_seconds(time);
+  JointState result(this->name_, this->joint_names_);
+  result.set_positions(this->spline_.evaluate(t, 0));
+  result.set_velocities(this->spline_.evaluate(t, 1));
+  result.set_accelerations(this->spline_.evaluate(t, 2));
+  return result;
+}
+
+Eigen::MatrixXd JointSpline::sample_uniformly(const std::chrono::nanoseconds& period, unsigned int derivative) const {
+  return this->spline_.evaluate(this->spline_.get_uniform_times(to_seconds(period)), derivative);
+}
+
+Trajectory<JointPositions> JointSpline::to_trajectory(const std::chrono::nanoseconds& period) const {
+  Eigen::VectorXd times = this->spline_.get_uniform_times(to_seconds(period));
+  Eigen::MatrixXd positions = this->spline_.evaluate(times);
+  Trajectory<JointPositions> trajectory(this->name_);
+  trajectory.set_joint_names(*this->joint_names_);
+  std::chrono::nanoseconds previous_time(0);
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    std::chrono::nanoseconds time = to_nanoseconds(times(i));
+    trajectory.add_point(JointPositions(this->name_, this->joint_names_, positions.col(i)), time - previous_time);
+    previous_time = time;
+  }
+  return trajectory;
+}
+}// namespace state_representation
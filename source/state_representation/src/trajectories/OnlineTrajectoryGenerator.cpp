@@ -0,0 +1,180 @@
+#include "state_representation/trajectories/OnlineTrajectoryGenerator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+namespace state_representation {
+static double sign(double value) {
+  return (value > 0) - (value < 0);
+}
+
+OnlineTrajectoryGenerator::OnlineTrajectoryGenerator(const std::chrono::nanoseconds& period,
+                                                     const Eigen::VectorXd& max_velocities,
+                                                     const Eigen::VectorXd& max_accelerations,
+                                                     const Eigen::VectorXd& max_jerks) :
+    period_(std::chrono::duration<double>(period).count()),
+    max_velocities_(max_velocities),
+    max_accelerations_(max_accelerations),
+    max_jerks_(max_jerks),
+    positions_(Eigen::VectorXd::Zero(max_velocities.size())),
+    velocities_(Eigen::VectorXd::Zero(max_velocities.size())),
+    accelerations_(Eigen::VectorXd::Zero(max_velocities.size())),
+    target_(Eigen::VectorXd::Zero(max_velocities.size())) {
+  if (this->period_ <= 0) {
+    throw exceptions::InvalidParameterException("The period has to be strictly positive");
+  }
+  this->assert_size(max_accelerations, "maximum accelerations");
+  this->assert_size(max_jerks, "maximum jerks");
+  if ((max_velocities.array() <= 0).any() || (max_accelerations.array() <= 0).any()
+      || (max_jerks.array() <= 0).any()) {
+    throw exceptions::InvalidParameterException("The limits have to be strictly positive");
+  }
+}
+
+void OnlineTrajectoryGenerator::assert_size(const Eigen::VectorXd& vector, const std::string& name) const {
+  if (vector.size() != this->get_size()) {
+    throw exceptions::IncompatibleSizeException("Input vector of " + name + " is of incorrect size, expected "
+                                                    + std::to_string(this->get_size()) + " got "
+                                                    + std::to_string(vector.size()));
+  }
+}
+
+void OnlineTrajectoryGenerator::reset(const Eigen::VectorXd& positions,
+                                      const Eigen::VectorXd& velocities,
+                                      const Eigen::VectorXd& accelerations) {
+  this->assert_size(positions, "positions");
+  this->positions_ = positions;
+  if (velocities.size()) {
+    this->assert_size(velocities, "velocities");
+    this->velocities_ = velocities;
+  } else {
+    this->velocities_.setZero();
+  }
+  if (accelerations.size()) {
+    this->assert_size(accelerations, "accelerations");
+    this->accelerations_ = accelerations;
+  } else {
+    this->accelerations_.setZero();
+  }
+  this->target_ = positions;
+}
+
+void OnlineTrajectoryGenerator::reset(const JointState& state) {
+  this->reset(state.get_positions(), state.get_velocities(), state.get_accelerations());
+}
+
+void OnlineTrajectoryGenerator::set_target(const Eigen::VectorXd& target) {
+  this->assert_size(target, "target positions");
+  this->target_ = target;
+}
+
+void OnlineTrajectoryGenerator::set_target(const JointState& target) {
+  this->set_target(target.get_positions());
+}
+
+bool OnlineTrajectoryGenerator::update() {
+  const double dt = this->period_;
+  for (Eigen::Index i = 0; i < this->get_size(); ++i) {
+    double v_max = this->max_velocities_(i);
+    double a_max = this->max_accelerations_(i);
+    double j_max = this->max_jerks_(i);
+    double& p = this->positions_(i);
+    double& v = this->velocities_(i);
+    double& a = this->accelerations_(i);
+    double error = this->target_(i) - p;
+    double distance = std::abs(error);
+    // fastest velocity from which the axis stops over the distance, ramping the deceleration with the jerk limit
+    double ramp = a_max / (2 * j_max);
+    double stopping_velocity = a_max * (std::sqrt(ramp * ramp + 2 * distance / a_max) - ramp);
+    double desired_velocity = sign(error) * std::min({v_max, stopping_velocity, distance / dt});
+    // fastest acceleration from which the desired velocity is reached when ramping it down with the jerk limit,
+    // from the velocity that is reached if the current acceleration is ramped down now
+    double velocity_error = desired_velocity - (v + a * std::abs(a) / (2 * j_max));
+    double desired_acceleration = sign(velocity_error) * std::min(
+        {a_max, std::sqrt(2 * j_max * std::abs(velocity_error)), std::abs(velocity_error) / dt});
+    double jerk = std::clamp((desired_acceleration - a) / dt, -j_max, j_max);
+    // exact integration of a constant jerk over the period
+    p += v * dt + a * dt * dt / 2 + jerk * dt * dt * dt / 6;
+    double velocity = v + a * dt + jerk * dt * dt / 2;
+    // the discretization can exceed the velocity limit by a fraction of a cycle when reaching it
+    v = std::abs(v) <= v_max ? std::clamp(velocity, -v_max, v_max) : velocity;
+    a += jerk * dt;
+  }
+  return this->is_target_reached();
+}
+
+bool OnlineTrajectoryGenerator::update(JointState& setpoint) {
+  bool reached = this->update();
+  setpoint.set_positions(this->positions_);
+  setpoint.set_velocities(this->velocities_);
+  setpoint.set_accelerations(this->accelerations_);
+  return reached;
+}
+
+bool OnlineTrajectoryGenerator::is_target_reached(double tolerance) const {
+  return (this->target_ - this->positions_).cwiseAbs().maxCoeff() <= tolerance
+      && this->velocities_.cwiseAbs().maxCoeff() <= tolerance
+      && this->accelerations_.cwiseAbs().maxCoeff() <= tolerance;
+}
+
+CartesianOnlineTrajectoryGenerator::CartesianOnlineTrajectoryGenerator(const std::chrono::nanoseconds& period,
+                                                                       double max_linear_velocity,
+                                                                       double max_linear_acceleration,
+                                                                       double max_linear_jerk,
+                                                                       double max_angular_velocity,
+                                                                       double max_angular_acceleration,
+                                                                       double max_angular_jerk) :
+    generator_(period,
+               (Eigen::VectorXd(6) << Eigen::Vector3d::Constant(max_linear_velocity),
+                   Eigen::Vector3d::Constant(max_angular_velocity)).finished(),
+               (Eigen::VectorXd(6) << Eigen::Vector3d::Constant(max_linear_acceleration),
+                   Eigen::Vector3d::Constant(max_angular_acceleration)).finished(),
+               (Eigen::VectorXd(6) << Eigen::Vector3d::Constant(max_linear_jerk),
+                   Eigen::Vector3d::Constant(max_angular_jerk)).finished()),
+    reference_orientation_(Eigen::Quaterniond::Identity()) {}
+
+void CartesianOnlineTrajectoryGenerator::reset(const CartesianState& state) {
+  this->reference_orientation_ = state.get_orientation();
+  Eigen::VectorXd positions = Eigen::VectorXd::Zero(6);
+  positions.head<3>() = state.get_position();
+  // at the reference orientation, the rates of the rotation vector are the angular velocity and acceleration
+  // expressed in the reference frame, as mapped back in update
+  Eigen::Quaterniond inverse_reference = this->reference_orientation_.conjugate();
+  Eigen::VectorXd velocities(6), accelerations(6);
+  velocities << state.get_linear_velocity(), inverse_reference * state.get_angular_velocity();
+  accelerations << state.get_linear_acceleration(), inverse_reference * state.get_angular_acceleration();
+  this->generator_.reset(positions, velocities, accelerations);
+}
+
+void CartesianOnlineTrajectoryGenerator::set_target(const CartesianState& target) {
+  Eigen::VectorXd positions(6);
+  positions.head<3>() = target.get_position();
+  // the conversion to an angle axis takes the shortest rotation, of angle at most half a turn
+  Eigen::AngleAxisd rotation(this->reference_orientation_.conjugate() * target.get_orientation());
+  positions.tail<3>() = rotation.angle() * rotation.axis();
+  this->generator_.set_target(positions);
+}
+
+bool CartesianOnlineTrajectoryGenerator::update(CartesianState& setpoint) {
+  bool reached = this->generator_.update();
+  const Eigen::VectorXd& positions = this->generator_.get_positions();
+  const Eigen::VectorXd& velocities = this->generator_.get_velocities();
+  const Eigen::VectorXd& accelerations = this->generator_.get_accelerations();
+  Eigen::Vector3d rotation_vector = positions.tail<3>();
+  double angle = rotation_vector.norm();
+  Eigen::Quaterniond rotation = angle > 1e-12 ? Eigen::Quaterniond(Eigen::AngleAxisd(angle, rotation_vector / angle))
+                                              : Eigen::Quaterniond::Identity();
+  Eigen::Quaterniond orientation = this->reference_orientation_ * rotation;
+  setpoint.set_position(Eigen::Vector3d(positions.head<3>()));
+  setpoint.set_orientation(orientation);
+  setpoint.set_linear_velocity(Eigen::Vector3d(velocities.head<3>()));
+  setpoint.set_linear_acceleration(Eigen::Vector3d(accelerations.head<3>()));
+  // the rates of the rotation vector are mapped to the reference frame, which is exact for rotations about a fixed axis
+  setpoint.set_angular_velocity(this->reference_orientation_ * Eigen::Vector3d(velocities.tail<3>()));
+  setpoint.set_angular_acceleration(this->reference_orientation_ * Eigen::Vector3d(accelerations.tail<3>()));
+  return reached;
+}
+}// namespace state_representation
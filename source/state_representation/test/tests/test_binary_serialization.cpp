@@ -0,0 +1,116 @@
+#include "state_representation/serialization/BinarySerialization.hpp"
+#include "state_representation/exceptions/SerializationException.hpp"
+#include "state_representation/parameters/Parameter.hpp"
+#include "state_representation/robot/JointPositions.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+using namespace state_representation::serialization;
+
+TEST(BinarySerializationTest, CartesianState) {
+  CartesianState state = CartesianState::Random("test", "robot");
+  std::vector<uint8_t> buffer = encode(state);
+  EXPECT_EQ(buffer.size(), get_encoded_size(state));
+  EXPECT_EQ(buffer.size() % 8, 0);
+  EXPECT_EQ(get_message_type(buffer.data(), buffer.size()), MessageType::CARTESIAN_STATE);
+  CartesianState decoded;
+  EXPECT_EQ(decode(buffer.data(), buffer.size(), decoded), buffer.size());
+  EXPECT_EQ(decoded.get_name(), "test");
+  EXPECT_EQ(decoded.get_reference_frame(), "robot");
+  EXPECT_FALSE(decoded.is_empty());
+  EXPECT_NEAR((decoded.data() - state.data()).norm(), 0, 1e-12);
+  CartesianStateView view = decode_cartesian_state_view(buffer.data(), buffer.size());
+  EXPECT_NEAR((view.get_twist() - state.get_twist()).norm(), 0, 1e-12);
+}
+
+TEST(BinarySerializationTest, FrameNamesAreStoredOnce) {
+  CartesianState state = CartesianState::Identity("frame", "frame");
+  CartesianState other = CartesianState::Identity("frame", "world");
+  EXPECT_LT(get_encoded_size(state), get_encoded_size(other));
+  CartesianState decoded;
+  std::vector<uint8_t> buffer = encode(state);
+  decode(buffer.data(), buffer.size(), decoded);
+  EXPECT_EQ(decoded.get_name(), "frame");
+  EXPECT_EQ(decoded.get_reference_frame(), "frame");
+}
+
+TEST(BinarySerializationTest, JointStateIntoPreallocatedBuffer) {
+  JointState state = JointState::Random("robot", std::vector<std::string>{"a", "b", "c"});
+  alignas(8) uint8_t buffer[512];
+  std::size_t size = encode(state, buffer, sizeof(buffer));
+  EXPECT_EQ(size, get_encoded_size(state));
+  JointState decoded("robot", 3);
+  decode(buffer, size, decoded);
+  EXPECT_EQ(decoded.get_shared_names(), state.get_shared_names());
+  EXPECT_EQ((decoded.data() - state.data()).norm(), 0);
+  // decoding the next message keeps the storage and names of the state
+  const double* positions = decoded.get_positions().data();
+  decode(buffer, size, decoded);
+  EXPECT_EQ(decoded.get_positions().data(), positions);
+  JointStateView view = decode_joint_state_view(buffer, size);
+  EXPECT_EQ(view.get_velocities(), state.get_velocities());
+  EXPECT_THROW(encode(state, buffer, 32), exceptions::SerializationException);
+  EXPECT_THROW(decode(buffer, 32, decoded), exceptions::SerializationException);
+  CartesianState wrong_type;
+  EXPECT_THROW(decode(buffer, size, wrong_type), exceptions::SerializationException);
+}
+
+TEST(BinarySerializationTest, Jacobian) {
+  Jacobian jacobian = Jacobian::Random("robot", std::vector<std::string>{"a", "b"}, "ee", "base");
+  std::vector<uint8_t> buffer = encode(jacobian);
+  Jacobian decoded;
+  decode(buffer.data(), buffer.size(), decoded);
+  EXPECT_EQ(decoded.get_joint_names(), jacobian.get_joint_names());
+  EXPECT_EQ(decoded.get_frame(), "ee");
+  EXPECT_EQ(decoded.get_reference_frame(), "base");
+  EXPECT_EQ((decoded.data() - jacobian.data()).norm(), 0);
+  Jacobian transposed = jacobian.transpose();
+  buffer = encode(transposed);
+  decode(buffer.data(), buffer.size(), decoded);
+  EXPECT_EQ(decoded.rows(), 2);
+  EXPECT_EQ((decoded.data() - transposed.data()).norm(), 0);
+  EXPECT_EQ((decode_jacobian_view(buffer.data(), buffer.size()).data() - transposed.data()).norm(), 0);
+}
+
+TEST(BinarySerializationTest, Parameters) {
+  std::vector<std::shared_ptr<ParameterInterface>> parameters{
+      std::make_shared<Parameter<double>>("double", 3.5),
+      std::make_shared<Parameter<std::vector<bool>>>("bools", std::vector<bool>{true, false, true}),
+      std::make_shared<Parameter<std::string>>("string", "value"),
+      std::make_shared<Parameter<Eigen::MatrixXd>>("matrix", Eigen::MatrixXd::Random(3, 2)),
+      std::make_shared<Parameter<CartesianPose>>("pose", CartesianPose::Random("pose")),
+      std::make_shared<Parameter<JointPositions>>("positions", JointPositions::Random("robot", 4))
+  };
+  for (const auto& parameter : parameters) {
+    std::vector<uint8_t> buffer = encode(*parameter);
+    auto decoded = decode_parameter(buffer.data(), buffer.size());
+    EXPECT_EQ(decoded->get_name(), parameter->get_name());
+    EXPECT_EQ(decoded->get_type(), parameter->get_type());
+  }
+  auto matrix = decode_parameter(encode(*parameters[3]).data(), get_encoded_size(*parameters[3]));
+  EXPECT_EQ(std::static_pointer_cast<Parameter<Eigen::MatrixXd>>(matrix)->get_value(),
+            std::static_pointer_cast<Parameter<Eigen::MatrixXd>>(parameters[3])->get_value());
+  Ellipsoid ellipsoid("ellipse");
+  ellipsoid.set_axis_lengths({2., 3.});
+  ellipsoid.set_rotation_angle(0.5);
+  std::vector<uint8_t> buffer = encode(Parameter<Ellipsoid>("ellipsoid", ellipsoid));
+  auto decoded = std::static_pointer_cast<Parameter<Ellipsoid>>(decode_parameter(buffer.data(), buffer.size()));
+  EXPECT_EQ(decoded->get_value().get_axis_lengths(), ellipsoid.get_axis_lengths());
+  EXPECT_EQ(decoded->get_value().get_rotation_angle(), 0.5);
+}
+
+TEST(BinarySerializationTest, Trajectory) {
+  Trajectory<JointState> trajectory("trajectory");
+  trajectory.add_point(JointState::Random("robot", 3), std::chrono::milliseconds(10));
+  trajectory.add_point(JointState::Random("robot", 3), std::chrono::milliseconds(20));
+  std::vector<uint8_t> buffer = encode(trajectory);
+  Trajectory<JointState> decoded;
+  EXPECT_EQ(decode(buffer.data(), buffer.size(), decoded), buffer.size());
+  EXPECT_EQ(decoded.get_name(), "trajectory");
+  ASSERT_EQ(decoded.get_size(), 2);
+  EXPECT_EQ(decoded.get_times(), trajectory.get_times());
+  EXPECT_EQ((decoded.get_point(1).data() - trajectory.get_point(1).data()).norm(), 0);
+  Trajectory<CartesianState> wrong_type;
+  EXPECT_THROW(decode(buffer.data(), buffer.size(), wrong_type), exceptions::SerializationException);
+}
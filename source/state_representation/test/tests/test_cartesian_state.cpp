@@ -4,6 +4,7 @@
 #include "state_representation/space/cartesian/CartesianPose.hpp"
 #include "state_representation/space/cartesian/CartesianTwist.hpp"
 #include "state_representation/space/cartesian/CartesianWrench.hpp"
+#include "state_representation/space/cartesian/CartesianStateView.hpp"
 
 using namespace state_representation;
 
@@ -581,3 +582,20 @@ TEST(CartesianStateTest, TestNormalized) {
     EXPECT_NEAR(n, 1.0, tolerance);
   }
 }
+
+TEST(CartesianStateTest, CopyFromView) {
+  CartesianState source = CartesianState::Random("test");
+  Eigen::VectorXd buffer = source.data();
+  CartesianStateView view(buffer.data());
+  CartesianState state("test");
+  view.copy_to(state);
+  EXPECT_FALSE(state.is_empty());
+  EXPECT_NEAR((state.data() - source.data()).norm(), 0, 1e-10);
+  // partial view only updates the provided state variables
+  Eigen::Matrix<double, 6, 1> twist = Eigen::Matrix<double, 6, 1>::Random();
+  CartesianStateView twist_view(nullptr, twist.data());
+  EXPECT_FALSE(twist_view.has_state_variable(CartesianStateVariable::POSE));
+  twist_view.copy_to(state);
+  EXPECT_NEAR((state.get_twist() - twist).norm(), 0, 1e-10);
+  EXPECT_NEAR((state.get_pose() - source.get_pose()).norm(), 0, 1e-10);
+}
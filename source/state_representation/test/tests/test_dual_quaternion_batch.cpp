@@ -0,0 +1,133 @@
+#include "state_representation/space/dual_quaternion/DualQuaternionBatch.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+
+class DualQuaternionBatchTest : public testing::Test {
+protected:
+  void SetUp() override {
+    for (int i = 0; i < 5; ++i) {
+      lhs.push_back(CartesianPose::Random("a" + std::to_string(i), "world"));
+      rhs.push_back(CartesianPose::Random("b" + std::to_string(i), "a" + std::to_string(i)));
+    }
+  }
+
+  static void expect_pose_near(const CartesianPose& pose, const CartesianPose& expected) {
+    EXPECT_TRUE(pose.get_position().isApprox(expected.get_position(), 1e-9));
+    EXPECT_NEAR(std::abs(pose.get_orientation().dot(expected.get_orientation())), 1, 1e-9);
+  }
+
+  std::vector<CartesianPose> lhs;
+  std::vector<CartesianPose> rhs;
+};
+
+TEST_F(DualQuaternionBatchTest, Conversions) {
+  DualQuaternionBatch batch(lhs);
+  ASSERT_EQ(batch.get_size(), 5);
+  std::vector<CartesianPose> poses(5, CartesianPose::Identity("pose"));
+  batch.to_poses(poses);
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    EXPECT_EQ(poses[i].get_name(), "pose");
+    expect_pose_near(poses[i], lhs[i]);
+  }
+  poses.pop_back();
+  EXPECT_THROW(batch.to_poses(poses), exceptions::IncompatibleSizeException);
+
+  batch.resize(6);
+  EXPECT_TRUE(batch.get_position(5).isZero());
+  EXPECT_EQ(batch.get_primary(5).w(), 1);
+}
+
+TEST_F(DualQuaternionBatchTest, MultiplyAndConjugate) {
+  DualQuaternionBatch a(lhs), b(rhs), result;
+  DualQuaternionBatch::multiply(a, b, result);
+  CartesianPose pose("pose");
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    result.get_pose(i, pose);
+    expect_pose_near(pose, lhs[i] * rhs[i]);
+  }
+  // in place product with the inverse gives back the identity
+  DualQuaternionBatch inverse;
+  DualQuaternionBatch::conjugate(a, inverse);
+  DualQuaternionBatch::multiply(inverse, a, inverse);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_TRUE(inverse.get_position(i).isZero(1e-9));
+    EXPECT_NEAR(std::abs(inverse.get_primary(i).w()), 1, 1e-9);
+  }
+  EXPECT_THROW(DualQuaternionBatch::multiply(a, DualQuaternionBatch(2), result),
+               exceptions::IncompatibleSizeException);
+
+  DualQuaternionBatch::chain(a, result);
+  Eigen::Vector3d position = lhs[0].get_position();
+  Eigen::Quaterniond orientation = lhs[0].get_orientation();
+  for (std::size_t i = 1; i < lhs.size(); ++i) {
+    position += orientation * lhs[i].get_position();
+    orientation *= lhs[i].get_orientation();
+    EXPECT_TRUE(result.get_position(i).isApprox(position, 1e-9));
+    EXPECT_NEAR(std::abs(result.get_primary(i).dot(orientation)), 1, 1e-9);
+  }
+
+  // a tree with two branches from the first link
+  DualQuaternionBatch tree;
+  DualQuaternionBatch::chain(a, {-1, 0, 1, 0, 3}, tree);
+  EXPECT_TRUE(tree.get_position(2).isApprox(result.get_position(2), 1e-9));
+  EXPECT_TRUE(tree.get_position(3).isApprox(lhs[0].get_position() + lhs[0].get_orientation() * lhs[3].get_position(),
+                                            1e-9));
+  EXPECT_THROW(DualQuaternionBatch::chain(a, {-1, 0, 3, 0, 3}, tree), exceptions::InvalidParameterException);
+}
+
+TEST_F(DualQuaternionBatchTest, JointKinematics) {
+  // a serial chain alternating revolute and prismatic joints, each placed in the frame of the previous one
+  std::vector<Eigen::Vector3d> axes;
+  std::vector<bool> prismatic;
+  Eigen::VectorXd positions = Eigen::VectorXd::Random(lhs.size()) * M_PI;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    axes.emplace_back(Eigen::Vector3d::Random().normalized());
+    prismatic.push_back(i % 2 == 1);
+  }
+  DualQuaternionBatch placements(lhs), motions(lhs.size()), transforms;
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    motions.set_joint_motion(i, axes[i], positions(i), prismatic[i]);
+  }
+  DualQuaternionBatch::multiply(placements, motions, transforms);
+  DualQuaternionBatch::chain(transforms, transforms);
+
+  Eigen::Vector3d position = Eigen::Vector3d::Zero();
+  Eigen::Quaterniond orientation = Eigen::Quaterniond::Identity();
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    position += orientation * lhs[i].get_position();
+    orientation *= lhs[i].get_orientation();
+    if (prismatic[i]) {
+      position += orientation * (positions(i) * axes[i]);
+    } else {
+      orientation *= Eigen::Quaterniond(Eigen::AngleAxisd(positions(i), axes[i]));
+    }
+    EXPECT_TRUE(transforms.get_position(i).isApprox(position, 1e-9));
+    EXPECT_NEAR(std::abs(transforms.get_primary(i).dot(orientation)), 1, 1e-9);
+  }
+}
+
+TEST_F(DualQuaternionBatchTest, ScrewInterpolation) {
+  DualQuaternionBatch start(lhs), end(rhs), result;
+  CartesianPose pose("pose");
+  DualQuaternionBatch::sclerp(start, end, 0, result);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    result.get_pose(i, pose);
+    expect_pose_near(pose, lhs[i]);
+  }
+  DualQuaternionBatch::sclerp(start, end, 1, result);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    result.get_pose(i, pose);
+    expect_pose_near(pose, rhs[i]);
+  }
+
+  // the screw motion between these poses is a rotation around the vertical axis through (0.5, 0.5, 0)
+  DualQuaternionBatch origin(1), screw(1);
+  origin.set(0, Eigen::Vector3d(1, 0, 0), Eigen::Quaterniond::Identity());
+  screw.set(0, Eigen::Vector3d(1, 1, 0), Eigen::Quaterniond(Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d::UnitZ())));
+  DualQuaternionBatch::sclerp(origin, screw, 0.5, result);
+  EXPECT_TRUE(result.get_position(0).isApprox(Eigen::Vector3d(0.5 + std::sqrt(0.5), 0.5, 0), 1e-9));
+  EXPECT_TRUE(result.get_primary(0).isApprox(Eigen::Quaterniond(Eigen::AngleAxisd(M_PI / 4, Eigen::Vector3d::UnitZ()))));
+}
@@ -1,4 +1,7 @@
-#include "state_representation/geometry/Ellipsoid.hpp"
+#include "state_representation/geometry/EllipsoidEstimator.hpp"
+#include "state_representation/exceptions/NoSolutionToFitException.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
 #include <gtest/gtest.h>
 
 using namespace state_representation;
@@ -77,4 +80,158 @@ TEST(EllipsoidTest, EllipsoidFitting) {
     EXPECT_TRUE(abs(ellipse.get_axis_length(0) - fitted_ellipse.get_axis_length(0)) < epsilon);
     EXPECT_TRUE(abs(ellipse.get_axis_length(1) - fitted_ellipse.get_axis_length(1)) < epsilon);
   }
+
+  // an ellipse smaller than the noise level is still fitted
+  ellipse.set_center_position(Eigen::Vector3d(1, 2, 0));
+  ellipse.set_axis_lengths({0.004, 0.002});
+  fitted_ellipse = Ellipsoid::fit("fitted_test", ellipse.sample_from_parameterization(100));
+  EXPECT_NEAR(fitted_ellipse.get_axis_length(0), 0.004, 1e-9);
+  EXPECT_NEAR(fitted_ellipse.get_axis_length(1), 0.002, 1e-9);
+
+  // degenerated points give a circle of radius the noise level at their mean, whatever their container
+  Eigen::Matrix2Xd aligned(2, 10);
+  std::list<CartesianPose> aligned_list;
+  for (int j = 0; j < 10; ++j) {
+    aligned.col(j) << j, 2 * j;
+    aligned_list.emplace_back("point", Eigen::Vector3d(j, 2 * j, 0));
+  }
+  for (const auto& degenerated : {Ellipsoid::fit("fitted_test", aligned, "world", 0.1),
+                                  Ellipsoid::fit("fitted_test", aligned_list, "world", 0.1)}) {
+    EXPECT_TRUE(degenerated.get_center_position().isApprox(Eigen::Vector3d(4.5, 9, 0)));
+    EXPECT_EQ(degenerated.get_axis_length(0), 0.1);
+    EXPECT_EQ(degenerated.get_axis_length(1), 0.1);
+  }
+  EXPECT_THROW(Ellipsoid::fit("fitted_test", Eigen::Matrix2Xd(2, 0)), exceptions::NoSolutionToFitException);
+}
+
+TEST(EllipsoidTest, IncrementalFitting) {
+  Ellipsoid ellipse("test");
+  ellipse.set_center_position(Eigen::Vector3d(100, -50, 0));
+  ellipse.set_center_orientation(Eigen::Quaterniond(Eigen::AngleAxisd(-0.3, Eigen::Vector3d::UnitZ())));
+  ellipse.set_axis_lengths({2, 0.5});
+  auto samples = ellipse.sample_from_parameterization(50);
+
+  EllipseFitter fitter;
+  EXPECT_THROW(fitter.solve(), exceptions::NoSolutionToFitException);
+  Eigen::Matrix2Xd points(2, samples.size());
+  unsigned int i = 0;
+  for (const auto& p : samples) {
+    points.col(i++) = p.get_position().head<2>();
+  }
+  fitter.add_points(points.leftCols(25));
+  for (i = 25; i < points.cols(); ++i) {
+    fitter.add_point(points.col(i));
+  }
+  EXPECT_EQ(fitter.get_number_of_points(), 50);
+  Ellipsoid fitted = fitter.fit("fitted");
+  EXPECT_TRUE(fitted.get_center_position().isApprox(ellipse.get_center_position(), 1e-6));
+  EXPECT_NEAR(fitted.get_axis_length(0), 2, 1e-6);
+  EXPECT_NEAR(fitted.get_axis_length(1), 0.5, 1e-6);
+  EXPECT_NEAR(std::remainder(fitted.get_rotation_angle() + 0.3, M_PI), 0, 1e-6);
+
+  // the fit is deterministic
+  EXPECT_EQ(Ellipsoid::fit("fitted", points).to_std_vector(), Ellipsoid::fit("fitted", points).to_std_vector());
+
+  // aligned points
+  fitter.reset();
+  for (i = 0; i < 10; ++i) {
+    fitter.add_point(i, 2 * i);
+  }
+  EXPECT_THROW(fitter.solve(), exceptions::NoSolutionToFitException);
+}
+
+TEST(EllipsoidTest, PlanarFittingIn3D) {
+  Ellipsoid ellipse("test");
+  ellipse.set_center_position(Eigen::Vector3d(1, 2, 3));
+  ellipse.set_center_orientation(Eigen::Quaterniond(Eigen::AngleAxisd(0.7, Eigen::Vector3d(1, 1, 0).normalized())));
+  ellipse.set_axis_lengths({3, 1});
+  auto samples = ellipse.sample_from_parameterization(60);
+  Eigen::Matrix3Xd points(3, samples.size());
+  unsigned int i = 0;
+  for (const auto& p : samples) {
+    points.col(i++) = p.get_position();
+  }
+  Ellipsoid fitted = Ellipsoid::fit("fitted", points);
+  EXPECT_TRUE(fitted.get_center_position().isApprox(ellipse.get_center_position(), 1e-6));
+  EXPECT_NEAR(fitted.get_axis_length(0), 3, 1e-6);
+  EXPECT_NEAR(fitted.get_axis_length(1), 1, 1e-6);
+  // the fitted ellipse samples the same points
+  for (const auto& p : fitted.sample_from_parameterization(20)) {
+    Eigen::Vector3d local = (fitted.get_center_pose() * fitted.get_rotation()).inverse().get_orientation()
+        * (p.get_position() - fitted.get_center_position());
+    EXPECT_NEAR(std::pow(local(0) / 3, 2) + std::pow(local(1), 2), 1, 1e-6);
+    Eigen::Vector3d original = ellipse.get_center_orientation().conjugate() * (p.get_position() - ellipse.get_center_position());
+    EXPECT_NEAR(original(2), 0, 1e-6);
+  }
+}
+
+TEST(EllipsoidTest, StreamingEstimation) {
+  CartesianPose plane("plane", Eigen::Vector3d(0, 0, 1), Eigen::Quaterniond(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitX())));
+  EllipsoidEstimator estimator("estimate", plane, 0.9);
+  EXPECT_THROW(EllipseFitter(0.), exceptions::InvalidParameterException);
+  auto limit_cycle = std::make_shared<Parameter<Ellipsoid>>("limit_cycle", Ellipsoid("limit_cycle"));
+  estimator.bind(limit_cycle);
+
+  // the shape changes during the demonstration, the estimate follows the last points
+  Ellipsoid first("first");
+  first.set_center_pose(CartesianPose("first", Eigen::Vector3d(0, 0, 1), plane.get_orientation()));
+  first.set_axis_lengths({2, 1});
+  Ellipsoid second(first);
+  second.set_axis_lengths({1, 0.5});
+  second.set_rotation_angle(0.4);
+  for (const auto& ellipse : {first, second}) {
+    for (const auto& point : ellipse.sample_from_parameterization(200)) {
+      estimator.add_point(point.get_position());
+    }
+  }
+  ASSERT_TRUE(estimator.has_estimate());
+  EXPECT_EQ(estimator.get_fitter().get_number_of_points(), 400);
+  EXPECT_LT(estimator.get_fitter().get_weight(), 10.1);
+  const auto& estimate = estimator.get_estimate();
+  EXPECT_EQ(estimate.get_name(), "estimate");
+  EXPECT_TRUE(estimate.get_center_position().isApprox(Eigen::Vector3d(0, 0, 1), 1e-3));
+  EXPECT_NEAR(estimate.get_axis_length(0), 1, 1e-3);
+  EXPECT_NEAR(estimate.get_axis_length(1), 0.5, 1e-3);
+  EXPECT_NEAR(std::remainder(estimate.get_rotation_angle() - 0.4, M_PI), 0, 1e-3);
+
+  // the bound parameter keeps its name and follows the estimate
+  EXPECT_EQ(limit_cycle->get_value().get_name(), "limit_cycle");
+  EXPECT_EQ(limit_cycle->get_value().to_std_vector(), estimate.to_std_vector());
+  EXPECT_THROW(estimator.add_point(CartesianPose::Identity("point", "other")),
+               exceptions::IncompatibleReferenceFramesException);
+
+  estimator.reset();
+  EXPECT_FALSE(estimator.has_estimate());
+  EXPECT_FALSE(estimator.add_point(Eigen::Vector3d::Zero()));
+}
+
+TEST(EllipsoidTest, DistanceQueries) {
+  Ellipsoid ellipse("test");
+  ellipse.set_axis_lengths({2., 0.5});
+  ellipse.set_rotation_angle(0.3);
+  ellipse.set_center_position(Eigen::Vector3d(1., -1., 0.5));
+
+  // brute force the distance to the sampled surface
+  auto samples = ellipse.sample_from_parameterization(10000);
+  for (int i = 0; i < 50; ++i) {
+    Eigen::Vector3d point = ellipse.get_center_position() + 3 * Eigen::Vector3d::Random();
+    double expected = std::numeric_limits<double>::infinity();
+    for (const auto& sample : samples) {
+      expected = std::min(expected, (point - sample.get_position()).head<2>().norm());
+    }
+    double distance = ellipse.signed_distance(point);
+    EXPECT_NEAR(std::abs(distance), expected, 1e-3);
+    EXPECT_EQ(distance < 0, ellipse.is_inside(point));
+    Eigen::Vector3d closest = ellipse.get_closest_point(point);
+    EXPECT_NEAR(closest(2), point(2), 1e-12);
+    // the normal is the gradient of the signed distance
+    Eigen::Vector3d normal = ellipse.get_normal(point);
+    EXPECT_NEAR(normal.norm(), 1, 1e-9);
+    EXPECT_NEAR(normal(2), 0, 1e-12);
+    if (std::abs(distance) > 1e-3) {
+      EXPECT_TRUE(((point - closest) / distance).isApprox(normal, 1e-5));
+    }
+  }
+  EXPECT_TRUE(ellipse.is_inside(ellipse.get_center_position()));
+  EXPECT_NEAR(ellipse.signed_distance(ellipse.get_center_position()), -0.5, 1e-9);
 }
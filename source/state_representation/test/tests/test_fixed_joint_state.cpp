@@ -0,0 +1,86 @@
+#include "state_representation/robot/FixedJointState.hpp"
+#include "state_representation/serialization/BinarySerialization.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+using namespace state_representation::exceptions;
+
+TEST(FixedJointStateTest, DynamicSizeIsJointState) {
+  EXPECT_TRUE((std::is_same<JointStateN<Eigen::Dynamic>, JointState>::value));
+  EXPECT_TRUE((std::is_same<JointStateN<7>, FixedJointState<7>>::value));
+}
+
+TEST(FixedJointStateTest, ZeroInitialization) {
+  FixedJointState<6> zero = FixedJointState<6>::Zero("test_robot");
+  EXPECT_FALSE(zero.is_empty());
+  EXPECT_EQ(zero.get_size(), 6);
+  EXPECT_EQ(zero.data().norm(), 0);
+  EXPECT_EQ(zero.get_names().at(5), "joint5");
+  EXPECT_TRUE(FixedJointState<6>("test_robot").is_empty());
+  EXPECT_THROW(zero.set_names(std::vector<std::string>{"j0", "j1"}), IncompatibleSizeException);
+}
+
+TEST(FixedJointStateTest, Operations) {
+  FixedJointState<7> j1 = FixedJointState<7>::Random("test_robot");
+  FixedJointState<7> j2 = FixedJointState<7>::Random("test_robot");
+  FixedJointState<7> result = 0.5 * (j1 + j2) - j2 / 2.0;
+  EXPECT_NEAR((result.data() - 0.5 * j1.data()).norm(), 0, 1e-10);
+  FixedJointState<7> other = FixedJointState<7>::Random("other_robot");
+  EXPECT_THROW(j1 + other, IncompatibleStatesException);
+}
+
+TEST(FixedJointStateTest, ConversionToAndFromJointState) {
+  JointState state = JointState::Random("test_robot", 12);
+  FixedJointState<12> fixed(state);
+  EXPECT_EQ(fixed.get_shared_names(), state.get_shared_names());
+  EXPECT_TRUE(fixed.is_compatible(state));
+  EXPECT_EQ((fixed.data() - state.data()).norm(), 0);
+  JointState back = static_cast<JointState>(fixed);
+  EXPECT_TRUE(back.is_compatible(state));
+  EXPECT_EQ((back.data() - state.data()).norm(), 0);
+  EXPECT_THROW(FixedJointState<6>{state}, IncompatibleSizeException);
+}
+
+TEST(FixedJointStateTest, MultiplyWithJacobian) {
+  Jacobian jacobian = Jacobian::Random("test_robot", 6, "ee");
+  FixedJointState<6> fixed = FixedJointState<6>::Random("test_robot");
+  CartesianTwist twist = jacobian * fixed;
+  EXPECT_NEAR((twist.data() - jacobian.data() * fixed.get_velocities()).norm(), 0, 1e-10);
+  EXPECT_EQ(twist.get_name(), "ee");
+}
+
+TEST(FixedJointStateTest, CompatibilityWithJointState) {
+  FixedJointState<3> fixed_state("robot");
+  JointState joint_state("robot", 3);
+  EXPECT_EQ(fixed_state.get_type(), StateType::FIXEDJOINTSTATE);
+  EXPECT_TRUE(joint_state.is_compatible(fixed_state));
+  EXPECT_TRUE(fixed_state.is_compatible(joint_state));
+  EXPECT_FALSE(JointState("robot", 4).is_compatible(fixed_state));
+  EXPECT_FALSE(JointState("other", 3).is_compatible(fixed_state));
+  Jacobian jacobian("robot", 3, "ee");
+  EXPECT_TRUE(jacobian.is_compatible(fixed_state));
+  EXPECT_FALSE(Jacobian("robot", 4, "ee").is_compatible(fixed_state));
+}
+
+TEST(FixedJointStateTest, Serialization) {
+  FixedJointState<3> fixed_state = FixedJointState<3>::Random("robot");
+  auto message = serialization::encode(fixed_state);
+  EXPECT_EQ(serialization::get_message_type(message.data(), message.size()), serialization::MessageType::JOINT_STATE);
+  JointState joint_state;
+  serialization::decode(message.data(), message.size(), joint_state);
+  EXPECT_EQ(joint_state.get_name(), "robot");
+  EXPECT_EQ(joint_state.get_shared_names(), fixed_state.get_shared_names());
+  EXPECT_TRUE(joint_state.data().isApprox(static_cast<JointState>(fixed_state).data()));
+
+  joint_state.set_positions(Eigen::Vector3d(1, 2, 3));
+  message = serialization::encode(joint_state);
+  FixedJointState<3> decoded("other");
+  serialization::decode(message.data(), message.size(), decoded);
+  EXPECT_EQ(decoded.get_name(), "robot");
+  EXPECT_TRUE(decoded.get_positions().isApprox(Eigen::Vector3d(1, 2, 3)));
+  EXPECT_FALSE(decoded.is_empty());
+  FixedJointState<4> wrong_size("robot");
+  EXPECT_THROW(serialization::decode(message.data(), message.size(), wrong_size), IncompatibleSizeException);
+}
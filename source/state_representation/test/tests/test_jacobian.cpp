@@ -1,5 +1,10 @@
 #include "state_representation/robot/Jacobian.hpp"
+#include "state_representation/robot/JacobianView.hpp"
+#include "state_representation/robot/JacobianSolver.hpp"
+#include "state_representation/robot/ChainJacobian.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
 #include "state_representation/exceptions/IncompatibleStatesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
 #include <gtest/gtest.h>
 
 using namespace state_representation;
@@ -181,3 +186,115 @@ TEST(JacobianTest, TestChangeReferenceFrame) {
   JointVelocities jt2 = jac_in_test_ref.solve(vel_in_test_ref);
   EXPECT_TRUE(jt1.data().isApprox(jt2.data()));
 }
+
+TEST(JacobianTest, CopyFromView) {
+  Eigen::MatrixXd buffer = Eigen::MatrixXd::Random(6, 7);
+  JacobianView view(buffer.data(), 7);
+  Jacobian jac("robot", 7, "test");
+  view.copy_to(jac);
+  EXPECT_FALSE(jac.is_empty());
+  EXPECT_EQ((jac.data() - buffer).norm(), 0);
+  Jacobian wrong_size("robot", 6, "test");
+  EXPECT_THROW(view.copy_to(wrong_size), IncompatibleSizeException);
+}
+
+TEST(JacobianTest, TestSolver) {
+  Jacobian jac = Jacobian::Random("robot", 7, "test");
+  CartesianTwist twist = CartesianTwist::Random("test");
+  JacobianSolver solver(JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION);
+  EXPECT_FALSE(solver.is_computed());
+  EXPECT_THROW(solver.solve(twist), exceptions::EmptyStateException);
+
+  Eigen::MatrixXd pinv = jac.pseudoinverse().data();
+  for (auto method : {JacobianSolverMethod::COMPLETE_ORTHOGONAL_DECOMPOSITION,
+                      JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION,
+                      JacobianSolverMethod::DAMPED_LEAST_SQUARES}) {
+    solver = JacobianSolver(jac, method);
+    EXPECT_EQ(solver.rank(), 6);
+    EXPECT_TRUE(solver.pseudoinverse_matrix().isApprox(pinv, 1e-6));
+    Jacobian solver_pinv = solver.pseudoinverse();
+    EXPECT_EQ(solver_pinv.rows(), 7);
+    EXPECT_EQ(solver_pinv.cols(), 6);
+    JointVelocities dq = solver.solve(twist);
+    EXPECT_TRUE(dq.data().isApprox(pinv * twist.data(), 1e-6));
+    EXPECT_TRUE((jac.data() * solver.null_space_projector()).isZero(1e-9));
+    JointVelocities null_dq = solver.project_on_null_space(JointVelocities::Random("robot", 7));
+    EXPECT_TRUE((jac.data() * null_dq.data()).isZero(1e-9));
+  }
+
+  // repeated updates of the same layout reuse the factorization
+  Jacobian updated = Jacobian::Random("robot", 7, "test");
+  solver.compute(updated);
+  EXPECT_TRUE(solver.pseudoinverse_matrix().isApprox(updated.pseudoinverse().data(), 1e-6));
+
+  CartesianWrench wrench = CartesianWrench::Random("test");
+  JointTorques torques = solver.transpose_multiply(wrench);
+  EXPECT_TRUE(torques.data().isApprox(updated.data().transpose() * wrench.data()));
+  EXPECT_THROW(solver.transpose_multiply(CartesianWrench::Random("other")), exceptions::IncompatibleStatesException);
+}
+
+TEST(JacobianTest, TestDampedSolverNearSingularity) {
+  Eigen::MatrixXd data = Eigen::MatrixXd::Random(6, 7);
+  data.row(5) = data.row(4) * (1 + 1e-10);
+  Jacobian jac("robot", "test", data);
+  for (auto method : {JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION,
+                      JacobianSolverMethod::DAMPED_LEAST_SQUARES}) {
+    JacobianSolver solver(jac, method, 0.1);
+    // the damped pseudoinverse stays bounded close to the singularity
+    EXPECT_LT(solver.pseudoinverse_matrix().norm(), 1e2);
+    Eigen::VectorXd rhs = Eigen::VectorXd::Random(6);
+    Eigen::VectorXd result;
+    solver.solve(rhs, result);
+    EXPECT_TRUE(result.isApprox(solver.pseudoinverse_matrix() * rhs, 1e-9));
+  }
+  JacobianSolver svd(jac, JacobianSolverMethod::SINGULAR_VALUE_DECOMPOSITION, 0.1);
+  JacobianSolver dls(jac, JacobianSolverMethod::DAMPED_LEAST_SQUARES, 0.1);
+  EXPECT_TRUE(svd.pseudoinverse_matrix().isApprox(dls.pseudoinverse_matrix(), 1e-6));
+  EXPECT_THROW(dls.set_damping(-1.), exceptions::InvalidParameterException);
+}
+
+TEST(JacobianTest, TestChainJacobian) {
+  Eigen::MatrixXd data = Eigen::MatrixXd::Random(6, 10);
+  for (unsigned int i : {1, 4, 5, 7, 8, 9}) {
+    data.col(i).setZero();
+  }
+  Jacobian jac("robot", "test", data);
+  ChainJacobian chain(jac);
+  EXPECT_EQ(chain.get_chain_columns(), std::vector<unsigned int>({0, 2, 3, 6}));
+  EXPECT_EQ(chain.rows(), 6);
+  EXPECT_EQ(chain.cols(), 10);
+  EXPECT_EQ(chain.get_block().cols(), 4);
+  EXPECT_EQ(chain.get_shared_joint_names(), jac.get_shared_joint_names());
+  EXPECT_TRUE(chain.to_jacobian().data().isApprox(data));
+
+  JointVelocities dq = JointVelocities::Random("robot", 10);
+  dq.set_shared_names(jac.get_shared_joint_names());
+  EXPECT_TRUE((chain * dq).data().isApprox((jac * dq).data()));
+  Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(10, 3);
+  EXPECT_TRUE((chain * matrix).isApprox(jac * matrix));
+
+  CartesianWrench wrench = CartesianWrench::Random("test");
+  JointTorques torques = chain.transpose_multiply(wrench);
+  EXPECT_TRUE(torques.data().isApprox(data.transpose() * wrench.data()));
+
+  CartesianTwist twist = CartesianTwist::Random("test");
+  JointVelocities solution = chain.solve(twist);
+  EXPECT_EQ(solution.get_size(), 10);
+  // the chain is rank deficient, the least squares residual is the same as with the dense Jacobian
+  EXPECT_NEAR((data * solution.data() - twist.data()).norm(),
+              (data * jac.solve(twist).data() - twist.data()).norm(), 1e-6);
+  EXPECT_EQ(solution.data()(1), 0);
+
+  ChainJacobian empty("robot", jac.get_shared_joint_names(), {3, 0}, "test");
+  EXPECT_TRUE(empty.is_empty());
+  EXPECT_EQ(empty.get_chain_columns(), std::vector<unsigned int>({0, 3}));
+  EXPECT_THROW(empty * dq, exceptions::EmptyStateException);
+  EXPECT_THROW(ChainJacobian("robot", jac.get_shared_joint_names(), {10}, "test"),
+               exceptions::InvalidParameterException);
+  EXPECT_THROW(ChainJacobian("robot", jac.get_shared_joint_names(), {3, 3}, "test"),
+               exceptions::InvalidParameterException);
+  EXPECT_THROW(chain.set_data(Eigen::MatrixXd::Random(6, 4)), exceptions::IncompatibleSizeException);
+  empty.set_data(data);
+  EXPECT_FALSE(empty.is_empty());
+  EXPECT_TRUE(empty.get_block().data().col(1).isApprox(data.col(3)));
+}
@@ -2,8 +2,10 @@
 #include <gtest/gtest.h>
 #include "state_representation/robot/JointPositions.hpp"
 #include "state_representation/robot/JointState.hpp"
+#include "state_representation/robot/JointStateView.hpp"
 #include "state_representation/robot/JointTorques.hpp"
 #include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
 
 using namespace state_representation;
 
@@ -276,3 +278,74 @@ TEST(JointStateTest, MultiplyByArray) {
   JointState jscaled = gain * js;
   EXPECT_NEAR(jscaled.data().norm(), (gain * js.data()).norm(), 1e-4);
 }
+
+TEST(JointStateTest, ChainedOperationsOnTemporaries) {
+  JointState j1 = JointState::Random("test_robot", 4);
+  JointState j2 = JointState::Random("test_robot", 4);
+  JointState j3 = JointState::Random("test_robot", 4);
+  JointState jres = 0.5 * (j1 + j2 - j3) / 2.0;
+  EXPECT_NEAR((jres.data() - 0.25 * (j1.data() + j2.data() - j3.data())).norm(), 0, 1e-10);
+  EXPECT_EQ(jres.get_names(), j1.get_names());
+
+  JointPositions p1 = JointPositions::Random("test_robot", 4);
+  JointPositions p2 = JointPositions::Random("test_robot", 4);
+  JointPositions pres = 2.0 * (p1 - p2) + p2;
+  EXPECT_NEAR((pres.data() - (2.0 * (p1.data() - p2.data()) + p2.data())).norm(), 0, 1e-10);
+  // moving a state into a derived type only keeps the relevant variable
+  JointState random = JointState::Random("test_robot", 4);
+  Eigen::VectorXd positions = random.get_positions();
+  JointPositions pmoved(std::move(random));
+  EXPECT_EQ((pmoved.data() - positions).norm(), 0);
+  EXPECT_EQ(static_cast<JointState&>(pmoved).get_velocities().norm(), 0);
+}
+
+TEST(JointStateTest, SharedJointNames) {
+  std::vector<std::string> names{"j0", "j1", "j2"};
+  JointState j1 = JointState::Random("test_robot", names);
+  JointState j2 = JointState::Random("test_robot", names);
+  // identical names are interned into the same table
+  EXPECT_EQ(j1.get_shared_names(), j2.get_shared_names());
+  // copies and operation results share the table of their operands
+  JointState jsum = j1 + j2;
+  EXPECT_EQ(jsum.get_shared_names(), j1.get_shared_names());
+  JointPositions positions(j1);
+  EXPECT_EQ(positions.get_shared_names(), j1.get_shared_names());
+  // a different order of the joints gives a different table and incompatible states
+  JointState j3 = JointState::Random("test_robot", std::vector<std::string>{"j1", "j0", "j2"});
+  EXPECT_NE(j3.get_shared_names(), j1.get_shared_names());
+  EXPECT_FALSE(j1.is_compatible(j3));
+  // renaming the joints changes the table
+  j3.set_names(names);
+  EXPECT_EQ(j3.get_shared_names(), j1.get_shared_names());
+  EXPECT_TRUE(j1.is_compatible(j3));
+  // default names are shared as well
+  EXPECT_EQ(JointState("test_robot", 3).get_shared_names(), joint_names::intern(3));
+  // tables that were not interned are interned by the states
+  auto table = std::make_shared<const std::vector<std::string>>(names);
+  JointState j4("test_robot", table);
+  EXPECT_EQ(j4.get_shared_names(), j1.get_shared_names());
+  EXPECT_TRUE(j1.is_compatible(j4));
+  j3.set_shared_names(std::make_shared<const std::vector<std::string>>(names));
+  EXPECT_EQ(j3.get_shared_names(), j1.get_shared_names());
+  EXPECT_THROW(JointState("test_robot", SharedJointNames()), exceptions::InvalidParameterException);
+  EXPECT_THROW(j3.set_shared_names(nullptr), exceptions::InvalidParameterException);
+}
+
+TEST(JointStateTest, CopyFromView) {
+  JointState source = JointState::Random("test_robot", 4);
+  Eigen::VectorXd buffer = source.data();
+  JointStateView view(buffer.data(), 4);
+  JointState state("test_robot", 4);
+  view.copy_to(state);
+  EXPECT_FALSE(state.is_empty());
+  EXPECT_EQ((state.data() - source.data()).norm(), 0);
+  // partial view only updates the provided state variables
+  std::vector<double> torques{1, 2, 3, 4};
+  JointStateView torques_view(4, nullptr, nullptr, nullptr, torques.data());
+  EXPECT_EQ(torques_view.get_positions().size(), 0);
+  torques_view.copy_to(state);
+  EXPECT_EQ(state.get_torques()(3), 4);
+  EXPECT_EQ(state.get_positions(), source.get_positions());
+  JointState wrong_size("test_robot", 3);
+  EXPECT_THROW(view.copy_to(wrong_size), exceptions::IncompatibleSizeException);
+}
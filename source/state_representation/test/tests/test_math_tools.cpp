@@ -0,0 +1,87 @@
+#include "state_representation/MathTools.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+
+class MathToolsTest : public testing::Test {
+protected:
+  void SetUp() override {
+    std::srand(7);
+    lhs.resize(100, 4);
+    rhs.resize(100, 4);
+    for (Eigen::Index i = 0; i < lhs.rows(); ++i) {
+      Eigen::Quaterniond p = Eigen::Quaterniond::UnitRandom();
+      Eigen::Quaterniond q = Eigen::Quaterniond::UnitRandom();
+      lhs.row(i) << p.w(), p.x(), p.y(), p.z();
+      rhs.row(i) << q.w(), q.x(), q.y(), q.z();
+    }
+    // nearly identical and opposite quaternions
+    lhs.row(0) << 1, 0, 0, 0;
+    rhs.row(0) << std::cos(1e-9), std::sin(1e-9), 0, 0;
+    rhs.row(1) = -lhs.row(1);
+  }
+
+  static Eigen::Quaterniond quaternion(const Eigen::Matrix<double, Eigen::Dynamic, 4>& array, Eigen::Index i) {
+    return Eigen::Quaterniond(array(i, 0), array(i, 1), array(i, 2), array(i, 3));
+  }
+
+  Eigen::Matrix<double, Eigen::Dynamic, 4> lhs;
+  Eigen::Matrix<double, Eigen::Dynamic, 4> rhs;
+};
+
+TEST_F(MathToolsTest, LogAndExp) {
+  Eigen::Matrix<double, Eigen::Dynamic, 3> logs;
+  Eigen::Matrix<double, Eigen::Dynamic, 4> exps;
+  math_tools::log(lhs, logs);
+  math_tools::exp(logs, 1, exps);
+  for (Eigen::Index i = 0; i < lhs.rows(); ++i) {
+    Eigen::Quaterniond q = quaternion(lhs, i);
+    Eigen::Quaterniond log_q = math_tools::log(q);
+    EXPECT_EQ(log_q.w(), 0);
+    EXPECT_EQ(logs.row(i), log_q.vec().transpose());
+    // exp is the inverse of log
+    EXPECT_TRUE(math_tools::exp(log_q).coeffs().isApprox(q.coeffs(), 1e-12));
+    EXPECT_EQ(quaternion(exps, i).coeffs(), math_tools::exp(log_q).coeffs());
+    // on the hemisphere of the identity, the log is half the rotation vector and exp scales the angle
+    Eigen::Quaterniond canonical = q.w() < 0 ? Eigen::Quaterniond(-q.coeffs()) : q;
+    Eigen::AngleAxisd angle_axis(canonical);
+    Eigen::Quaterniond log_canonical = math_tools::log(canonical);
+    EXPECT_TRUE(log_canonical.vec().isApprox(0.5 * angle_axis.angle() * angle_axis.axis(), 1e-12));
+    Eigen::Quaterniond scaled(Eigen::AngleAxisd(0.3 * angle_axis.angle(), angle_axis.axis()));
+    EXPECT_NEAR(math_tools::exp(log_canonical, 0.3).dot(scaled), 1, 1e-12);
+  }
+  EXPECT_EQ(math_tools::exp(Eigen::Quaterniond(0, 0, 0, 0)).coeffs(), Eigen::Quaterniond::Identity().coeffs());
+  // angles far from the reduced interval of the kernels
+  Eigen::Quaterniond large = math_tools::exp(Eigen::Quaterniond(0, 0, 0, 1), 1e4);
+  EXPECT_NEAR(large.w(), std::cos(1e4), 1e-12);
+  EXPECT_NEAR(large.z(), std::sin(1e4), 1e-12);
+}
+
+TEST_F(MathToolsTest, MultiplyAndSlerp) {
+  Eigen::Matrix<double, Eigen::Dynamic, 4> products;
+  math_tools::multiply(lhs, rhs, products);
+  Eigen::Matrix<double, Eigen::Dynamic, 4> interpolated = lhs;
+  math_tools::slerp(interpolated, rhs, 0.3, interpolated);
+  for (Eigen::Index i = 0; i < lhs.rows(); ++i) {
+    EXPECT_TRUE(quaternion(products, i).coeffs().isApprox((quaternion(lhs, i) * quaternion(rhs, i)).coeffs()));
+    Eigen::Quaterniond expected = quaternion(lhs, i).slerp(0.3, quaternion(rhs, i));
+    EXPECT_NEAR(std::abs(quaternion(interpolated, i).dot(expected)), 1, 1e-12);
+    EXPECT_NEAR(quaternion(interpolated, i).norm(), 1, 1e-12);
+  }
+  EXPECT_THROW(math_tools::multiply(lhs, rhs.topRows(3), products), exceptions::IncompatibleSizeException);
+  EXPECT_THROW(math_tools::slerp(lhs, rhs.topRows(3), 0.5, products), exceptions::IncompatibleSizeException);
+}
+
+TEST_F(MathToolsTest, Distance) {
+  Eigen::VectorXd distances;
+  math_tools::distance(lhs, rhs, distances);
+  for (Eigen::Index i = 0; i < lhs.rows(); ++i) {
+    EXPECT_NEAR(distances(i), quaternion(lhs, i).angularDistance(quaternion(rhs, i)), 1e-12);
+    EXPECT_EQ(distances(i), math_tools::distance(quaternion(lhs, i), quaternion(rhs, i)));
+  }
+  // accurate for small angles and the double cover
+  EXPECT_NEAR(distances(0), 2e-9, 1e-20);
+  EXPECT_NEAR(distances(1), 0, 1e-15);
+  EXPECT_THROW(math_tools::distance(lhs, rhs.topRows(3), distances), exceptions::IncompatibleSizeException);
+}
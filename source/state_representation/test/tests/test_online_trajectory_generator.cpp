@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "state_representation/robot/JointPositions.hpp"
+#include "state_representation/trajectories/OnlineTrajectoryGenerator.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+using namespace state_representation;
+
+class OnlineTrajectoryGeneratorTest : public ::testing::Test {
+protected:
+  OnlineTrajectoryGeneratorTest() :
+      max_velocities(Eigen::Vector3d(1, 2, 0.5)),
+      max_accelerations(Eigen::Vector3d(2, 5, 1)),
+      max_jerks(Eigen::Vector3d(20, 50, 10)),
+      generator(std::chrono::milliseconds(1), max_velocities, max_accelerations, max_jerks) {}
+
+  /**
+   * @brief Run the generator until the target is reached, checking the limits at each cycle
+   * @return the number of cycles
+   */
+  int run(int max_cycles) {
+    int cycles = 0;
+    while (!this->generator.update() && cycles < max_cycles) {
+      ++cycles;
+      EXPECT_TRUE((this->generator.get_velocities().cwiseAbs().array() <= max_velocities.array() + 1e-9).all());
+      EXPECT_TRUE((this->generator.get_accelerations().cwiseAbs().array() <= max_accelerations.array() + 1e-9).all());
+      EXPECT_TRUE(((this->generator.get_accelerations() - this->previous_accelerations).cwiseAbs().array()
+          <= max_jerks.array() * 1e-3 + 1e-9).all());
+      this->previous_accelerations = this->generator.get_accelerations();
+    }
+    return cycles;
+  }
+
+  Eigen::VectorXd max_velocities;
+  Eigen::VectorXd max_accelerations;
+  Eigen::VectorXd max_jerks;
+  OnlineTrajectoryGenerator generator;
+  Eigen::VectorXd previous_accelerations = Eigen::VectorXd::Zero(3);
+};
+
+TEST_F(OnlineTrajectoryGeneratorTest, ReachTarget) {
+  generator.reset(Eigen::Vector3d(0, 1, -1));
+  EXPECT_TRUE(generator.is_target_reached());
+  generator.set_target(Eigen::Vector3d(2, -1, 0.5));
+  int cycles = run(20000);
+  EXPECT_LT(cycles, 20000);
+  EXPECT_TRUE(generator.get_positions().isApprox(Eigen::Vector3d(2, -1, 0.5), 1e-6));
+  // the slowest axis needs at least the time of a cruise at maximum velocity
+  EXPECT_GT(cycles, 1.5 / 0.5 * 1000);
+  EXPECT_THROW(generator.set_target(Eigen::Vector2d(0, 0)), exceptions::IncompatibleSizeException);
+  EXPECT_THROW(OnlineTrajectoryGenerator(std::chrono::milliseconds(0), max_velocities, max_accelerations, max_jerks),
+               exceptions::InvalidParameterException);
+  EXPECT_THROW(OnlineTrajectoryGenerator(std::chrono::milliseconds(1), -max_velocities, max_accelerations, max_jerks),
+               exceptions::InvalidParameterException);
+}
+
+TEST_F(OnlineTrajectoryGeneratorTest, ChangeTargetDuringMotion) {
+  generator.reset(Eigen::Vector3d::Zero());
+  generator.set_target(Eigen::Vector3d(1, 1, 1));
+  for (int i = 0; i < 500; ++i) {
+    generator.update();
+  }
+  EXPECT_GT(generator.get_velocities()(0), 0);
+  // reverse the motion while moving
+  previous_accelerations = generator.get_accelerations();
+  generator.set_target(Eigen::Vector3d(-1, 0, 0));
+  int cycles = run(20000);
+  EXPECT_LT(cycles, 20000);
+  EXPECT_TRUE(generator.get_positions().isApprox(Eigen::Vector3d(-1, 0, 0), 1e-6));
+}
+
+TEST_F(OnlineTrajectoryGeneratorTest, JointStateSetpoint) {
+  JointState current("robot", 3);
+  current.set_positions(Eigen::Vector3d(0.1, 0.2, 0.3));
+  generator.reset(current);
+  JointPositions target("robot", Eigen::Vector3d(0.5, 0.2, 0));
+  generator.set_target(target);
+  JointState setpoint(current);
+  const double* data = setpoint.get_positions().data();
+  while (!generator.update(setpoint)) {}
+  // the setpoint is written in place
+  EXPECT_EQ(setpoint.get_positions().data(), data);
+  EXPECT_TRUE(setpoint.get_positions().isApprox(target.get_positions(), 1e-6));
+}
+
+TEST(CartesianOnlineTrajectoryGeneratorTest, ReachTarget) {
+  CartesianOnlineTrajectoryGenerator generator(std::chrono::milliseconds(1), 1, 2, 20, 1, 2, 20);
+  CartesianState start = CartesianState::Identity("frame");
+  generator.reset(start);
+  CartesianState target("frame");
+  target.set_position(Eigen::Vector3d(0.3, -0.2, 0.1));
+  target.set_orientation(Eigen::Quaterniond(Eigen::AngleAxisd(2, Eigen::Vector3d(1, 1, 0).normalized())));
+  generator.set_target(target);
+  CartesianState setpoint(start);
+  int cycles = 0;
+  while (!generator.update(setpoint) && cycles < 20000) {
+    ++cycles;
+    EXPECT_LE(setpoint.get_angular_velocity().cwiseAbs().maxCoeff(), 1 + 1e-9);
+  }
+  EXPECT_LT(cycles, 20000);
+  EXPECT_TRUE(setpoint.get_position().isApprox(target.get_position()));
+  EXPECT_NEAR(setpoint.get_orientation().angularDistance(target.get_orientation()), 0, 1e-6);
+}
+
+TEST(CartesianOnlineTrajectoryGeneratorTest, ResetDuringMotion) {
+  CartesianOnlineTrajectoryGenerator generator(std::chrono::milliseconds(1), 1, 2, 20, 1, 2, 20);
+  CartesianState start = CartesianState::Identity("frame");
+  start.set_orientation(Eigen::Quaterniond(Eigen::AngleAxisd(1, Eigen::Vector3d::UnitZ())));
+  generator.reset(start);
+  CartesianState target(start);
+  target.set_position(Eigen::Vector3d(0.5, 0.2, 0));
+  target.set_orientation(start.get_orientation() * Eigen::AngleAxisd(1.5, Eigen::Vector3d::UnitX()));
+  generator.set_target(target);
+  CartesianState setpoint(start);
+  for (int i = 0; i < 300; ++i) {
+    generator.update(setpoint);
+  }
+  CartesianState moving(setpoint);
+  ASSERT_GT(moving.get_linear_velocity().norm(), 0.1);
+  ASSERT_GT(moving.get_angular_velocity().norm(), 0.1);
+  // resetting from the moving state continues the motion instead of restarting it from rest
+  generator.reset(moving);
+  generator.set_target(target);
+  generator.update(setpoint);
+  EXPECT_LT((setpoint.get_linear_velocity() - moving.get_linear_velocity()).norm(), 0.01);
+  EXPECT_LT((setpoint.get_angular_velocity() - moving.get_angular_velocity()).norm(), 0.01);
+  int cycles = 0;
+  while (!generator.update(setpoint) && cycles < 20000) {
+    ++cycles;
+  }
+  EXPECT_LT(cycles, 20000);
+  EXPECT_TRUE(setpoint.get_position().isApprox(target.get_position()));
+  EXPECT_NEAR(setpoint.get_orientation().angularDistance(target.get_orientation()), 0, 1e-6);
+}
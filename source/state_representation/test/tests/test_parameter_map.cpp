@@ -0,0 +1,77 @@
+#include "state_representation/parameters/ParameterMap.hpp"
+#include "state_representation/exceptions/IncompatibleSizeException.hpp"
+#include "state_representation/robot/JointPositions.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+
+TEST(ParameterMapTest, AddAndLookup) {
+  ParameterMap map;
+  auto gain = std::make_shared<Parameter<double>>("gain", 1.0);
+  map.add_parameter(gain);
+  map.add_parameter(std::make_shared<Parameter<std::string>>("name", "robot"));
+  EXPECT_THROW(map.add_parameter(std::make_shared<Parameter<double>>("gain", 2.0)),
+               exceptions::InvalidParameterException);
+  EXPECT_THROW(map.add_parameter(nullptr), exceptions::InvalidParameterException);
+  ASSERT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.has_parameter("name"));
+  EXPECT_EQ(map.get_index("name"), 1);
+  EXPECT_EQ(map[0], gain);
+  EXPECT_THROW(map.get_parameter("unknown"), exceptions::InvalidParameterException);
+  EXPECT_THROW(map.get_parameter<bool>("gain"), exceptions::UnrecognizedParameterTypeException);
+
+  // the typed parameter is shared with the owner of the map
+  auto typed_gain = map.get_parameter<double>("gain");
+  gain->set_value(3.0);
+  EXPECT_EQ(typed_gain->get_value(), 3.0);
+
+  std::vector<std::string> names;
+  for (const auto& parameter : map) {
+    names.push_back(parameter->get_name());
+  }
+  EXPECT_EQ(names, std::vector<std::string>({"gain", "name"}));
+  ParameterMap copy(map.to_list());
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy.get_parameter("name"), map.get_parameter("name"));
+}
+
+TEST(ParameterMapTest, FlatValues) {
+  ParameterMap map;
+  map.add_parameter(std::make_shared<Parameter<double>>("gain", 1.0));
+  map.add_parameter(std::make_shared<Parameter<std::string>>("name", "robot"));
+  map.add_parameter(std::make_shared<Parameter<bool>>("enabled", true));
+  map.add_parameter(std::make_shared<Parameter<Eigen::MatrixXd>>("stiffness", Eigen::MatrixXd::Identity(2, 2)));
+  map.add_parameter(std::make_shared<Parameter<CartesianPose>>("attractor", CartesianPose::Identity("A")));
+  auto joints = std::make_shared<Parameter<JointPositions>>("joints", JointPositions::Zero("robot", 3));
+  map.add_parameter(joints);
+
+  EXPECT_EQ(map.get_flat_size(), 1 + 1 + 4 + 7 + 3);
+  EXPECT_EQ(map.get_flat_size(1), 0);
+  EXPECT_EQ(map.get_flat_offset(3), 2);
+  EXPECT_EQ(map.get_flat_offset(5), 13);
+  Eigen::VectorXd values = map.get_flat_values();
+  EXPECT_EQ(values(0), 1.0);
+  EXPECT_EQ(values(1), 1.0);
+  EXPECT_EQ(values(5), 1.0);
+  EXPECT_EQ(values(9), 1.0);
+
+  values(0) = 2.0;
+  values(1) = 0.0;
+  values(4) = 3.0;
+  values.segment<3>(6) << 1.0, 2.0, 3.0;
+  values.tail<3>() << 4.0, 5.0, 6.0;
+  map.set_flat_values(values);
+  EXPECT_EQ(map.get_parameter<double>("gain")->get_value(), 2.0);
+  EXPECT_FALSE(map.get_parameter<bool>("enabled")->get_value());
+  EXPECT_EQ(map.get_parameter<Eigen::MatrixXd>("stiffness")->get_value()(0, 1), 3.0);
+  EXPECT_EQ(map.get_parameter<CartesianPose>("attractor")->get_value().get_position(), Eigen::Vector3d(1, 2, 3));
+  EXPECT_EQ(joints->get_value().get_positions(), Eigen::Vector3d(4, 5, 6));
+  EXPECT_EQ(map.get_flat_values(), values);
+  EXPECT_THROW(map.set_flat_values(Eigen::VectorXd::Zero(3)), exceptions::IncompatibleSizeException);
+
+  // the layout follows the size of the values
+  joints->set_value(JointPositions::Zero("robot", 5));
+  EXPECT_EQ(map.get_flat_size(), 18);
+  EXPECT_EQ(map.get_flat_size(5), 5);
+}
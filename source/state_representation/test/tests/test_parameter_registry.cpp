@@ -0,0 +1,67 @@
+#include "state_representation/parameters/ParameterRegistry.hpp"
+#include <atomic>
+#include <thread>
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+
+TEST(ParameterRegistryTest, HandlesAndUpdate) {
+  ParameterRegistry registry;
+  auto gain = registry.add_parameter<double>("gain", 1.0);
+  auto stiffness = registry.add_parameter(Parameter<Eigen::MatrixXd>("stiffness", Eigen::MatrixXd::Identity(3, 3)));
+  EXPECT_THROW(registry.add_parameter<double>("gain", 2.0), exceptions::InvalidParameterException);
+  EXPECT_EQ(registry.get_size(), 2);
+  EXPECT_EQ(registry.get_name(1), "stiffness");
+  EXPECT_EQ(gain.get_name(), "gain");
+  EXPECT_THROW(registry.get_handle<double>("unknown"), exceptions::InvalidParameterException);
+  EXPECT_THROW(registry.get_handle<bool>("gain"), exceptions::UnrecognizedParameterTypeException);
+
+  std::vector<std::vector<std::size_t>> notifications;
+  registry.add_change_callback([&](const ParameterRegistry&, const std::vector<std::size_t>& changed) {
+    notifications.push_back(changed);
+  });
+
+  // published values are only visible after the update
+  gain.set_value(2.0);
+  registry.set_value<double>("gain", 3.0);
+  registry.set_parameter(std::make_shared<Parameter<Eigen::MatrixXd>>("stiffness", 2 * Eigen::MatrixXd::Identity(3, 3)));
+  EXPECT_EQ(registry.get_handle<double>("gain").get_value(), 1.0);
+  EXPECT_EQ(stiffness.get_value()(0, 0), 1.0);
+  EXPECT_EQ(registry.update(), 2);
+  EXPECT_EQ(gain.get_value(), 3.0);
+  EXPECT_EQ(stiffness.get_value()(0, 0), 2.0);
+  ASSERT_EQ(notifications.size(), 1);
+  EXPECT_EQ(notifications[0], (std::vector<std::size_t>{0, 1}));
+
+  // no notification without change
+  EXPECT_EQ(registry.update(), 0);
+  EXPECT_EQ(notifications.size(), 1);
+  EXPECT_THROW(registry.set_parameter(std::make_shared<Parameter<bool>>("gain", true)),
+               exceptions::UnrecognizedParameterTypeException);
+
+  auto parameters = registry.get_parameters();
+  ASSERT_EQ(parameters.size(), 2);
+  EXPECT_EQ(std::dynamic_pointer_cast<Parameter<double>>(parameters.front())->get_value(), 3.0);
+}
+
+TEST(ParameterRegistryTest, ConsistentSnapshotsAcrossThreads) {
+  ParameterRegistry registry;
+  auto values = registry.add_parameter<Eigen::VectorXd>("values", Eigen::VectorXd::Zero(64));
+  std::atomic<bool> stop(false);
+  std::thread writer([&]() {
+    for (int i = 1; !stop.load(); ++i) {
+      values.set_value(Eigen::VectorXd::Constant(64, i));
+    }
+  });
+  double previous = 0;
+  for (int cycle = 0; cycle < 20000; ++cycle) {
+    registry.update();
+    const Eigen::VectorXd& snapshot = values.get_value();
+    // the writer always publishes vectors with equal elements, the reader never sees a mix of two values
+    EXPECT_EQ(snapshot.minCoeff(), snapshot.maxCoeff());
+    EXPECT_GE(snapshot(0), previous);
+    previous = snapshot(0);
+  }
+  stop = true;
+  writer.join();
+}
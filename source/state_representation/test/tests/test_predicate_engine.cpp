@@ -0,0 +1,66 @@
+#include "state_representation/parameters/PredicateEngine.hpp"
+#include "state_representation/parameters/Event.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+
+TEST(PredicateEngineTest, Conditions) {
+  PredicateEngine engine;
+  engine.add_variable("distance", 1.0);
+  double force = 0;
+  engine.add_variable("force", [&force]() { return force; });
+  EXPECT_THROW(engine.add_variable("force", 0.0), exceptions::InvalidParameterException);
+
+  auto close = engine.add_condition("close", "distance", ComparisonOperator::LESS_EQUAL, 0.1);
+  auto contact = engine.add_condition("contact", "force", ComparisonOperator::GREATER, 5.0);
+  auto grasped = engine.add_all_of("grasped", {"close", "contact"});
+  auto any = engine.add_any_of("any", {"close", "contact"});
+  EXPECT_THROW(engine.add_condition("far", "unknown", ComparisonOperator::LESS, 0.0),
+               exceptions::InvalidParameterException);
+  EXPECT_THROW(engine.add_all_of("close", {"contact"}), exceptions::InvalidParameterException);
+  EXPECT_THROW(engine.add_any_of("none", {"unknown"}), exceptions::InvalidParameterException);
+  EXPECT_THROW(engine.set_threshold(grasped, 1.0), exceptions::InvalidParameterException);
+  EXPECT_THROW(engine.set_threshold(10, 1.0), exceptions::InvalidParameterException);
+  ASSERT_EQ(engine.get_size(), 4);
+  EXPECT_EQ(engine.get_name(any), "any");
+
+  std::vector<std::pair<std::size_t, bool>> edges;
+  std::size_t nb_rising = 0;
+  engine.add_callback("grasped", [&](std::size_t index, bool value) { edges.emplace_back(index, value); });
+  engine.add_callback("any", [&](std::size_t, bool) { ++nb_rising; }, PredicateEdge::RISING);
+  auto event = std::make_shared<Event>("grasp_event");
+  engine.bind_predicate("grasped", event);
+
+  EXPECT_EQ(engine.evaluate(), 0);
+  EXPECT_FALSE(engine.get_value("close"));
+
+  engine.set_variable("distance", 0.1);
+  EXPECT_EQ(engine.evaluate(), 2);
+  EXPECT_TRUE(engine.is_rising(close));
+  EXPECT_TRUE(engine.get_value(any));
+  EXPECT_FALSE(engine.get_value(grasped));
+  EXPECT_EQ(engine.get_changed(), std::vector<std::size_t>({close, any}));
+  EXPECT_EQ(nb_rising, 1);
+
+  force = 6.0;
+  EXPECT_EQ(engine.evaluate(), 2);
+  EXPECT_TRUE(engine.is_rising(contact));
+  EXPECT_TRUE(engine.get_value(grasped));
+  ASSERT_EQ(edges.size(), 1);
+  EXPECT_EQ(edges.back(), std::make_pair(grasped, true));
+  EXPECT_TRUE(event->read_value());
+  EXPECT_FALSE(event->read_value());
+
+  // no change, no notification
+  EXPECT_EQ(engine.evaluate(), 0);
+  EXPECT_FALSE(engine.is_rising(contact));
+  EXPECT_EQ(edges.size(), 1);
+
+  engine.set_threshold(contact, 10.0);
+  EXPECT_EQ(engine.evaluate(), 2);
+  EXPECT_TRUE(engine.is_falling(contact));
+  EXPECT_TRUE(engine.is_falling(grasped));
+  EXPECT_EQ(edges.back(), std::make_pair(grasped, false));
+  EXPECT_EQ(nb_rising, 1);
+  EXPECT_FALSE(event->get_value());
+}
@@ -0,0 +1,153 @@
+#include "state_representation/geometry/ShapeSet.hpp"
+#include "state_representation/exceptions/IncompatibleReferenceFramesException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+
+class ShapeSetTest : public testing::Test {
+protected:
+  void SetUp() override {
+    std::srand(42);
+    for (int i = 0; i < 40; ++i) {
+      Ellipsoid ellipsoid("obstacle" + std::to_string(i));
+      ellipsoid.set_center_position(10 * Eigen::Vector3d::Random());
+      ellipsoid.set_axis_lengths({1.5 + Eigen::Vector2d::Random()(0), 1 + 0.5 * Eigen::Vector2d::Random()(1)});
+      ellipsoid.set_rotation_angle(M_PI * Eigen::Vector2d::Random()(0));
+      if (i % 10 == 0) {
+        // a few tilted shapes unbounded in all the directions of the reference frame
+        ellipsoid.set_center_orientation(Eigen::Quaterniond::UnitRandom());
+      }
+      ellipsoids.push_back(ellipsoid);
+      set.add(ellipsoid);
+    }
+    points = 12 * Eigen::Matrix3Xd::Random(3, 200);
+  }
+
+  std::vector<Ellipsoid> ellipsoids;
+  ShapeSet set;
+  Eigen::Matrix3Xd points;
+};
+
+TEST_F(ShapeSetTest, Construction) {
+  EXPECT_EQ(set.get_size(), 40);
+  EXPECT_EQ(set.get_name(3), "obstacle3");
+  EXPECT_EQ(set.get_reference_frame(), "world");
+  EXPECT_THROW(set.add(Ellipsoid("other", "robot")), exceptions::IncompatibleReferenceFramesException);
+  Ellipsoid flat("flat");
+  flat.set_axis_lengths({1., 0.});
+  EXPECT_THROW(set.add(flat), exceptions::InvalidParameterException);
+  EXPECT_EQ(set.get_size(), 40);
+  set.clear();
+  EXPECT_EQ(set.get_size(), 0);
+  double distance;
+  EXPECT_EQ(set.nearest(Eigen::Vector3d::Zero(), distance), -1);
+}
+
+TEST_F(ShapeSetTest, BatchedQueries) {
+  Eigen::MatrixXd distances;
+  Eigen::Array<bool, Eigen::Dynamic, Eigen::Dynamic> inside;
+  set.signed_distances(points, distances);
+  set.contains(points, inside);
+  ASSERT_EQ(distances.rows(), 40);
+  ASSERT_EQ(distances.cols(), 200);
+  Eigen::VectorXd point_distances;
+  Eigen::Matrix3Xd normals;
+  for (Eigen::Index j = 0; j < points.cols(); ++j) {
+    set.evaluate(points.col(j), point_distances, normals);
+    EXPECT_TRUE(point_distances.isApprox(distances.col(j)));
+    for (std::size_t i = 0; i < ellipsoids.size(); ++i) {
+      EXPECT_NEAR(distances(i, j), ellipsoids[i].signed_distance(points.col(j)), 1e-9);
+      EXPECT_EQ(inside(i, j), ellipsoids[i].is_inside(points.col(j)));
+      EXPECT_TRUE(normals.col(i).isApprox(ellipsoids[i].get_normal(points.col(j)), 1e-9));
+    }
+    EXPECT_EQ(set.contains_any(points.col(j)), inside.col(j).any());
+  }
+}
+
+TEST_F(ShapeSetTest, Hierarchy) {
+  Eigen::MatrixXd distances;
+  set.signed_distances(points, distances);
+  EXPECT_FALSE(set.has_hierarchy());
+  set.build_hierarchy();
+  EXPECT_TRUE(set.has_hierarchy());
+  for (Eigen::Index j = 0; j < points.cols(); ++j) {
+    Eigen::Index expected_nearest;
+    double expected_distance = distances.col(j).minCoeff(&expected_nearest);
+    double distance;
+    EXPECT_EQ(set.nearest(points.col(j), distance), expected_nearest);
+    EXPECT_EQ(distance, expected_distance);
+
+    std::vector<std::size_t> indices;
+    set.query(points.col(j), 2., indices);
+    std::vector<std::size_t> expected_indices;
+    for (Eigen::Index i = 0; i < distances.rows(); ++i) {
+      if (distances(i, j) < 2.) {
+        expected_indices.push_back(static_cast<std::size_t>(i));
+      }
+    }
+    EXPECT_EQ(indices, expected_indices);
+
+    Eigen::VectorXd near_distances;
+    Eigen::Matrix3Xd near_normals;
+    set.query(points.col(j), 2., indices, near_distances, near_normals);
+    EXPECT_EQ(indices, expected_indices);
+    for (std::size_t k = 0; k < indices.size(); ++k) {
+      EXPECT_EQ(near_distances(k), distances(indices[k], j));
+      EXPECT_TRUE(near_normals.col(k).isApprox(ellipsoids[indices[k]].get_normal(points.col(j)), 1e-9));
+    }
+  }
+
+  // moving shapes refits the hierarchy, which stays up to date
+  for (std::size_t i = 0; i < 10; ++i) {
+    ellipsoids[i].set_center_position(points.col(static_cast<Eigen::Index>(i)));
+    set.set(i, ellipsoids[i]);
+  }
+  EXPECT_TRUE(set.has_hierarchy());
+  set.signed_distances(points, distances);
+  for (Eigen::Index j = 0; j < points.cols(); ++j) {
+    Eigen::Index expected_nearest;
+    double expected_distance = distances.col(j).minCoeff(&expected_nearest);
+    double distance;
+    EXPECT_EQ(set.nearest(points.col(j), distance), expected_nearest);
+    EXPECT_EQ(distance, expected_distance);
+    std::vector<std::size_t> indices;
+    set.query(points.col(j), 2., indices);
+    EXPECT_EQ(indices.size(), static_cast<std::size_t>((distances.col(j).array() < 2.).count()));
+  }
+  double distance;
+  EXPECT_EQ(set.nearest(points.col(0), distance), 0);
+  EXPECT_LT(distance, 0);
+
+  // adding a shape invalidates the hierarchy, the queries falling back to all the shapes
+  set.add(ellipsoids[0]);
+  EXPECT_FALSE(set.has_hierarchy());
+  EXPECT_EQ(set.nearest(points.col(0), distance), 0);
+  set.build_hierarchy();
+  EXPECT_TRUE(set.has_hierarchy());
+}
+
+TEST_F(ShapeSetTest, DeepHierarchy) {
+  // many shapes along a line give a deep hierarchy, traversed without allocation
+  ShapeSet line;
+  for (int i = 0; i < 1000; ++i) {
+    Ellipsoid ellipsoid("obstacle" + std::to_string(i));
+    ellipsoid.set_center_position(Eigen::Vector3d(i, 0, 0));
+    ellipsoid.set_axis_lengths({0.2, 0.1});
+    line.add(ellipsoid);
+  }
+  line.build_hierarchy();
+  Eigen::VectorXd distances;
+  std::vector<std::size_t> indices;
+  for (Eigen::Index j = 0; j < 20; ++j) {
+    Eigen::Vector3d point = points.col(j) + Eigen::Vector3d(50 * j, 0, 0);
+    line.signed_distances(point, distances);
+    Eigen::Index expected_nearest;
+    double expected_distance = distances.minCoeff(&expected_nearest);
+    double distance;
+    EXPECT_EQ(line.nearest(point, distance), expected_nearest);
+    EXPECT_EQ(distance, expected_distance);
+    line.query(point, 3., indices);
+    EXPECT_EQ(indices.size(), static_cast<std::size_t>((distances.array() < 3.).count()));
+  }
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "state_representation/trajectories/CartesianSpline.hpp"
+#include "state_representation/trajectories/JointSpline.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+using namespace state_representation;
+
+TEST(SplineTest, CubicSplineInterpolation) {
+  Eigen::VectorXd times(4);
+  times << 0, 1, 2.5, 3;
+  Eigen::MatrixXd points(2, 4);
+  points << 0, 1, -1, 2,
+            3, 3, 4, 0;
+  CubicSpline spline(times, points);
+  EXPECT_EQ(spline.dimension(), 2);
+  EXPECT_DOUBLE_EQ(spline.get_duration(), 3);
+  for (Eigen::Index i = 0; i < times.size(); ++i) {
+    EXPECT_TRUE(spline.evaluate(times(i)).isApprox(points.col(i)));
+  }
+  // rest at both ends and continuity of the derivatives at the knots
+  EXPECT_TRUE(spline.evaluate(1e-9, 1).isZero(1e-6));
+  EXPECT_TRUE(spline.evaluate(3 - 1e-9, 1).isZero(1e-6));
+  for (unsigned int derivative : {1, 2}) {
+    EXPECT_TRUE(spline.evaluate(1 - 1e-9, derivative).isApprox(spline.evaluate(1 + 1e-9, derivative), 1e-5));
+  }
+  // the derivatives match finite differences
+  double dt = 1e-6;
+  Eigen::VectorXd velocity = (spline.evaluate(1.7 + dt) - spline.evaluate(1.7 - dt)) / (2 * dt);
+  EXPECT_TRUE(spline.evaluate(1.7, 1).isApprox(velocity, 1e-6));
+  Eigen::VectorXd acceleration = (spline.evaluate(1.7 + dt, 1) - spline.evaluate(1.7 - dt, 1)) / (2 * dt);
+  EXPECT_TRUE(spline.evaluate(1.7, 2).isApprox(acceleration, 1e-6));
+
+  Eigen::MatrixXd values = spline.evaluate(Eigen::VectorXd::LinSpaced(7, 0, 3));
+  EXPECT_EQ(values.cols(), 7);
+  EXPECT_TRUE(values.col(2).isApprox(spline.evaluate(1.0)));
+  EXPECT_TRUE(spline.evaluate(-1e-9, 1).isZero());
+  EXPECT_TRUE(spline.evaluate(3 + 1e-9, 2).isZero());
+  // the boundary velocities and accelerations are kept at the end knots
+  Eigen::Vector2d start_velocity(1, -2);
+  Eigen::Vector2d end_velocity(0.5, 0);
+  CubicSpline clamped(times, points, start_velocity, end_velocity);
+  EXPECT_TRUE(clamped.evaluate(0, 1).isApprox(start_velocity));
+  EXPECT_TRUE(clamped.evaluate(3, 1).isApprox(end_velocity));
+  EXPECT_TRUE(clamped.evaluate(0, 2).isApprox(clamped.evaluate(1e-9, 2), 1e-6));
+  EXPECT_TRUE(clamped.evaluate(3, 2).isApprox(clamped.evaluate(3 - 1e-9, 2), 1e-6));
+  EXPECT_THROW(CubicSpline(Eigen::Vector2d(1, 0), Eigen::MatrixXd::Zero(2, 2)),
+               exceptions::InvalidParameterException);
+  EXPECT_THROW(CubicSpline().evaluate(0), exceptions::EmptyStateException);
+}
+
+TEST(SplineTest, CubicSplineRetiming) {
+  Eigen::MatrixXd points(2, 3);
+  points << 0, 1, 3,
+            0, -2, 1;
+  Eigen::Vector2d max_velocities(1, 2);
+  Eigen::Vector2d max_accelerations(4, 3);
+  CubicSpline spline = CubicSpline::from_waypoints(points, max_velocities, max_accelerations);
+  // sampled derivatives are within the limits and at least one limit is reached
+  Eigen::MatrixXd velocities = spline.evaluate(spline.get_uniform_times(1e-3), 1);
+  Eigen::MatrixXd accelerations = spline.evaluate(spline.get_uniform_times(1e-3), 2);
+  Eigen::ArrayXd velocity_ratio = velocities.cwiseAbs().rowwise().maxCoeff().array() / max_velocities.array();
+  Eigen::ArrayXd acceleration_ratio =
+      accelerations.cwiseAbs().rowwise().maxCoeff().array() / max_accelerations.array();
+  EXPECT_LE(velocity_ratio.maxCoeff(), 1 + 1e-6);
+  EXPECT_LE(acceleration_ratio.maxCoeff(), 1 + 1e-6);
+  EXPECT_GT(std::max(velocity_ratio.maxCoeff(), acceleration_ratio.maxCoeff()), 0.99);
+
+  double duration = spline.get_duration();
+  spline.scale_time(2);
+  EXPECT_DOUBLE_EQ(spline.get_duration(), 2 * duration);
+  EXPECT_NEAR(spline.retime(max_velocities, max_accelerations), 0.5, 1e-9);
+  EXPECT_NEAR(spline.get_duration(), duration, 1e-9);
+}
+
+TEST(SplineTest, JointSpline) {
+  Trajectory<JointPositions> trajectory("trajectory");
+  JointPositions point("robot", 3);
+  std::vector<JointPositions> waypoints;
+  for (int i = 0; i < 4; ++i) {
+    point.set_positions(Eigen::Vector3d::Random());
+    waypoints.push_back(point);
+    trajectory.add_point(point, std::chrono::milliseconds(i == 0 ? 0 : 500));
+  }
+  JointSpline spline(trajectory);
+  EXPECT_EQ(spline.get_name(), "robot");
+  EXPECT_EQ(spline.get_duration(), std::chrono::milliseconds(1500));
+  JointState state = spline.sample(std::chrono::milliseconds(500));
+  EXPECT_TRUE(state.get_positions().isApprox(waypoints[1].get_positions()));
+  EXPECT_EQ(state.get_shared_names(), point.get_shared_names());
+
+  Eigen::MatrixXd positions = spline.sample_uniformly(std::chrono::milliseconds(1));
+  EXPECT_EQ(positions.cols(), 1501);
+  EXPECT_TRUE(positions.col(1500).isApprox(waypoints[3].get_positions()));
+  Trajectory<JointPositions> sampled = spline.to_trajectory(std::chrono::milliseconds(100));
+  EXPECT_EQ(sampled.get_size(), 16);
+  EXPECT_EQ(sampled.get_times().back(), std::chrono::milliseconds(1500));
+
+  JointSpline timed(waypoints, Eigen::Vector3d::Constant(1), Eigen::Vector3d::Constant(2));
+  Eigen::MatrixXd velocities = timed.sample_uniformly(std::chrono::milliseconds(1), 1);
+  EXPECT_LE(velocities.cwiseAbs().maxCoeff(), 1 + 1e-6);
+}
+
+TEST(SplineTest, CartesianSpline) {
+  Trajectory<CartesianPose> trajectory("trajectory");
+  CartesianPose start("frame", Eigen::Vector3d(0, 0, 0), Eigen::Quaterniond::Identity());
+  CartesianPose middle("frame", Eigen::Vector3d(1, 0, 0),
+                       Eigen::Quaterniond(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ())));
+  CartesianPose end("frame", Eigen::Vector3d(1, 1, 0),
+                    Eigen::Quaterniond(Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ())));
+  trajectory.add_point(start, std::chrono::seconds(0));
+  trajectory.add_point(middle, std::chrono::seconds(1));
+  trajectory.add_point(end, std::chrono::seconds(1));
+  CartesianSpline spline(trajectory);
+  EXPECT_EQ(spline.get_name(), "frame");
+  EXPECT_EQ(spline.get_duration(), std::chrono::seconds(2));
+
+  CartesianState state = spline.sample(std::chrono::seconds(1));
+  EXPECT_TRUE(state.get_position().isApprox(middle.get_position()));
+  EXPECT_NEAR(state.get_orientation().angularDistance(middle.get_orientation()), 0, 1e-9);
+  // the rotation is about the z axis only
+  CartesianState halfway = spline.sample(std::chrono::milliseconds(500));
+  EXPECT_NEAR(halfway.get_angular_velocity().head(2).norm(), 0, 1e-6);
+  EXPECT_GT(halfway.get_angular_velocity()(2), 0);
+  // the orientation does not start at rest
+  EXPECT_GT(spline.sample(std::chrono::seconds(0)).get_angular_velocity()(2), 0);
+
+  Eigen::MatrixXd poses = spline.sample_uniformly(std::chrono::milliseconds(10));
+  EXPECT_EQ(poses.cols(), 201);
+  EXPECT_TRUE(poses.col(200).head(3).isApprox(end.get_position()));
+
+  CartesianSpline timed({start, middle, end}, 0.5, 1, 1, 2);
+  Trajectory<CartesianPose> sampled = timed.to_trajectory(std::chrono::milliseconds(1));
+  double max_angular_velocity = 0;
+  for (int i = 1; i < sampled.get_size(); ++i) {
+    max_angular_velocity = std::max(max_angular_velocity,
+                                    sampled.get_point(i).get_orientation().angularDistance(
+                                        sampled.get_point(i - 1).get_orientation()) / 1e-3);
+  }
+  EXPECT_LE(max_angular_velocity, 1 + 1e-2);
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/robot/JointPositions.hpp"
+#include "state_representation/exceptions/EmptyStateException.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+
+using namespace state_representation;
+
+class StateTest : public ::testing::Test {
+protected:
+  void TearDown() override {
+    State::set_timestamp_policy(TimestampPolicy::EAGER);
+    State::set_cycle_time({});
+    State::set_clock(nullptr);
+  }
+};
+
+TEST_F(StateTest, EagerTimestamps) {
+  EXPECT_EQ(State::get_timestamp_policy(), TimestampPolicy::EAGER);
+  CartesianPose pose = CartesianPose::Identity("test");
+  auto timestamp = pose.get_timestamp();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  pose.set_position(1, 2, 3);
+  EXPECT_GT(pose.get_timestamp(), timestamp);
+}
+
+TEST_F(StateTest, ExplicitTimestamps) {
+  CartesianPose pose = CartesianPose::Identity("test");
+  State::set_timestamp_policy(TimestampPolicy::EXPLICIT);
+  auto timestamp = pose.get_timestamp();
+  pose.set_position(1, 2, 3);
+  CartesianPose copy(pose);
+  EXPECT_EQ(pose.get_timestamp(), timestamp);
+  EXPECT_EQ(copy.get_timestamp(), timestamp);
+  pose.reset_timestamp();
+  EXPECT_GT(pose.get_timestamp(), timestamp);
+  // new states are stamped with the current time
+  CartesianPose fresh("fresh");
+  EXPECT_FALSE(fresh.is_deprecated(std::chrono::seconds(1)));
+}
+
+TEST_F(StateTest, CycleTimestamps) {
+  State::set_timestamp_policy(TimestampPolicy::CYCLE);
+  // before the first cycle the clock is read
+  CartesianPose early("early");
+  EXPECT_FALSE(early.is_deprecated(std::chrono::seconds(1)));
+  early.set_position(1, 2, 3);
+  EXPECT_FALSE(early.is_deprecated(std::chrono::seconds(1)));
+  for (int tick = 0; tick < 3; ++tick) {
+    auto cycle_time = State::start_cycle();
+    EXPECT_EQ(State::get_cycle_time(), cycle_time);
+    CartesianPose pose = CartesianPose::Random("test");
+    JointPositions positions = JointPositions::Random("robot", 3);
+    for (int i = 0; i < 20; ++i) {
+      pose.set_position(pose.get_position() * 0.5);
+      positions.set_positions(positions.get_positions() * 0.5);
+    }
+    EXPECT_EQ(pose.get_timestamp(), cycle_time);
+    EXPECT_EQ(positions.get_timestamp(), cycle_time);
+  }
+  auto timestamp = std::chrono::steady_clock::time_point(std::chrono::seconds(10));
+  State::set_cycle_time(timestamp);
+  CartesianPose pose = CartesianPose::Identity("test");
+  EXPECT_EQ(pose.get_timestamp(), timestamp);
+
+  // the policy is set per thread
+  std::thread other([] { EXPECT_EQ(State::get_timestamp_policy(), TimestampPolicy::EAGER); });
+  other.join();
+}
+
+TEST_F(StateTest, CheckedOperations) {
+  CartesianPose pose("test");
+  if (CHECKED_OPERATIONS) {
+    EXPECT_THROW(pose * pose, exceptions::EmptyStateException);
+  }
+}
+
+TEST_F(StateTest, SimulatedClock) {
+  auto clock = std::make_shared<SimulatedClock>();
+  State::set_clock(clock);
+  EXPECT_EQ(State::get_clock(), clock);
+  CartesianPose pose = CartesianPose::Identity("test");
+  EXPECT_EQ(pose.get_timestamp(), Clock::time_point());
+  // a second of control at 1 kHz, without waiting
+  for (int i = 0; i < 1000; ++i) {
+    clock->step(std::chrono::milliseconds(1));
+    EXPECT_FALSE(pose.is_deprecated(std::chrono::milliseconds(10)));
+    pose.set_position(pose.get_position() + Eigen::Vector3d::UnitX() * 1e-3);
+  }
+  EXPECT_EQ(pose.get_timestamp(), Clock::time_point(std::chrono::seconds(1)));
+  clock->step(std::chrono::milliseconds(20));
+  EXPECT_TRUE(pose.is_deprecated(std::chrono::milliseconds(10)));
+
+  State::set_timestamp_policy(TimestampPolicy::CYCLE);
+  clock->set_time(Clock::time_point(std::chrono::seconds(5)));
+  EXPECT_EQ(State::start_cycle(), Clock::time_point(std::chrono::seconds(5)));
+
+  State::set_clock(nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<SteadyClock>(State::get_clock()), nullptr);
+}
+
+TEST_F(StateTest, ReplaceClockWhileReading) {
+  std::atomic<bool> done(false);
+  std::thread reader([&done] {
+    while (!done) {
+      CartesianPose pose = CartesianPose::Identity("test");
+      EXPECT_NE(State::get_clock(), nullptr);
+    }
+  });
+  for (int i = 0; i < 1000; ++i) {
+    State::set_clock(std::make_shared<SimulatedClock>(Clock::time_point(std::chrono::seconds(i))));
+  }
+  done = true;
+  reader.join();
+}
+
+TEST_F(StateTest, SharedMemoryClock) {
+  std::atomic<uint64_t> ticks(0);
+  auto clock = std::make_shared<SharedMemoryClock>(&ticks, std::chrono::microseconds(125));
+  State::set_clock(clock);
+  ticks = 8000;
+  CartesianPose pose = CartesianPose::Identity("test");
+  EXPECT_EQ(pose.get_timestamp(), Clock::time_point(std::chrono::seconds(1)));
+  EXPECT_THROW(SharedMemoryClock(nullptr, std::chrono::microseconds(125)),
+               exceptions::InvalidParameterException);
+
+  std::string name = "/state_representation_test_ticks_" + std::to_string(::getpid());
+  int descriptor = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+  ASSERT_GE(descriptor, 0);
+  ASSERT_EQ(::ftruncate(descriptor, 16), 0);
+  void* data = ::mmap(nullptr, 16, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  ::close(descriptor);
+  ASSERT_NE(data, MAP_FAILED);
+  auto* counter = new(static_cast<char*>(data) + 8) std::atomic<uint64_t>(0);
+  {
+    SharedMemoryClock shared_clock(name, std::chrono::milliseconds(1), 8);
+    counter->fetch_add(42);
+    EXPECT_EQ(shared_clock.get_ticks(), 42);
+    EXPECT_EQ(shared_clock.now(), Clock::time_point(std::chrono::milliseconds(42)));
+    EXPECT_THROW(SharedMemoryClock(name, std::chrono::milliseconds(1), 16),
+                 exceptions::InvalidParameterException);
+    EXPECT_THROW(SharedMemoryClock(name, std::chrono::milliseconds(1), 4),
+                 exceptions::InvalidParameterException);
+  }
+  ::munmap(data, 16);
+  ::shm_unlink(name.c_str());
+  EXPECT_THROW(SharedMemoryClock(name, std::chrono::milliseconds(1)), exceptions::InvalidParameterException);
+}
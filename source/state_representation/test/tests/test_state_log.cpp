@@ -0,0 +1,167 @@
+#include "state_representation/serialization/StateLog.hpp"
+#include "state_representation/exceptions/InvalidParameterException.hpp"
+#include "state_representation/exceptions/SerializationException.hpp"
+#include "state_representation/serialization/LittleEndian.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace state_representation;
+using namespace state_representation::serialization;
+using namespace std::chrono_literals;
+
+class StateLogTest : public testing::Test {
+protected:
+  void SetUp() override {
+    path = testing::TempDir() + "state_log_test.srlog";
+  }
+
+  void TearDown() override {
+    std::remove(path.c_str());
+  }
+
+  std::string path;
+};
+
+TEST_F(StateLogTest, WriteAndRead) {
+  std::vector<JointState> joint_states;
+  std::vector<CartesianState> cartesian_states;
+  {
+    // a small queue forces the records to wrap around
+    StateLogWriter writer(path, 4096, 100us);
+    uint16_t joints = writer.add_channel("joints");
+    uint16_t pose = writer.add_channel("pose");
+    for (int i = 0; i < 200; ++i) {
+      joint_states.push_back(JointState::Random("robot", 7));
+      cartesian_states.push_back(CartesianState::Random("ee", "base"));
+      while (!writer.write(joints, i * 1ms, joint_states.back())) {
+        std::this_thread::sleep_for(100us);
+      }
+      while (!writer.write(pose, i * 2ms, cartesian_states.back())) {
+        std::this_thread::sleep_for(100us);
+      }
+    }
+    EXPECT_THROW(writer.write(joints, 10ms, joint_states.front()), exceptions::InvalidParameterException);
+    EXPECT_THROW(writer.add_channel("joints"), exceptions::InvalidParameterException);
+  }
+  StateLogReader reader(path);
+  EXPECT_TRUE(reader.is_indexed());
+  ASSERT_EQ(reader.get_number_of_channels(), 2);
+  uint16_t joints = reader.find_channel("joints");
+  uint16_t pose = reader.find_channel("pose");
+  EXPECT_EQ(reader.get_channel_name(pose), "pose");
+  EXPECT_THROW(reader.find_channel("unknown"), exceptions::InvalidParameterException);
+  ASSERT_EQ(reader.get_size(joints), 200);
+  ASSERT_EQ(reader.get_size(pose), 200);
+  EXPECT_EQ(reader.get_time(pose, 10), 20ms);
+
+  EXPECT_EQ(reader.find_index(joints, -1ms), -1);
+  EXPECT_EQ(reader.find_index(joints, 42ms), 42);
+  EXPECT_EQ(reader.find_index(pose, 43ms), 21);
+  EXPECT_EQ(reader.find_index(pose, 1s), 199);
+
+  JointState joint_state("robot", 7);
+  reader.read(joints, 42, joint_state);
+  EXPECT_EQ((joint_state.data() - joint_states[42].data()).norm(), 0);
+  CartesianState cartesian_state;
+  reader.read(pose, 21, cartesian_state);
+  EXPECT_EQ(cartesian_state.get_name(), "ee");
+  EXPECT_NEAR((cartesian_state.data() - cartesian_states[21].data()).norm(), 0, 1e-15);
+
+  std::size_t size;
+  const uint8_t* message = reader.get_message(joints, 3, size);
+  JointStateView view = decode_joint_state_view(message, size);
+  EXPECT_EQ(view.get_positions(), joint_states[3].get_positions());
+  EXPECT_THROW(reader.get_message(joints, 200, size), exceptions::InvalidParameterException);
+}
+
+TEST_F(StateLogTest, WriteError) {
+  if (!std::filesystem::exists("/dev/full")) {
+    GTEST_SKIP() << "Writing to a full device requires /dev/full";
+  }
+  StateLogWriter writer("/dev/full", 1 << 16, 100us);
+  uint16_t joints = writer.add_channel("joints");
+  JointState joint_state = JointState::Random("robot", 7);
+  // the states overflow the buffer of the file, of which the write fails in the background thread
+  auto write_states = [&] {
+    for (int i = 0; i < 1000; ++i) {
+      while (!writer.write(joints, i * 1ms, joint_state)) {
+        std::this_thread::sleep_for(100us);
+      }
+    }
+    writer.flush();
+  };
+  EXPECT_THROW(write_states(), exceptions::SerializationException);
+  EXPECT_THROW(writer.write(joints, 1s, joint_state), exceptions::SerializationException);
+  EXPECT_THROW(writer.close(), exceptions::SerializationException);
+  EXPECT_THROW(writer.write(joints, 2s, joint_state), exceptions::SerializationException);
+}
+
+TEST_F(StateLogTest, Trajectory) {
+  Trajectory<CartesianPose> trajectory("trajectory");
+  for (int i = 0; i < 10; ++i) {
+    trajectory.add_point(CartesianPose::Random("ee"), 10ms);
+  }
+  {
+    StateLogWriter writer(path);
+    uint16_t channel = writer.add_channel("trajectory");
+    writer.write_trajectory(channel, trajectory, 1s);
+  }
+  StateLogReader reader(path);
+  auto loaded = reader.read_trajectory<CartesianPose>(0);
+  ASSERT_EQ(loaded.get_size(), 10);
+  EXPECT_EQ(loaded.get_name(), "trajectory");
+  EXPECT_EQ(loaded.get_times()[0], 1010ms);
+  EXPECT_EQ(loaded.get_times()[9], 1100ms);
+  EXPECT_TRUE(loaded.get_point(4).data().isApprox(trajectory.get_point(4).data()));
+  auto interval = reader.read_trajectory<CartesianPose>(0, 1030ms, 1055ms);
+  ASSERT_EQ(interval.get_size(), 3);
+  EXPECT_EQ(interval.get_times()[0], 1030ms);
+}
+
+TEST_F(StateLogTest, LogWithoutIndex) {
+  {
+    StateLogWriter writer(path);
+    uint16_t channel = writer.add_channel("joints");
+    for (int i = 0; i < 5; ++i) {
+      writer.write(channel, i * 1ms, JointState::Random("robot", 3));
+    }
+  }
+  // remove the index (128 bytes) and part of the last record as if the writer had been interrupted
+  std::size_t file_size = std::filesystem::file_size(path);
+  std::filesystem::resize_file(path, file_size - 200);
+  StateLogReader reader(path);
+  EXPECT_FALSE(reader.is_indexed());
+  ASSERT_EQ(reader.get_number_of_channels(), 1);
+  EXPECT_EQ(reader.get_channel_name(0), "joints");
+  EXPECT_EQ(reader.get_size(0), 4);
+  EXPECT_EQ(reader.find_index(0, 10ms), 3);
+  JointState state("robot", 3);
+  EXPECT_NO_THROW(reader.read(0, 3, state));
+
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a log";
+  EXPECT_THROW(StateLogReader{path}, exceptions::SerializationException);
+}
+
+TEST_F(StateLogTest, LittleEndianLayout) {
+  {
+    StateLogWriter writer(path);
+    uint16_t channel = writer.add_channel("a");
+    writer.write(channel, 258ns, JointState::Random("robot", 1));
+  }
+  std::ifstream file(path, std::ios::binary);
+  std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  ASSERT_GT(bytes.size(), 80);
+  // the version in the header of the file
+  EXPECT_EQ(bytes[8], STATE_LOG_FORMAT_VERSION);
+  EXPECT_EQ(load_little_endian<uint32_t>(bytes.data() + 8), STATE_LOG_FORMAT_VERSION);
+  // the declaration of the channel after the header, then the state with its time of 0x0102 nanoseconds
+  EXPECT_EQ(load_little_endian<uint16_t>(bytes.data() + 32), static_cast<uint16_t>(StateLogRecordKind::CHANNEL));
+  EXPECT_EQ(load_little_endian<uint32_t>(bytes.data() + 36), 16);
+  EXPECT_EQ(load_little_endian<uint16_t>(bytes.data() + 64), static_cast<uint16_t>(StateLogRecordKind::STATE));
+  EXPECT_EQ(bytes[72], 0x02);
+  EXPECT_EQ(bytes[73], 0x01);
+  // the trailer points to the index
+  EXPECT_EQ(load_little_endian<uint64_t>(bytes.data() + bytes.size() - 16), 1);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include "state_representation/StateVariant.hpp"
+#include "state_representation/space/cartesian/CartesianStateSlice.hpp"
+
+using namespace state_representation;
+
+TEST(StateVariantTest, Visit) {
+  std::vector<StateVariant> states;
+  states.emplace_back(CartesianPose::Random("pose"));
+  states.emplace_back(CartesianTwist::Random("twist"));
+  states.emplace_back(JointPositions::Random("robot", 3));
+  states.emplace_back(JointVelocities::Random("robot", 3));
+
+  std::vector<std::string> types;
+  for (const auto& state : states) {
+    types.push_back(std::visit(Overloaded{[](const CartesianPose&) { return std::string("pose"); },
+                                          [](const CartesianTwist&) { return std::string("twist"); },
+                                          [](const JointPositions&) { return std::string("positions"); },
+                                          [](const auto&) { return std::string("other"); }}, state));
+  }
+  EXPECT_EQ(types, std::vector<std::string>({"pose", "twist", "positions", "other"}));
+
+  EXPECT_EQ(get_state(states[1]).get_name(), "twist");
+  EXPECT_EQ(&get_state(states[0]), &std::get<CartesianPose>(states[0]));
+
+  CartesianStateVariant cartesian = CartesianTwist::Random("twist");
+  const CartesianState& twist = get_state_as<CartesianState>(cartesian);
+  EXPECT_EQ(&twist, &std::get<CartesianTwist>(cartesian));
+  JointStateVariant joints = JointTorques::Random("robot", 3);
+  EXPECT_EQ(get_state_as<JointState>(joints).get_size(), 3);
+
+  static_assert(is_variant_alternative_v<CartesianWrench, StateVariant>);
+  static_assert(!is_variant_alternative_v<JointState, CartesianStateVariant>);
+}
+
+TEST(StateVariantTest, Slices) {
+  CartesianState state = CartesianState::Random("ee", "base");
+  CartesianPoseSlice pose(state);
+  CartesianTwistSlice twist(state);
+  CartesianWrenchSlice wrench(state);
+  EXPECT_EQ(pose.get_name(), "ee");
+  EXPECT_EQ(twist.get_reference_frame(), "base");
+  EXPECT_FALSE(wrench.is_empty());
+  EXPECT_EQ(&pose.get_position(), &state.get_position());
+  EXPECT_EQ(&pose.get_orientation(), &state.get_orientation());
+  EXPECT_EQ(&twist.get_linear_velocity(), &state.get_linear_velocity());
+  EXPECT_EQ(&twist.get_angular_velocity(), &state.get_angular_velocity());
+  EXPECT_EQ(&wrench.get_force(), &state.get_force());
+  EXPECT_EQ(&wrench.get_torque(), &state.get_torque());
+  EXPECT_EQ(pose.get_typed_position().get_value().data(), state.get_position().data());
+  EXPECT_EQ(twist.get_typed_angular_velocity().get_value().data(), state.get_angular_velocity().data());
+
+  // the slices follow the changes of the state
+  state.set_position(1, 2, 3);
+  EXPECT_EQ(pose.get_position(), Eigen::Vector3d(1, 2, 3));
+  CartesianPose copy = pose.copy();
+  EXPECT_EQ(copy.get_position(), state.get_position());
+  EXPECT_EQ(twist.copy().get_twist(), state.get_twist());
+  EXPECT_EQ(wrench.copy().get_wrench(), state.get_wrench());
+
+  CartesianTwist typed_twist = CartesianTwist::Random("ee");
+  EXPECT_EQ(&CartesianTwistSlice(typed_twist).get_state(), &typed_twist);
+
+  static_assert(!std::is_constructible_v<CartesianTwistSlice, const CartesianPose&>);
+  static_assert(!std::is_constructible_v<CartesianPoseSlice, const CartesianWrench&>);
+  static_assert(!std::is_constructible_v<CartesianWrenchSlice, CartesianState&&>);
+}
@@ -88,6 +88,64 @@ TEST(TrajectoryTest, OverloadIndex) {
   EXPECT_TRUE(point1.second == 2 * period);
 }
 
+TEST(TrajectoryTest, FindIndexAndSample) {
+  state_representation::Trajectory<state_representation::JointState> trajectory;
+  EXPECT_THROW(trajectory.sample(std::chrono::nanoseconds(0)),
+               state_representation::exceptions::EmptyStateException);
+  state_representation::JointState point("robot", 2);
+  for (int i = 0; i < 5; ++i) {
+    point.set_positions(Eigen::VectorXd::Constant(2, i));
+    trajectory.add_point(point, std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(trajectory.find_index(std::chrono::milliseconds(5)), -1);
+  EXPECT_EQ(trajectory.find_index(std::chrono::milliseconds(10)), 0);
+  EXPECT_EQ(trajectory.find_index(std::chrono::milliseconds(35)), 2);
+  EXPECT_EQ(trajectory.find_index(std::chrono::milliseconds(100)), 4);
+
+  EXPECT_DOUBLE_EQ(trajectory.sample(std::chrono::milliseconds(0)).get_positions()(0), 0);
+  EXPECT_DOUBLE_EQ(trajectory.sample(std::chrono::milliseconds(35)).get_positions()(1), 2.5);
+  EXPECT_DOUBLE_EQ(trajectory.sample(std::chrono::microseconds(12500)).get_positions()(0), 0.25);
+  EXPECT_DOUBLE_EQ(trajectory.sample(std::chrono::milliseconds(100)).get_positions()(0), 4);
+}
+
+TEST(TrajectoryTest, SampleCartesian) {
+  state_representation::Trajectory<state_representation::CartesianState> trajectory;
+  state_representation::CartesianState start("frame");
+  start.set_position(Eigen::Vector3d(0, 0, 0));
+  state_representation::CartesianState end("frame");
+  end.set_position(Eigen::Vector3d(1, 2, 3));
+  end.set_orientation(Eigen::Quaterniond(Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ())));
+  trajectory.add_point(start, std::chrono::seconds(0));
+  trajectory.add_point(end, std::chrono::seconds(1));
+
+  state_representation::CartesianState middle = trajectory.sample(std::chrono::milliseconds(500));
+  EXPECT_TRUE(middle.get_position().isApprox(Eigen::Vector3d(0.5, 1, 1.5)));
+  EXPECT_TRUE(middle.get_orientation().isApprox(
+      Eigen::Quaterniond(Eigen::AngleAxisd(M_PI_4, Eigen::Vector3d::UnitZ()))));
+}
+
+TEST(TrajectoryTest, DeletePointsBefore) {
+  state_representation::Trajectory<state_representation::JointState> trajectory;
+  state_representation::JointState point("robot", 1);
+  for (int i = 0; i < 10; ++i) {
+    point.set_positions(Eigen::VectorXd::Constant(1, i));
+    trajectory.add_point(point, std::chrono::milliseconds(10));
+  }
+  trajectory.delete_first_point();
+  EXPECT_EQ(trajectory.get_size(), 9);
+  EXPECT_EQ(trajectory.get_times().front(), std::chrono::milliseconds(20));
+
+  EXPECT_EQ(trajectory.delete_points_before(std::chrono::milliseconds(55)), 4);
+  EXPECT_EQ(trajectory.get_size(), 5);
+  EXPECT_EQ(trajectory.get_times().front(), std::chrono::milliseconds(60));
+  EXPECT_DOUBLE_EQ(trajectory.get_point(0).get_positions()(0), 5);
+  EXPECT_EQ(trajectory.delete_points_before(std::chrono::milliseconds(10)), 0);
+
+  // appending after trimming continues from the last time
+  trajectory.add_point(point, std::chrono::milliseconds(10));
+  EXPECT_EQ(trajectory.get_times().back(), std::chrono::milliseconds(110));
+}
+
 // TEST(TrajectoryTest, InsertPoint)
 // {
 // 	state_representation::Trajectory<state_representation::JointState> trajectory;
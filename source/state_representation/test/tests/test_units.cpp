@@ -1,12 +1,23 @@
 #include <gtest/gtest.h>
 #include <fstream>
+#include <type_traits>
 #include "state_representation/units/Distance.hpp"
 #include "state_representation/units/Angle.hpp"
 #include "state_representation/units/Velocity.hpp"
+#include "state_representation/units/Gain.hpp"
+#include "state_representation/space/cartesian/CartesianPose.hpp"
+#include "state_representation/robot/JointVelocities.hpp"
 
 using namespace state_representation::units;
 using namespace state_representation::units::literals;
 
+template<class StateT, class = void>
+struct has_typed_position : std::false_type {};
+
+template<class StateT>
+struct has_typed_position<StateT, std::void_t<decltype(std::declval<StateT>().get_typed_position())>>
+    : std::true_type {};
+
 TEST(UnitsTest, CreateDistances) {
   Distance d1 = 1.0_dm;
   Distance d2 = 0.1_m;
@@ -52,4 +63,85 @@ TEST(UnitsTest, CreateAngles) {
   Angle a3 = -M_PI / 2;
   Angle a4 = -90.0_deg;
   EXPECT_TRUE(a3 == a4);
+
+  // the value is wrapped, the value as given is kept
+  Angle a5 = 270.0_deg;
+  EXPECT_TRUE(a5 == a4);
+  EXPECT_NEAR(a5.get_value(), -M_PI / 2, 1e-12);
+  EXPECT_NEAR(a5.get_unwrapped_value(), 3 * M_PI / 2, 1e-12);
+  EXPECT_NEAR((a5 + a4).get_unwrapped_value(), M_PI, 1e-12);
+  EXPECT_NEAR((a5 * 0.5).get_value(), -M_PI / 4, 1e-12);
+}
+
+TEST(UnitsTest, CreateGains) {
+  // the conversions and the validation of constant values happen at compile time
+  static_assert(Gain(2.0).get_value() == 2.0);
+  static_assert((Gain(2.0) * 0.5) == Gain(1.0));
+  static_assert(Distance(50.0_cm) == 0.5_m);
+  EXPECT_THROW(Gain(-1.0), state_representation::exceptions::InvalidParameterException);
+}
+
+TEST(UnitsTest, TypedStateSetters) {
+  state_representation::CartesianState state("test");
+  state.set_position(10.0_cm, 1.0_m, 5.0_mm);
+  EXPECT_TRUE(state.get_position().isApprox(Eigen::Vector3d(0.1, 1, 0.005)));
+  state.set_linear_velocity(3.6_km_h, 0.0_m_s, -1.0_m_s);
+  EXPECT_TRUE(state.get_linear_velocity().isApprox(Eigen::Vector3d(1, 0, -1)));
+  state.set_angular_velocity(180.0_deg_s, 0.0_rad_s, 1.0_rad_s);
+  EXPECT_TRUE(state.get_angular_velocity().isApprox(Eigen::Vector3d(M_PI, 0, 1)));
+
+  state_representation::CartesianTwist twist("test", Eigen::Vector3d(2, 0, 0), Eigen::Vector3d(0, 0, 2));
+  twist.clamp(1.0_m_s, 90.0_deg_s);
+  EXPECT_NEAR(twist.get_linear_velocity().norm(), 1, 1e-12);
+  EXPECT_NEAR(twist.get_angular_velocity().norm(), M_PI / 2, 1e-12);
+
+  state_representation::JointState joints("robot", 3);
+  joints.set_position(90.0_deg, 1);
+  EXPECT_NEAR(joints.get_positions()(1), M_PI / 2, 1e-12);
+  joints.set_position(270.0_deg, 0);
+  EXPECT_NEAR(joints.get_positions()(0), 3 * M_PI / 2, 1e-12);
+  EXPECT_FALSE(joints.is_empty());
+  state_representation::JointVelocities velocities("robot", 3);
+  velocities.set_velocity(1.0_rad_s, 2);
+  EXPECT_EQ(velocities.get_velocities()(2), 1);
+  EXPECT_THROW(velocities.set_velocity(1.0_rad_s, 3), IncompatibleSizeException);
+}
+
+TEST(UnitsTest, VectorQuantities) {
+  static_assert(LinearVelocity(3.6_km_h) == 1.0_m_s);
+  static_assert(LinearVelocity(1.0_m_ms) == 1000.0_m_s);
+  static_assert(AngularVelocity(180.0_deg_s) == AngularVelocity(M_PI));
+
+  Distance3 displacement(1.0_m, 20.0_cm, -5.0_mm);
+  EXPECT_TRUE(displacement.get_value().isApprox(Eigen::Vector3d(1, 0.2, -0.005)));
+  EXPECT_TRUE(displacement.y() == 0.2_m);
+  EXPECT_TRUE((displacement + displacement) == 2 * displacement);
+  EXPECT_TRUE((displacement - displacement).norm() == 0.0_m);
+
+  Velocity3 velocity = displacement / std::chrono::milliseconds(100);
+  EXPECT_TRUE(velocity == Velocity3(10.0_m_s, 2.0_m_s, -0.05_m_s));
+  EXPECT_TRUE(velocity.x() == 36.0_km_h);
+
+  state_representation::CartesianTwist twist("test");
+  twist.set_linear_velocity(velocity);
+  twist.set_angular_velocity(AngularVelocity3(0.0_rad_s, 0.0_rad_s, 90.0_deg_s));
+  auto linear = twist.get_typed_linear_velocity();
+  EXPECT_EQ(linear.get_value().data(), twist.get_linear_velocity().data());
+  EXPECT_TRUE(linear == velocity);
+  EXPECT_TRUE(twist.get_typed_angular_velocity().z() == 90.0_deg_s);
+
+  state_representation::CartesianPose pose("test");
+  pose.set_position(displacement);
+  EXPECT_EQ(pose.get_typed_position().get_value().data(), pose.get_position().data());
+  Distance3 copy = pose.get_typed_position();
+  pose.set_position(Distance3());
+  EXPECT_TRUE(copy == displacement);
+  EXPECT_TRUE(pose.get_typed_position().norm() == 0.0_m);
+
+  // views cannot refer to temporaries, while vectors copy them
+  static_assert(has_typed_position<state_representation::CartesianPose&>::value);
+  static_assert(!has_typed_position<state_representation::CartesianPose>::value);
+  static_assert(!std::is_constructible_v<Vector3View<Distance>, Eigen::Vector3d>);
+  static_assert(std::is_constructible_v<Vector3View<Distance>, const Eigen::Vector3d&>);
+  static_assert(std::is_constructible_v<Distance3, Eigen::Vector3d>);
 }